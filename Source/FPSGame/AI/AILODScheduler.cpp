@@ -0,0 +1,634 @@
+#include "AILODScheduler.h"
+#include "Engine/World.h"
+#include "Engine/Engine.h"
+#include "Kismet/GameplayStatics.h"
+#include "GameFramework/Pawn.h"
+#include "Optimization/FrameBudgetSubsystem.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogAILODScheduler, Log, All);
+
+UAILODScheduler::UAILODScheduler()
+{
+    FrameBudgetMS = 2.0f;
+    MaxUpdatesPerFrame = 8;
+    bBudgetFromAgents = true;
+    LastFrameCostMS = 0.0f;
+    LastProcessedTime = -1.0;
+    StatsWindowStart = 0.0;
+}
+
+void UAILODScheduler::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    // Near agents may use the whole budget, distant buckets only a slice of it
+    Buckets[(int32)EAILODLevel::HighDetail].BudgetShare = 1.0f;
+    Buckets[(int32)EAILODLevel::MediumDetail].BudgetShare = 0.5f;
+    Buckets[(int32)EAILODLevel::LowDetail].BudgetShare = 0.25f;
+    Buckets[(int32)EAILODLevel::Culled].BudgetShare = 0.1f;
+
+    for (FAILODBucket& Bucket : Buckets)
+    {
+        Bucket.LatencySamples.Reserve(LatencySampleCount);
+    }
+
+    UE_LOG(LogAILODScheduler, Log, TEXT("AI LOD scheduler initialized"));
+}
+
+void UAILODScheduler::Deinitialize()
+{
+    for (FAILODBucket& Bucket : Buckets)
+    {
+        Bucket.Agents.Empty();
+        Bucket.Handles.Empty();
+        Bucket.Deadlines.Empty();
+        Bucket.LastUpdateTimes.Empty();
+        Bucket.LatencySamples.Empty();
+    }
+
+    AgentRecords.Empty();
+    FreeRecords.Empty();
+    AgentToHandle.Empty();
+    DeadlineHeap.Empty();
+    PendingDecisions.Empty();
+
+    for (TArray<FAIWakeEntry>& Slot : WakeWheel)
+    {
+        Slot.Empty();
+    }
+    WakeSlotByHandle.Empty();
+
+    Super::Deinitialize();
+}
+
+bool UAILODScheduler::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UAILODScheduler::Tick(float DeltaTime)
+{
+    ProcessDueAgents();
+}
+
+TStatId UAILODScheduler::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UAILODScheduler, STATGROUP_Tickables);
+}
+
+UAILODScheduler* UAILODScheduler::Get(const UObject* WorldContextObject)
+{
+    UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
+    return World ? World->GetSubsystem<UAILODScheduler>() : nullptr;
+}
+
+void UAILODScheduler::RegisterAgent(UAdvancedAISystem* Agent)
+{
+    if (!Agent || AgentToHandle.Contains(Agent) || !GetWorld())
+    {
+        return;
+    }
+
+    // The first agent seeds the frame budget unless it was set explicitly
+    if (bBudgetFromAgents)
+    {
+        FrameBudgetMS = Agent->OptimizationSettings.TimeSliceBudgetMS;
+        MaxUpdatesPerFrame = FMath::Max(1, FMath::RoundToInt(Agent->OptimizationSettings.MaxAIUpdatesPerFrame));
+        bBudgetFromAgents = false;
+    }
+
+    const int32 Handle = FreeRecords.Num() > 0 ? FreeRecords.Pop(false) : AgentRecords.AddDefaulted();
+    AgentRecords[Handle].Agent = Agent;
+    AgentToHandle.Add(Agent, Handle);
+
+    // Spread first updates over one interval so a freshly loaded level doesn't spike a single frame
+    const double Now = GetWorld()->GetTimeSeconds();
+    const double Deadline = Now + FMath::FRandRange(0.0f, Agent->GetCurrentUpdateInterval());
+
+    AddToBucket(Handle, (int32)Agent->CurrentLODLevel, Deadline, Now);
+    Schedule(Handle, Deadline);
+}
+
+void UAILODScheduler::UnregisterAgent(UAdvancedAISystem* Agent)
+{
+    int32 Handle = INDEX_NONE;
+    if (!AgentToHandle.RemoveAndCopyValue(Agent, Handle))
+    {
+        return;
+    }
+
+    RemoveFromBucket(Handle);
+    PendingDecisions.RemoveSingleSwap(Agent, false);
+
+    // Bumping the serial invalidates any heap entries still pointing at this handle
+    FAIAgentRecord& Record = AgentRecords[Handle];
+    Record.Agent = nullptr;
+    Record.Serial++;
+    FreeRecords.Add(Handle);
+}
+
+void UAILODScheduler::NotifyLODChanged(UAdvancedAISystem* Agent)
+{
+    const int32* HandlePtr = AgentToHandle.Find(Agent);
+    if (!HandlePtr)
+    {
+        return;
+    }
+
+    const int32 Handle = *HandlePtr;
+    const FAIAgentRecord& Record = AgentRecords[Handle];
+    const int32 NewBucket = (int32)Agent->CurrentLODLevel;
+    if (Record.Bucket == NewBucket)
+    {
+        return;
+    }
+
+    const double OldDeadline = Buckets[Record.Bucket].Deadlines[Record.Slot];
+    const double LastUpdate = Buckets[Record.Bucket].LastUpdateTimes[Record.Slot];
+
+    RemoveFromBucket(Handle);
+
+    // Promotion to a nearer bucket pulls the next update forward; demotion keeps the current deadline
+    const double NewDeadline = FMath::Min(OldDeadline, LastUpdate + Agent->GetCurrentUpdateInterval());
+    AddToBucket(Handle, NewBucket, NewDeadline, LastUpdate);
+
+    if (NewDeadline < OldDeadline)
+    {
+        Schedule(Handle, NewDeadline);
+    }
+}
+
+uint64 UAILODScheduler::ScheduleWake(float Delay, FSimpleDelegate Callback)
+{
+    UWorld* World = GetWorld();
+    if (!World || !Callback.IsBound())
+    {
+        return 0;
+    }
+
+    const double WakeTime = World->GetTimeSeconds() + FMath::Max(0.0f, Delay);
+
+    // Never land in a slot whose tick has fully passed; the current tick's slot is still visited every frame
+    int64 WheelTick = (int64)FMath::FloorToDouble(WakeTime / WakeWheelResolution);
+    if (WakeWheelTick != INDEX_NONE)
+    {
+        WheelTick = FMath::Max(WheelTick, WakeWheelTick + 1);
+    }
+    const int32 SlotIndex = (int32)(WheelTick % WakeWheelSlots);
+
+    FAIWakeEntry& Entry = WakeWheel[SlotIndex].AddDefaulted_GetRef();
+    Entry.Handle = NextWakeHandle++;
+    Entry.WakeTime = WakeTime;
+    Entry.Callback = MoveTemp(Callback);
+
+    WakeSlotByHandle.Add(Entry.Handle, SlotIndex);
+    return Entry.Handle;
+}
+
+void UAILODScheduler::CancelWake(uint64 WakeHandle)
+{
+    int32 SlotIndex = INDEX_NONE;
+    if (WakeSlotByHandle.RemoveAndCopyValue(WakeHandle, SlotIndex))
+    {
+        WakeWheel[SlotIndex].RemoveAllSwap([WakeHandle](const FAIWakeEntry& Entry) { return Entry.Handle == WakeHandle; });
+    }
+}
+
+void UAILODScheduler::AdvanceWakeWheel(double Now)
+{
+    const int64 CurrentTick = (int64)FMath::FloorToDouble(Now / WakeWheelResolution);
+    if (WakeWheelTick == INDEX_NONE)
+    {
+        WakeWheelTick = CurrentTick - 1;
+    }
+
+    // Visit each slot from the oldest tick not yet fully passed up to the current one, at most one full
+    // revolution; the current slot is revisited every frame until its tick is over, so wakes due later in it still fire
+    const int64 TicksToVisit = FMath::Min<int64>(CurrentTick - WakeWheelTick, WakeWheelSlots);
+    TArray<FSimpleDelegate, TInlineAllocator<16>> DueCallbacks;
+
+    for (int64 Step = 0; Step < TicksToVisit; ++Step)
+    {
+        const int32 SlotIndex = (int32)((CurrentTick - Step) % WakeWheelSlots);
+        TArray<FAIWakeEntry>& Slot = WakeWheel[SlotIndex];
+
+        for (int32 EntryIndex = Slot.Num() - 1; EntryIndex >= 0; --EntryIndex)
+        {
+            if (Slot[EntryIndex].WakeTime <= Now)
+            {
+                WakeSlotByHandle.Remove(Slot[EntryIndex].Handle);
+                DueCallbacks.Add(MoveTemp(Slot[EntryIndex].Callback));
+                Slot.RemoveAtSwap(EntryIndex, 1, false);
+            }
+        }
+    }
+
+    WakeWheelTick = FMath::Max(WakeWheelTick, CurrentTick - 1);
+
+    // Callbacks may schedule new wakes, so run them once the wheel is consistent
+    for (FSimpleDelegate& Callback : DueCallbacks)
+    {
+        Callback.ExecuteIfBound();
+    }
+}
+
+void UAILODScheduler::ProcessDueAgents()
+{
+    UWorld* World = GetWorld();
+    if (!World || World->GetTimeSeconds() == LastProcessedTime)
+    {
+        return;
+    }
+    LastProcessedTime = World->GetTimeSeconds();
+
+    ResetFrameStats();
+    RefreshDistanceLOD();
+
+    const double Now = World->GetTimeSeconds();
+    AdvanceWakeWheel(Now);
+    const double FrameStart = FPlatformTime::Seconds();
+
+    // FrameBudgetMS is what the scheduler asks the arbiter for; the grant is what it may spend
+    UFrameBudgetSubsystem* FrameBudget = World->GetSubsystem<UFrameBudgetSubsystem>();
+    if (FrameBudget && FrameBudgetConsumer == INDEX_NONE)
+    {
+        FrameBudgetConsumer = FrameBudget->RegisterConsumer(TEXT("AI"), EFrameBudgetPriority::High, MinGrantedBudgetUS, FrameBudgetMS * 1000.0f);
+    }
+
+    double BudgetSeconds = FrameBudgetMS * 0.001;
+    if (FrameBudget && FrameBudgetConsumer != INDEX_NONE)
+    {
+        FrameBudget->SetDesiredBudget(FrameBudgetConsumer, FrameBudgetMS * 1000.0f);
+        BudgetSeconds = FMath::Max(0.0f, FrameBudget->GetRemainingBudgetUs(FrameBudgetConsumer)) * 0.000001;
+    }
+
+    double BucketSpent[NumBuckets] = { 0.0, 0.0, 0.0, 0.0 };
+    TArray<FAIScheduleEntry, TInlineAllocator<16>> Deferred;
+    int32 UpdatesProcessed = 0;
+
+    while (DeadlineHeap.Num() > 0 && UpdatesProcessed < MaxUpdatesPerFrame)
+    {
+        if (DeadlineHeap.HeapTop().Deadline > Now)
+        {
+            break;
+        }
+
+        if (FPlatformTime::Seconds() - FrameStart >= BudgetSeconds)
+        {
+            break;
+        }
+
+        FAIScheduleEntry Entry;
+        DeadlineHeap.HeapPop(Entry, false);
+
+        // Skip entries made stale by unregistering or rescheduling
+        const FAIAgentRecord& Record = AgentRecords[Entry.Handle];
+        if (Record.Serial != Entry.Serial || !Record.Agent)
+        {
+            continue;
+        }
+
+        const int32 BucketIndex = Record.Bucket;
+        FAILODBucket& Bucket = Buckets[BucketIndex];
+
+        // Distant buckets are capped to their share so they never starve near agents
+        if (BucketSpent[BucketIndex] >= BudgetSeconds * Bucket.BudgetShare)
+        {
+            Deferred.Add(Entry);
+            Bucket.Stats.DeferredLastFrame++;
+            continue;
+        }
+
+        UAdvancedAISystem* Agent = Record.Agent;
+        if (!IsValid(Agent))
+        {
+            UnregisterAgent(Agent);
+            continue;
+        }
+
+        const float DeltaTime = (float)(Now - Bucket.LastUpdateTimes[Record.Slot]);
+        const float LatencyMS = (float)((Now - Entry.Deadline) * 1000.0);
+
+        const double UpdateStart = FPlatformTime::Seconds();
+        Agent->UpdateAILogicOptimized(DeltaTime);
+        const double UpdateCost = FPlatformTime::Seconds() - UpdateStart;
+
+        // The update may have registered or removed agents, so look the record up again
+        const FAIAgentRecord& UpdatedRecord = AgentRecords[Entry.Handle];
+        if (UpdatedRecord.Agent == Agent && UpdatedRecord.Bucket != INDEX_NONE)
+        {
+            Buckets[UpdatedRecord.Bucket].LastUpdateTimes[UpdatedRecord.Slot] = Now;
+            Agent->LastUpdateTime = Now;
+            Schedule(Entry.Handle, Now + Agent->GetCurrentUpdateInterval());
+        }
+
+        BucketSpent[BucketIndex] += UpdateCost;
+        RecordLatency(Buckets[BucketIndex], LatencyMS, (float)(UpdateCost * 1000.0));
+        UpdatesProcessed++;
+    }
+
+    for (const FAIScheduleEntry& Entry : Deferred)
+    {
+        DeadlineHeap.HeapPush(Entry);
+    }
+
+    for (int32 BucketIndex = 0; BucketIndex < NumBuckets; ++BucketIndex)
+    {
+        Buckets[BucketIndex].Stats.BudgetUsedMS = (float)(BucketSpent[BucketIndex] * 1000.0);
+    }
+
+    FlushTacticalDecisions();
+
+    LastFrameCostMS = (float)((FPlatformTime::Seconds() - FrameStart) * 1000.0);
+
+    if (FrameBudget)
+    {
+        FrameBudget->ReportUsage(FrameBudgetConsumer, LastFrameCostMS * 1000.0f);
+    }
+}
+
+void UAILODScheduler::RequestTacticalDecision(UAdvancedAISystem* Agent)
+{
+    if (Agent)
+    {
+        PendingDecisions.AddUnique(Agent);
+    }
+}
+
+void UAILODScheduler::FlushTacticalDecisions()
+{
+    // Agents destroyed since they queued are dropped before grouping, so every group starts with a live agent
+    for (int32 Index = PendingDecisions.Num() - 1; Index >= 0; --Index)
+    {
+        if (!IsValid(PendingDecisions[Index]))
+        {
+            PendingDecisions.RemoveAtSwap(Index, 1, false);
+        }
+    }
+
+    LastDecisionBatchSize = PendingDecisions.Num();
+    if (PendingDecisions.Num() == 0)
+    {
+        LastDecisionBatchCostMS = 0.0f;
+        return;
+    }
+
+    const double BatchStart = FPlatformTime::Seconds();
+
+    // Agents sharing a utility profile are scored together; most levels use a single profile
+    while (PendingDecisions.Num() > 0)
+    {
+        // A decision applied for an earlier group can take an agent down with it
+        if (!IsValid(PendingDecisions[0]))
+        {
+            PendingDecisions.RemoveAtSwap(0, 1, false);
+            continue;
+        }
+
+        const UAIUtilityProfile* Profile = PendingDecisions[0]->UtilityProfile;
+
+        TArray<UAdvancedAISystem*> Group;
+        for (int32 Index = PendingDecisions.Num() - 1; Index >= 0; --Index)
+        {
+            if (!IsValid(PendingDecisions[Index]))
+            {
+                PendingDecisions.RemoveAtSwap(Index, 1, false);
+            }
+            else if (PendingDecisions[Index]->UtilityProfile == Profile)
+            {
+                Group.Add(PendingDecisions[Index]);
+                PendingDecisions.RemoveAtSwap(Index, 1, false);
+            }
+        }
+
+        DecisionInputs.Reset(Group.Num());
+        for (int32 AgentIndex = 0; AgentIndex < Group.Num(); ++AgentIndex)
+        {
+            Group[AgentIndex]->GatherUtilityInputs(DecisionInputs, AgentIndex);
+        }
+
+        const FAIUtilityScorer& Scorer = Group[0]->GetUtilityScorer();
+        Scorer.EvaluateBatch(DecisionInputs, DecisionResults);
+
+        for (int32 AgentIndex = 0; AgentIndex < Group.Num(); ++AgentIndex)
+        {
+            if (IsValid(Group[AgentIndex]) && DecisionResults[AgentIndex] != INDEX_NONE)
+            {
+                Group[AgentIndex]->ApplyUtilityDecision(Scorer.GetActionBehavior(DecisionResults[AgentIndex]));
+            }
+        }
+    }
+
+    LastDecisionBatchCostMS = (float)((FPlatformTime::Seconds() - BatchStart) * 1000.0);
+}
+
+void UAILODScheduler::SetFrameBudget(float BudgetMS, int32 InMaxUpdatesPerFrame)
+{
+    FrameBudgetMS = FMath::Max(0.0f, BudgetMS);
+    MaxUpdatesPerFrame = FMath::Max(1, InMaxUpdatesPerFrame);
+    bBudgetFromAgents = false;
+}
+
+void UAILODScheduler::SetBucketBudgetShare(EAILODLevel LODLevel, float Share)
+{
+    Buckets[(int32)LODLevel].BudgetShare = FMath::Clamp(Share, 0.0f, 1.0f);
+}
+
+FAILODBucketStats UAILODScheduler::GetBucketStats(EAILODLevel LODLevel) const
+{
+    const FAILODBucket& Bucket = Buckets[(int32)LODLevel];
+    FAILODBucketStats Stats = Bucket.Stats;
+    Stats.AgentCount = Bucket.Agents.Num();
+    return Stats;
+}
+
+float UAILODScheduler::GetBucketLatencyPercentile(EAILODLevel LODLevel, float Percentile) const
+{
+    TArray<float> Sorted = Buckets[(int32)LODLevel].LatencySamples;
+    if (Sorted.Num() == 0)
+    {
+        return 0.0f;
+    }
+
+    Sorted.Sort();
+    const int32 Index = FMath::Clamp(FMath::FloorToInt((Percentile / 100.0f) * (Sorted.Num() - 1)), 0, Sorted.Num() - 1);
+    return Sorted[Index];
+}
+
+FString UAILODScheduler::GenerateSchedulerReport() const
+{
+    FString Report = TEXT("=== AI LOD Scheduler ===\n");
+    Report += FString::Printf(TEXT("Registered Agents: %d\n"), GetRegisteredAgentCount());
+    Report += FString::Printf(TEXT("Frame Budget: %.2f ms, Max Updates: %d\n"), FrameBudgetMS, MaxUpdatesPerFrame);
+    Report += FString::Printf(TEXT("Last Frame Cost: %.3f ms\n"), LastFrameCostMS);
+    Report += FString::Printf(TEXT("Dormant Agents Waiting: %d\n"), GetPendingWakeCount());
+
+    for (int32 BucketIndex = 0; BucketIndex < NumBuckets; ++BucketIndex)
+    {
+        const EAILODLevel LODLevel = (EAILODLevel)BucketIndex;
+        const FAILODBucketStats Stats = GetBucketStats(LODLevel);
+
+        Report += FString::Printf(TEXT("%s: %d agents, %d updates, %d deferred, latency avg %.1f ms / p95 %.1f ms / max %.1f ms, cost %.3f ms\n"),
+            *UEnum::GetValueAsString(LODLevel),
+            Stats.AgentCount,
+            Stats.UpdatesLastFrame,
+            Stats.DeferredLastFrame,
+            Stats.AverageLatencyMS,
+            GetBucketLatencyPercentile(LODLevel, 95.0f),
+            Stats.MaxLatencyMS,
+            Stats.AverageUpdateCostMS);
+    }
+
+    return Report;
+}
+
+void UAILODScheduler::RefreshDistanceLOD()
+{
+    APawn* Player = UGameplayStatics::GetPlayerPawn(GetWorld(), 0);
+    if (!Player)
+    {
+        return;
+    }
+
+    const FVector PlayerLocation = Player->GetActorLocation();
+
+    TArray<TPair<UAdvancedAISystem*, EAILODLevel>, TInlineAllocator<16>> LODChanges;
+    TArray<UAdvancedAISystem*, TInlineAllocator<4>> InvalidAgents;
+
+    for (int32 BucketIndex = 0; BucketIndex < NumBuckets; ++BucketIndex)
+    {
+        const TArray<UAdvancedAISystem*>& Agents = Buckets[BucketIndex].Agents;
+        for (UAdvancedAISystem* Agent : Agents)
+        {
+            if (!IsValid(Agent) || !Agent->GetOwner())
+            {
+                InvalidAgents.Add(Agent);
+                continue;
+            }
+
+            if (!Agent->OptimizationSettings.bEnableDistanceLOD)
+            {
+                continue;
+            }
+
+            Agent->DistanceToPlayer = FVector::Dist(Agent->GetOwner()->GetActorLocation(), PlayerLocation);
+
+            const EAILODLevel NewLODLevel = Agent->ComputeLODLevel(Agent->DistanceToPlayer);
+            if ((int32)NewLODLevel != BucketIndex)
+            {
+                LODChanges.Emplace(Agent, NewLODLevel);
+            }
+        }
+    }
+
+    // Bucket moves happen after the sweep so the arrays aren't mutated while iterating
+    for (UAdvancedAISystem* Agent : InvalidAgents)
+    {
+        UnregisterAgent(Agent);
+    }
+
+    for (const TPair<UAdvancedAISystem*, EAILODLevel>& Change : LODChanges)
+    {
+        Change.Key->SetLODLevel(Change.Value);
+    }
+}
+
+void UAILODScheduler::AddToBucket(int32 Handle, int32 BucketIndex, double Deadline, double LastUpdateTime)
+{
+    FAILODBucket& Bucket = Buckets[BucketIndex];
+    FAIAgentRecord& Record = AgentRecords[Handle];
+
+    Record.Bucket = BucketIndex;
+    Record.Slot = Bucket.Agents.Add(Record.Agent);
+    Bucket.Handles.Add(Handle);
+    Bucket.Deadlines.Add(Deadline);
+    Bucket.LastUpdateTimes.Add(LastUpdateTime);
+}
+
+void UAILODScheduler::RemoveFromBucket(int32 Handle)
+{
+    FAIAgentRecord& Record = AgentRecords[Handle];
+    if (Record.Bucket == INDEX_NONE)
+    {
+        return;
+    }
+
+    FAILODBucket& Bucket = Buckets[Record.Bucket];
+    const int32 Slot = Record.Slot;
+
+    Bucket.Agents.RemoveAtSwap(Slot, 1, false);
+    Bucket.Handles.RemoveAtSwap(Slot, 1, false);
+    Bucket.Deadlines.RemoveAtSwap(Slot, 1, false);
+    Bucket.LastUpdateTimes.RemoveAtSwap(Slot, 1, false);
+
+    // Fix up the record of the agent that was swapped into the hole
+    if (Slot < Bucket.Handles.Num())
+    {
+        AgentRecords[Bucket.Handles[Slot]].Slot = Slot;
+    }
+
+    Record.Bucket = INDEX_NONE;
+    Record.Slot = INDEX_NONE;
+}
+
+void UAILODScheduler::Schedule(int32 Handle, double Deadline)
+{
+    FAIAgentRecord& Record = AgentRecords[Handle];
+    Record.Serial++;
+
+    if (Record.Bucket != INDEX_NONE)
+    {
+        Buckets[Record.Bucket].Deadlines[Record.Slot] = Deadline;
+    }
+
+    FAIScheduleEntry Entry;
+    Entry.Deadline = Deadline;
+    Entry.Handle = Handle;
+    Entry.Serial = Record.Serial;
+    DeadlineHeap.HeapPush(Entry);
+}
+
+void UAILODScheduler::RecordLatency(FAILODBucket& Bucket, float LatencyMS, float CostMS)
+{
+    FAILODBucketStats& Stats = Bucket.Stats;
+
+    // Exponential moving averages keep the stats cheap to maintain
+    const bool bFirstSample = Bucket.LatencySamples.Num() == 0;
+    Stats.AverageLatencyMS = bFirstSample ? LatencyMS : FMath::Lerp(Stats.AverageLatencyMS, LatencyMS, 0.1f);
+    Stats.AverageUpdateCostMS = bFirstSample ? CostMS : FMath::Lerp(Stats.AverageUpdateCostMS, CostMS, 0.1f);
+    Stats.MaxLatencyMS = FMath::Max(Stats.MaxLatencyMS, LatencyMS);
+    Stats.UpdatesLastFrame++;
+
+    if (Bucket.LatencySamples.Num() < LatencySampleCount)
+    {
+        Bucket.LatencySamples.Add(LatencyMS);
+    }
+    else
+    {
+        Bucket.LatencySamples[Bucket.LatencySampleIndex] = LatencyMS;
+    }
+    Bucket.LatencySampleIndex = (Bucket.LatencySampleIndex + 1) % LatencySampleCount;
+}
+
+void UAILODScheduler::ResetFrameStats()
+{
+    const double Now = FPlatformTime::Seconds();
+    const bool bResetWindow = (Now - StatsWindowStart) > 1.0;
+    if (bResetWindow)
+    {
+        StatsWindowStart = Now;
+    }
+
+    for (FAILODBucket& Bucket : Buckets)
+    {
+        Bucket.Stats.UpdatesLastFrame = 0;
+        Bucket.Stats.DeferredLastFrame = 0;
+        Bucket.Stats.BudgetUsedMS = 0.0f;
+
+        // Max latency is reported over a one second window
+        if (bResetWindow)
+        {
+            Bucket.Stats.MaxLatencyMS = 0.0f;
+        }
+    }
+}
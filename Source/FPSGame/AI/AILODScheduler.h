@@ -0,0 +1,221 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "AdvancedAISystem.h"
+#include "AIUtilityScoring.h"
+#include "AILODScheduler.generated.h"
+
+/**
+ * Per-bucket scheduling statistics.
+ * Latency is how far past its deadline (in game time) an agent was actually updated.
+ */
+USTRUCT(BlueprintType)
+struct FAILODBucketStats
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "AI|Scheduler")
+    int32 AgentCount = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "AI|Scheduler")
+    int32 UpdatesLastFrame = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "AI|Scheduler")
+    int32 DeferredLastFrame = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "AI|Scheduler")
+    float AverageLatencyMS = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "AI|Scheduler")
+    float MaxLatencyMS = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "AI|Scheduler")
+    float AverageUpdateCostMS = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "AI|Scheduler")
+    float BudgetUsedMS = 0.0f;
+
+    FAILODBucketStats()
+    {
+        AgentCount = 0;
+        UpdatesLastFrame = 0;
+        DeferredLastFrame = 0;
+        AverageLatencyMS = 0.0f;
+        MaxLatencyMS = 0.0f;
+        AverageUpdateCostMS = 0.0f;
+        BudgetUsedMS = 0.0f;
+    }
+};
+
+/**
+ * Central time-slicing scheduler for UAdvancedAISystem.
+ * Agents live in per-LOD buckets (contiguous SoA arrays) and are updated in deadline order
+ * under a single frame budget. Farther buckets are capped to a share of that budget so they
+ * can never crowd out near agents.
+ */
+UCLASS()
+class FPSGAME_API UAILODScheduler : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    UAILODScheduler();
+
+    // USubsystem interface
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    // FTickableGameObject interface
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    static UAILODScheduler* Get(const UObject* WorldContextObject);
+
+    // Registration
+    void RegisterAgent(UAdvancedAISystem* Agent);
+    void UnregisterAgent(UAdvancedAISystem* Agent);
+    void NotifyLODChanged(UAdvancedAISystem* Agent);
+
+    // Queues a utility decision; all queued agents are scored as one batch per frame
+    void RequestTacticalDecision(UAdvancedAISystem* Agent);
+
+    // Wake-up wheel for dormant AI; the callback fires on the game thread once Delay has elapsed
+    uint64 ScheduleWake(float Delay, FSimpleDelegate Callback);
+    void CancelWake(uint64 WakeHandle);
+
+    UFUNCTION(BlueprintCallable, Category = "AI|Scheduler")
+    int32 GetPendingWakeCount() const { return WakeSlotByHandle.Num(); }
+
+    // Runs every agent whose deadline has passed, within the frame budget
+    UFUNCTION(BlueprintCallable, Category = "AI|Scheduler")
+    void ProcessDueAgents();
+
+    UFUNCTION(BlueprintCallable, Category = "AI|Scheduler")
+    void SetFrameBudget(float BudgetMS, int32 InMaxUpdatesPerFrame);
+
+    UFUNCTION(BlueprintCallable, Category = "AI|Scheduler")
+    float GetFrameBudgetMS() const { return FrameBudgetMS; }
+
+    UFUNCTION(BlueprintCallable, Category = "AI|Scheduler")
+    int32 GetMaxUpdatesPerFrame() const { return MaxUpdatesPerFrame; }
+
+    // Fraction of the frame budget each LOD bucket may consume
+    UFUNCTION(BlueprintCallable, Category = "AI|Scheduler")
+    void SetBucketBudgetShare(EAILODLevel LODLevel, float Share);
+
+    // Statistics
+    UFUNCTION(BlueprintCallable, Category = "AI|Scheduler")
+    FAILODBucketStats GetBucketStats(EAILODLevel LODLevel) const;
+
+    UFUNCTION(BlueprintCallable, Category = "AI|Scheduler")
+    float GetBucketLatencyPercentile(EAILODLevel LODLevel, float Percentile) const;
+
+    UFUNCTION(BlueprintCallable, Category = "AI|Scheduler")
+    int32 GetRegisteredAgentCount() const { return AgentRecords.Num() - FreeRecords.Num(); }
+
+    UFUNCTION(BlueprintCallable, Category = "AI|Scheduler")
+    float GetLastFrameCostMS() const { return LastFrameCostMS; }
+
+    UFUNCTION(BlueprintCallable, Category = "AI|Scheduler")
+    float GetLastDecisionBatchCostMS() const { return LastDecisionBatchCostMS; }
+
+    UFUNCTION(BlueprintCallable, Category = "AI|Scheduler")
+    int32 GetLastDecisionBatchSize() const { return LastDecisionBatchSize; }
+
+    UFUNCTION(BlueprintCallable, Category = "AI|Scheduler")
+    FString GenerateSchedulerReport() const;
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    static constexpr int32 NumBuckets = 4;
+    static constexpr int32 LatencySampleCount = 256;
+
+    // Agents of one LOD level, stored as parallel arrays
+    struct FAILODBucket
+    {
+        TArray<UAdvancedAISystem*> Agents;
+        TArray<int32> Handles;
+        TArray<double> Deadlines;
+        TArray<double> LastUpdateTimes;
+
+        // Rolling latency samples for percentile queries
+        TArray<float> LatencySamples;
+        int32 LatencySampleIndex = 0;
+
+        FAILODBucketStats Stats;
+        float BudgetShare = 1.0f;
+    };
+
+    // Stable indirection so heap entries survive swap-removal inside buckets
+    struct FAIAgentRecord
+    {
+        UAdvancedAISystem* Agent = nullptr;
+        int32 Bucket = INDEX_NONE;
+        int32 Slot = INDEX_NONE;
+        uint32 Serial = 0;
+    };
+
+    struct FAIScheduleEntry
+    {
+        double Deadline = 0.0;
+        int32 Handle = INDEX_NONE;
+        uint32 Serial = 0;
+
+        bool operator<(const FAIScheduleEntry& Other) const { return Deadline < Other.Deadline; }
+    };
+
+    FAILODBucket Buckets[NumBuckets];
+    TArray<FAIAgentRecord> AgentRecords;
+    TArray<int32> FreeRecords;
+    TMap<UAdvancedAISystem*, int32> AgentToHandle;
+    TArray<FAIScheduleEntry> DeadlineHeap;
+
+    // Pending utility decisions and reusable batch storage
+    TArray<UAdvancedAISystem*> PendingDecisions;
+    FAIUtilityInputBatch DecisionInputs;
+    TArray<int32> DecisionResults;
+    float LastDecisionBatchCostMS = 0.0f;
+    int32 LastDecisionBatchSize = 0;
+
+    // Timer wheel of dormant agents; entries past the horizon wait in their slot for later revolutions
+    static constexpr int32 WakeWheelSlots = 64;
+    static constexpr double WakeWheelResolution = 0.1;
+
+    struct FAIWakeEntry
+    {
+        uint64 Handle = 0;
+        double WakeTime = 0.0;
+        FSimpleDelegate Callback;
+    };
+
+    TArray<FAIWakeEntry> WakeWheel[WakeWheelSlots];
+    TMap<uint64, int32> WakeSlotByHandle;
+    // Last wheel tick that has fully passed
+    int64 WakeWheelTick = INDEX_NONE;
+    uint64 NextWakeHandle = 1;
+
+    float FrameBudgetMS = 2.0f;
+    int32 MaxUpdatesPerFrame = 8;
+    int32 FrameBudgetConsumer = INDEX_NONE;
+
+    // Near agents keep updating even when the arbiter has nothing left to give
+    static constexpr float MinGrantedBudgetUS = 250.0f;
+    bool bBudgetFromAgents = true;
+    float LastFrameCostMS = 0.0f;
+
+    // World time of the last pass; the scheduler and AI components both call in, but it runs once per world tick
+    double LastProcessedTime = -1.0;
+    double StatsWindowStart = 0.0;
+
+    void RefreshDistanceLOD();
+    void FlushTacticalDecisions();
+    void AddToBucket(int32 Handle, int32 BucketIndex, double Deadline, double LastUpdateTime);
+    void RemoveFromBucket(int32 Handle);
+    void Schedule(int32 Handle, double Deadline);
+    void RecordLatency(FAILODBucket& Bucket, float LatencyMS, float CostMS);
+    void ResetFrameStats();
+    void AdvanceWakeWheel(double Now);
+};
@@ -0,0 +1,266 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "GameFramework/Actor.h"
+
+// Fixed-capacity ring buffer stored inline; adding to a full buffer overwrites the oldest element
+template<typename ElementType, int32 Capacity>
+class TAIRingBuffer
+{
+    static_assert(Capacity > 0, "TAIRingBuffer needs a positive capacity");
+
+public:
+    FORCEINLINE void Add(const ElementType& Element);
+    FORCEINLINE bool AddUnique(const ElementType& Element);
+    FORCEINLINE void PopFront();
+    FORCEINLINE void Reset() { Head = 0; Count = 0; }
+
+    // Index 0 is the oldest element
+    FORCEINLINE const ElementType& operator[](int32 Index) const;
+    FORCEINLINE const ElementType& Front() const { return (*this)[0]; }
+    FORCEINLINE const ElementType& Last() const { return (*this)[Count - 1]; }
+
+    FORCEINLINE bool Contains(const ElementType& Element) const;
+    FORCEINLINE int32 Num() const { return Count; }
+    FORCEINLINE bool IsEmpty() const { return Count == 0; }
+    static constexpr int32 GetCapacity() { return Capacity; }
+
+    // Copies out oldest-first, e.g. for Blueprint getters
+    TArray<ElementType> ToArray() const;
+
+private:
+    ElementType Elements[Capacity];
+    int32 Head = 0;
+    int32 Count = 0;
+};
+
+/**
+ * Flat table of remembered threats.
+ * Scores decay with time since they were last refreshed, so nothing has to walk the table to age it.
+ */
+template<int32 Capacity>
+class TAIThreatTable
+{
+public:
+    struct FEntry
+    {
+        TWeakObjectPtr<AActor> Actor;
+        float Score = 0.0f;
+        double UpdateTime = 0.0;
+    };
+
+    // Fraction of a threat's score lost per second
+    static constexpr float DecayRate = 0.1f;
+
+    // Decayed scores below this are forgotten
+    static constexpr float ForgetThreshold = 0.1f;
+
+    // Overwrites the score; when full, the weakest threat makes room
+    FORCEINLINE void Set(AActor* Actor, float Score, double Now);
+
+    // Adds to the current decayed score
+    FORCEINLINE void Accumulate(AActor* Actor, float Delta, double Now);
+
+    FORCEINLINE float Get(const AActor* Actor, double Now) const;
+    FORCEINLINE float GetTotal(double Now) const;
+
+    // Drops dead actors and forgotten threats
+    void Prune(double Now);
+
+    FORCEINLINE int32 Num() const { return Count; }
+    FORCEINLINE const FEntry& operator[](int32 Index) const { return Entries[Index]; }
+    FORCEINLINE float GetDecayedScore(int32 Index, double Now) const { return Decay(Entries[Index], Now); }
+    FORCEINLINE void Reset() { Count = 0; }
+
+private:
+    FEntry Entries[Capacity];
+    int32 Count = 0;
+
+    FORCEINLINE static float Decay(const FEntry& Entry, double Now)
+    {
+        return Entry.Score * FMath::Exp(-DecayRate * (float)FMath::Max(0.0, Now - Entry.UpdateTime));
+    }
+
+    FORCEINLINE int32 Find(const AActor* Actor) const;
+    FORCEINLINE int32 FindOrAddSlot(AActor* Actor, double Now);
+};
+
+// TAIRingBuffer implementation
+
+template<typename ElementType, int32 Capacity>
+FORCEINLINE void TAIRingBuffer<ElementType, Capacity>::Add(const ElementType& Element)
+{
+    if (Count < Capacity)
+    {
+        Elements[(Head + Count) % Capacity] = Element;
+        Count++;
+    }
+    else
+    {
+        Elements[Head] = Element;
+        Head = (Head + 1) % Capacity;
+    }
+}
+
+template<typename ElementType, int32 Capacity>
+FORCEINLINE bool TAIRingBuffer<ElementType, Capacity>::AddUnique(const ElementType& Element)
+{
+    if (Contains(Element))
+    {
+        return false;
+    }
+
+    Add(Element);
+    return true;
+}
+
+template<typename ElementType, int32 Capacity>
+FORCEINLINE void TAIRingBuffer<ElementType, Capacity>::PopFront()
+{
+    if (Count > 0)
+    {
+        Head = (Head + 1) % Capacity;
+        Count--;
+    }
+}
+
+template<typename ElementType, int32 Capacity>
+FORCEINLINE const ElementType& TAIRingBuffer<ElementType, Capacity>::operator[](int32 Index) const
+{
+    checkSlow(Index >= 0 && Index < Count);
+    return Elements[(Head + Index) % Capacity];
+}
+
+template<typename ElementType, int32 Capacity>
+FORCEINLINE bool TAIRingBuffer<ElementType, Capacity>::Contains(const ElementType& Element) const
+{
+    for (int32 Index = 0; Index < Count; ++Index)
+    {
+        if ((*this)[Index] == Element)
+        {
+            return true;
+        }
+    }
+    return false;
+}
+
+template<typename ElementType, int32 Capacity>
+TArray<ElementType> TAIRingBuffer<ElementType, Capacity>::ToArray() const
+{
+    TArray<ElementType> Result;
+    Result.Reserve(Count);
+    for (int32 Index = 0; Index < Count; ++Index)
+    {
+        Result.Add((*this)[Index]);
+    }
+    return Result;
+}
+
+// TAIThreatTable implementation
+
+template<int32 Capacity>
+FORCEINLINE int32 TAIThreatTable<Capacity>::Find(const AActor* Actor) const
+{
+    for (int32 Index = 0; Index < Count; ++Index)
+    {
+        if (Entries[Index].Actor.Get() == Actor)
+        {
+            return Index;
+        }
+    }
+    return INDEX_NONE;
+}
+
+template<int32 Capacity>
+FORCEINLINE int32 TAIThreatTable<Capacity>::FindOrAddSlot(AActor* Actor, double Now)
+{
+    int32 Index = Find(Actor);
+    if (Index != INDEX_NONE)
+    {
+        return Index;
+    }
+
+    if (Count < Capacity)
+    {
+        Index = Count++;
+    }
+    else
+    {
+        // Replace the weakest (or dead) threat
+        Index = 0;
+        float WeakestScore = TNumericLimits<float>::Max();
+        for (int32 Candidate = 0; Candidate < Count; ++Candidate)
+        {
+            const float Score = Entries[Candidate].Actor.IsValid() ? Decay(Entries[Candidate], Now) : -1.0f;
+            if (Score < WeakestScore)
+            {
+                WeakestScore = Score;
+                Index = Candidate;
+            }
+        }
+    }
+
+    Entries[Index].Actor = Actor;
+    Entries[Index].Score = 0.0f;
+    Entries[Index].UpdateTime = Now;
+    return Index;
+}
+
+template<int32 Capacity>
+FORCEINLINE void TAIThreatTable<Capacity>::Set(AActor* Actor, float Score, double Now)
+{
+    if (!Actor)
+    {
+        return;
+    }
+
+    FEntry& Entry = Entries[FindOrAddSlot(Actor, Now)];
+    Entry.Score = Score;
+    Entry.UpdateTime = Now;
+}
+
+template<int32 Capacity>
+FORCEINLINE void TAIThreatTable<Capacity>::Accumulate(AActor* Actor, float Delta, double Now)
+{
+    if (!Actor)
+    {
+        return;
+    }
+
+    FEntry& Entry = Entries[FindOrAddSlot(Actor, Now)];
+    Entry.Score = Decay(Entry, Now) + Delta;
+    Entry.UpdateTime = Now;
+}
+
+template<int32 Capacity>
+FORCEINLINE float TAIThreatTable<Capacity>::Get(const AActor* Actor, double Now) const
+{
+    const int32 Index = Find(Actor);
+    return Index != INDEX_NONE ? Decay(Entries[Index], Now) : 0.0f;
+}
+
+template<int32 Capacity>
+FORCEINLINE float TAIThreatTable<Capacity>::GetTotal(double Now) const
+{
+    float Total = 0.0f;
+    for (int32 Index = 0; Index < Count; ++Index)
+    {
+        if (Entries[Index].Actor.IsValid())
+        {
+            Total += Decay(Entries[Index], Now);
+        }
+    }
+    return Total;
+}
+
+template<int32 Capacity>
+void TAIThreatTable<Capacity>::Prune(double Now)
+{
+    for (int32 Index = Count - 1; Index >= 0; --Index)
+    {
+        if (!Entries[Index].Actor.IsValid() || Decay(Entries[Index], Now) < ForgetThreshold)
+        {
+            Entries[Index] = Entries[--Count];
+        }
+    }
+}
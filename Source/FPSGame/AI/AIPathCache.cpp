@@ -0,0 +1,264 @@
+#include "AIPathCache.h"
+#include "Engine/World.h"
+#include "Engine/Engine.h"
+#include "NavigationSystem.h"
+#include "NavigationPath.h"
+#include "Math/RandomStream.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogAIPathCache, Log, All);
+
+UAIPathCache::UAIPathCache()
+{
+    CellSize = 100.0f;
+    AgentSizeBucketSize = 25.0f;
+    MaxCachedPaths = 512;
+}
+
+void UAIPathCache::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    PathCache.Empty(FMath::Max(1, MaxCachedPaths));
+
+    UE_LOG(LogAIPathCache, Log, TEXT("AI path cache initialized (%d paths)"), MaxCachedPaths);
+}
+
+void UAIPathCache::Deinitialize()
+{
+    if (UNavigationSystemV1* NavSystem = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld()))
+    {
+        NavSystem->OnNavigationGenerationFinishedDelegate.RemoveDynamic(this, &UAIPathCache::OnNavigationGenerationFinished);
+    }
+
+    PathCache.Empty();
+    PatrolLoops.Empty();
+
+    Super::Deinitialize();
+}
+
+void UAIPathCache::OnWorldBeginPlay(UWorld& InWorld)
+{
+    Super::OnWorldBeginPlay(InWorld);
+
+    // The navigation system only exists once the world is initialized for play
+    if (UNavigationSystemV1* NavSystem = FNavigationSystem::GetCurrent<UNavigationSystemV1>(&InWorld))
+    {
+        NavSystem->OnNavigationGenerationFinishedDelegate.AddUniqueDynamic(this, &UAIPathCache::OnNavigationGenerationFinished);
+    }
+}
+
+bool UAIPathCache::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+UAIPathCache* UAIPathCache::Get(const UObject* WorldContextObject)
+{
+    UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
+    return World ? World->GetSubsystem<UAIPathCache>() : nullptr;
+}
+
+bool UAIPathCache::FindPath(const FVector& Start, const FVector& Goal, float AgentRadius, TArray<FVector>& OutPoints, AActor* Querier)
+{
+    FAIPathKey Key;
+    Key.StartCell = ToCell(Start);
+    Key.GoalCell = ToCell(Goal);
+    Key.AgentSizeBucket = ToAgentSizeBucket(AgentRadius);
+
+    if (const TArray<FVector>* CachedPoints = PathCache.FindAndTouch(Key))
+    {
+        CacheHits++;
+        OutPoints = *CachedPoints;
+
+        // The cached path began somewhere in our start cell; begin it where we actually are
+        OutPoints[0] = Start;
+        return true;
+    }
+
+    CacheMisses++;
+
+    if (!QueryNavigation(Start, Goal, OutPoints, Querier))
+    {
+        return false;
+    }
+
+    if (PathCache.Num() >= PathCache.Max())
+    {
+        Evictions++;
+    }
+    PathCache.Add(Key, OutPoints);
+
+    return true;
+}
+
+FAIPatrolLoopPtr UAIPathCache::GetPatrolLoop(const TArray<FVector>& Waypoints, float AgentRadius, AActor* Querier)
+{
+    if (Waypoints.Num() < 2)
+    {
+        return FAIPatrolLoopPtr();
+    }
+
+    FAIPatrolLoopKey Key;
+    Key.AgentSizeBucket = ToAgentSizeBucket(AgentRadius);
+    Key.Cells.Reserve(Waypoints.Num());
+    for (const FVector& Waypoint : Waypoints)
+    {
+        Key.Cells.Add(ToCell(Waypoint));
+    }
+
+    if (const FAIPatrolLoopPtr* Existing = PatrolLoops.Find(Key))
+    {
+        CacheHits++;
+        return *Existing;
+    }
+
+    CacheMisses++;
+
+    // Build every leg once; all agents on this route reuse them
+    TSharedRef<FAIPatrolLoop, ESPMode::ThreadSafe> Loop = MakeShared<FAIPatrolLoop, ESPMode::ThreadSafe>();
+    Loop->Waypoints = Waypoints;
+    Loop->NavGeneration = NavGeneration;
+    Loop->Legs.SetNum(Waypoints.Num());
+
+    for (int32 Index = 0; Index < Waypoints.Num(); ++Index)
+    {
+        const FVector& From = Waypoints[Index];
+        const FVector& To = Waypoints[(Index + 1) % Waypoints.Num()];
+        if (!QueryNavigation(From, To, Loop->Legs[Index], Querier))
+        {
+            Loop->Legs[Index].Reset();
+        }
+    }
+
+    PatrolLoops.Add(Key, Loop);
+
+    UE_LOG(LogAIPathCache, Verbose, TEXT("Built patrol loop with %d waypoints"), Waypoints.Num());
+
+    return Loop;
+}
+
+FAIPatrolLoopPtr UAIPathCache::GetPatrolLoopAround(const FVector& Center, float Radius, int32 NumWaypoints, float AgentRadius, AActor* Querier)
+{
+    if (Radius <= 0.0f || NumWaypoints < 2)
+    {
+        return FAIPatrolLoopPtr();
+    }
+
+    // Snap the center to a patrol-sized cell and seed from it, so neighbours derive identical waypoints
+    const FIntVector AreaCell(
+        FMath::FloorToInt(Center.X / Radius),
+        FMath::FloorToInt(Center.Y / Radius),
+        FMath::FloorToInt(Center.Z / Radius));
+    const FVector AreaCenter(
+        (AreaCell.X + 0.5f) * Radius,
+        (AreaCell.Y + 0.5f) * Radius,
+        Center.Z);
+
+    FRandomStream Random(HashCombine(GetTypeHash(AreaCell), GetTypeHash(NumWaypoints)));
+
+    UNavigationSystemV1* NavSystem = FNavigationSystem::GetCurrent<UNavigationSystemV1>(GetWorld());
+
+    TArray<FVector> Waypoints;
+    Waypoints.Reserve(NumWaypoints);
+
+    for (int32 Index = 0; Index < NumWaypoints; ++Index)
+    {
+        const float Angle = (2.0f * PI * Index) / NumWaypoints + Random.FRandRange(-0.3f, 0.3f);
+        const float Distance = Random.FRandRange(0.4f, 1.0f) * Radius;
+        FVector Waypoint = AreaCenter + FVector(FMath::Cos(Angle) * Distance, FMath::Sin(Angle) * Distance, 0.0f);
+
+        if (NavSystem)
+        {
+            FNavLocation NavLocation;
+            if (!NavSystem->ProjectPointToNavigation(Waypoint, NavLocation, FVector(500.0f, 500.0f, 200.0f)))
+            {
+                continue;
+            }
+            Waypoint = NavLocation.Location;
+        }
+
+        Waypoints.Add(Waypoint);
+    }
+
+    return GetPatrolLoop(Waypoints, AgentRadius, Querier);
+}
+
+void UAIPathCache::Invalidate()
+{
+    PathCache.Empty(FMath::Max(1, MaxCachedPaths));
+    PatrolLoops.Empty();
+    NavGeneration++;
+    Invalidations++;
+}
+
+int64 UAIPathCache::GetAllocatedBytes() const
+{
+    int64 Bytes = 0;
+    for (TLruCache<FAIPathKey, TArray<FVector>>::TConstIterator It(PathCache); It; ++It)
+    {
+        Bytes += sizeof(FAIPathKey) + sizeof(TArray<FVector>) + It.Value().GetAllocatedSize();
+    }
+
+    for (const TPair<FAIPatrolLoopKey, FAIPatrolLoopPtr>& Pair : PatrolLoops)
+    {
+        Bytes += Pair.Key.Cells.GetAllocatedSize();
+        if (Pair.Value.IsValid())
+        {
+            Bytes += sizeof(FAIPatrolLoop) + Pair.Value->Waypoints.GetAllocatedSize() + Pair.Value->Legs.GetAllocatedSize();
+            for (const TArray<FVector>& Leg : Pair.Value->Legs)
+            {
+                Bytes += Leg.GetAllocatedSize();
+            }
+        }
+    }
+    return Bytes;
+}
+
+float UAIPathCache::GetHitRate() const
+{
+    const int64 Total = CacheHits + CacheMisses;
+    return Total > 0 ? (float)CacheHits / (float)Total : 0.0f;
+}
+
+FString UAIPathCache::GeneratePathCacheReport() const
+{
+    FString Report = TEXT("=== AI Path Cache ===\n");
+    Report += FString::Printf(TEXT("Cached Paths: %d / %d\n"), PathCache.Num(), PathCache.Max());
+    Report += FString::Printf(TEXT("Patrol Loops: %d\n"), PatrolLoops.Num());
+    Report += FString::Printf(TEXT("Hits: %lld, Misses: %lld, Hit Rate: %.1f%%\n"), CacheHits, CacheMisses, GetHitRate() * 100.0f);
+    Report += FString::Printf(TEXT("Evictions: %lld, Invalidations: %d\n"), Evictions, Invalidations);
+    return Report;
+}
+
+FIntVector UAIPathCache::ToCell(const FVector& Location) const
+{
+    return FIntVector(
+        FMath::FloorToInt(Location.X / CellSize),
+        FMath::FloorToInt(Location.Y / CellSize),
+        FMath::FloorToInt(Location.Z / CellSize));
+}
+
+int32 UAIPathCache::ToAgentSizeBucket(float AgentRadius) const
+{
+    return FMath::CeilToInt(AgentRadius / AgentSizeBucketSize);
+}
+
+bool UAIPathCache::QueryNavigation(const FVector& Start, const FVector& Goal, TArray<FVector>& OutPoints, AActor* Querier) const
+{
+    UNavigationPath* NavPath = UNavigationSystemV1::FindPathToLocationSynchronously(GetWorld(), Start, Goal, Querier);
+
+    // Partial paths depend on where the search gave up, so they are not worth sharing
+    if (!NavPath || !NavPath->IsValid() || NavPath->IsPartial() || NavPath->PathPoints.Num() < 2)
+    {
+        return false;
+    }
+
+    OutPoints = NavPath->PathPoints;
+    return true;
+}
+
+void UAIPathCache::OnNavigationGenerationFinished(ANavigationData* NavData)
+{
+    UE_LOG(LogAIPathCache, Log, TEXT("Navigation rebuilt, dropping %d cached paths and %d patrol loops"), PathCache.Num(), PatrolLoops.Num());
+    Invalidate();
+}
@@ -0,0 +1,150 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Containers/LruCache.h"
+#include "Templates/SharedPointer.h"
+#include "AIPathCache.generated.h"
+
+class ANavigationData;
+
+/**
+ * Cache key: start and goal quantized to cells, plus a bucketed agent radius
+ */
+struct FAIPathKey
+{
+    FIntVector StartCell = FIntVector::ZeroValue;
+    FIntVector GoalCell = FIntVector::ZeroValue;
+    int32 AgentSizeBucket = 0;
+
+    bool operator==(const FAIPathKey& Other) const
+    {
+        return StartCell == Other.StartCell && GoalCell == Other.GoalCell && AgentSizeBucket == Other.AgentSizeBucket;
+    }
+
+    friend uint32 GetTypeHash(const FAIPathKey& Key)
+    {
+        return HashCombine(HashCombine(GetTypeHash(Key.StartCell), GetTypeHash(Key.GoalCell)), GetTypeHash(Key.AgentSizeBucket));
+    }
+};
+
+/**
+ * Precomputed closed patrol route shared by every agent walking the same waypoints
+ */
+struct FPSGAME_API FAIPatrolLoop
+{
+    TArray<FVector> Waypoints;
+
+    // Legs[i] runs from Waypoints[i] to Waypoints[(i + 1) % Num]; empty if no path was found
+    TArray<TArray<FVector>> Legs;
+
+    uint32 NavGeneration = 0;
+};
+
+typedef TSharedPtr<const FAIPatrolLoop, ESPMode::ThreadSafe> FAIPatrolLoopPtr;
+
+/**
+ * World-wide navigation path cache.
+ * Paths are keyed by (start cell, goal cell, agent size) with LRU eviction, patrol loops are
+ * built once per route and shared, and everything is dropped when the navmesh is rebuilt.
+ */
+UCLASS()
+class FPSGAME_API UAIPathCache : public UWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    UAIPathCache();
+
+    // USubsystem interface
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+    virtual void OnWorldBeginPlay(UWorld& InWorld) override;
+
+    static UAIPathCache* Get(const UObject* WorldContextObject);
+
+    // Returns path points from Start towards Goal, querying the navmesh only on a cache miss
+    bool FindPath(const FVector& Start, const FVector& Goal, float AgentRadius, TArray<FVector>& OutPoints, AActor* Querier = nullptr);
+
+    // Shared loop through the given waypoints
+    FAIPatrolLoopPtr GetPatrolLoop(const TArray<FVector>& Waypoints, float AgentRadius, AActor* Querier = nullptr);
+
+    // Shared loop of navigable waypoints around an area; agents starting in the same area get the same loop
+    FAIPatrolLoopPtr GetPatrolLoopAround(const FVector& Center, float Radius, int32 NumWaypoints, float AgentRadius, AActor* Querier = nullptr);
+
+    bool IsLoopCurrent(const FAIPatrolLoop& Loop) const { return Loop.NavGeneration == NavGeneration; }
+
+    // Drops all cached paths and loops
+    UFUNCTION(BlueprintCallable, Category = "AI|Pathfinding")
+    void Invalidate();
+
+    UFUNCTION(BlueprintCallable, Category = "AI|Pathfinding")
+    int32 GetCachedPathCount() const { return PathCache.Num(); }
+
+    UFUNCTION(BlueprintCallable, Category = "AI|Pathfinding")
+    int32 GetPatrolLoopCount() const { return PatrolLoops.Num(); }
+
+    UFUNCTION(BlueprintCallable, Category = "AI|Pathfinding")
+    float GetHitRate() const;
+
+    // Approximate heap held by cached paths and loops
+    int64 GetAllocatedBytes() const;
+
+    UFUNCTION(BlueprintCallable, Category = "AI|Pathfinding")
+    FString GeneratePathCacheReport() const;
+
+    // Start/goal quantization; paths within the same pair of cells are reused
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI|Pathfinding")
+    float CellSize = 100.0f;
+
+    // Agent radii are grouped into buckets of this size
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI|Pathfinding")
+    float AgentSizeBucketSize = 25.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI|Pathfinding")
+    int32 MaxCachedPaths = 512;
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    struct FAIPatrolLoopKey
+    {
+        TArray<FIntVector> Cells;
+        int32 AgentSizeBucket = 0;
+
+        bool operator==(const FAIPatrolLoopKey& Other) const
+        {
+            return AgentSizeBucket == Other.AgentSizeBucket && Cells == Other.Cells;
+        }
+
+        friend uint32 GetTypeHash(const FAIPatrolLoopKey& Key)
+        {
+            uint32 Hash = GetTypeHash(Key.AgentSizeBucket);
+            for (const FIntVector& Cell : Key.Cells)
+            {
+                Hash = HashCombine(Hash, GetTypeHash(Cell));
+            }
+            return Hash;
+        }
+    };
+
+    TLruCache<FAIPathKey, TArray<FVector>> PathCache;
+    TMap<FAIPatrolLoopKey, FAIPatrolLoopPtr> PatrolLoops;
+
+    // Bumped on every nav rebuild so held loops can detect they are stale
+    uint32 NavGeneration = 0;
+
+    // Statistics
+    int64 CacheHits = 0;
+    int64 CacheMisses = 0;
+    int64 Evictions = 0;
+    int32 Invalidations = 0;
+
+    FIntVector ToCell(const FVector& Location) const;
+    int32 ToAgentSizeBucket(float AgentRadius) const;
+    bool QueryNavigation(const FVector& Start, const FVector& Goal, TArray<FVector>& OutPoints, AActor* Querier) const;
+
+    UFUNCTION()
+    void OnNavigationGenerationFinished(ANavigationData* NavData);
+};
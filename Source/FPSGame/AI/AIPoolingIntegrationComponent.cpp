@@ -25,7 +25,12 @@ void UAIPoolingIntegrationComponent::BeginPlay()
 
 void UAIPoolingIntegrationComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-    CleanupPooledObjects();
+    // Effects still playing are returned by the tracker sweep once they finish; projectiles fly on
+    if (PooledObjects.IsValid())
+    {
+        PooledObjects->UnregisterOwner(PooledObjectOwner);
+    }
+    PooledObjectOwner = INDEX_NONE;
     
     Super::EndPlay(EndPlayReason);
 }
@@ -34,11 +39,8 @@ void UAIPoolingIntegrationComponent::TickComponent(float DeltaTime, ELevelTick T
 {
     Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
     
-    // Update pooling statistics
+    // Update pooling statistics; finished objects are swept by the tracker subsystem
     UpdatePoolingStatistics();
-    
-    // Clean up any finished pooled objects
-    CleanupPooledObjects();
 }
 
 void UAIPoolingIntegrationComponent::InitializePoolingIntegration()
@@ -60,6 +62,21 @@ void UAIPoolingIntegrationComponent::InitializePoolingIntegration()
         return;
     }
     
+    // One sweep and one budget for every AI instead of a sweep per character; without the tracker
+    // nothing would return finished effects and audio, so the AI does not pool at all
+    PooledObjects = UPooledObjectTrackerSubsystem::Get(this);
+    if (!PooledObjects.IsValid())
+    {
+        UE_LOG(LogAIPoolingIntegration, Error, TEXT("Failed to get Pooled Object Tracker"));
+        ObjectPoolManager = nullptr;
+        return;
+    }
+    
+    if (PooledObjectOwner == INDEX_NONE)
+    {
+        PooledObjectOwner = PooledObjects->RegisterOwner();
+    }
+    
     // Get AI system component
     AISystem = GetOwner()->FindComponentByClass<UAdvancedAISystem>();
     if (!AISystem)
@@ -72,7 +89,7 @@ void UAIPoolingIntegrationComponent::InitializePoolingIntegration()
 
 AActor* UAIPoolingIntegrationComponent::SpawnPooledProjectile(TSubclassOf<AActor> ProjectileClass, const FVector& Location, const FRotator& Rotation)
 {
-    if (!ObjectPoolManager || !ProjectileClass)
+    if (!ObjectPoolManager || !ProjectileClass || !HasPooledObjectBudget(EPooledObjectKind::Projectile))
     {
         return nullptr;
     }
@@ -87,7 +104,10 @@ AActor* UAIPoolingIntegrationComponent::SpawnPooledProjectile(TSubclassOf<AActor
         Projectile->SetActorRotation(Rotation);
         
         // Track the projectile
-        ActivePooledProjectiles.AddUnique(Projectile);
+        if (PooledObjects.IsValid())
+        {
+            PooledObjects->Track(Projectile, EPooledObjectKind::Projectile, PooledObjectOwner);
+        }
         
         UE_LOG(LogAIPoolingIntegration, Verbose, TEXT("Spawned pooled projectile: %s"), 
                *Projectile->GetClass()->GetName());
@@ -107,19 +127,23 @@ void UAIPoolingIntegrationComponent::ReturnPooledProjectile(AActor* Projectile)
         return;
     }
     
-    // Remove from tracking
-    ActivePooledProjectiles.Remove(Projectile);
-    
-    // Return to pool
-    ObjectPoolManager->ReleaseActor(Projectile);
-    
     UE_LOG(LogAIPoolingIntegration, Verbose, TEXT("Returned projectile to pool: %s"), 
            *Projectile->GetClass()->GetName());
+    
+    // Return to pool
+    if (PooledObjects.IsValid())
+    {
+        PooledObjects->Release(Projectile, EPooledObjectKind::Projectile);
+    }
+    else
+    {
+        ObjectPoolManager->ReleaseActor(Projectile);
+    }
 }
 
 UObject* UAIPoolingIntegrationComponent::SpawnPooledEffect(TSubclassOf<UObject> EffectClass, const FVector& Location)
 {
-    if (!ObjectPoolManager || !EffectClass)
+    if (!ObjectPoolManager || !EffectClass || !HasPooledObjectBudget(EPooledObjectKind::Effect))
     {
         return nullptr;
     }
@@ -137,7 +161,10 @@ UObject* UAIPoolingIntegrationComponent::SpawnPooledEffect(TSubclassOf<UObject>
         }
         
         // Track the effect
-        ActivePooledEffects.AddUnique(Effect);
+        if (PooledObjects.IsValid())
+        {
+            PooledObjects->Track(Effect, EPooledObjectKind::Effect, PooledObjectOwner);
+        }
         
         UE_LOG(LogAIPoolingIntegration, Verbose, TEXT("Spawned pooled effect: %s"), 
                *Effect->GetClass()->GetName());
@@ -157,25 +184,26 @@ void UAIPoolingIntegrationComponent::ReturnPooledEffect(UObject* Effect)
         return;
     }
     
-    // Deactivate if it's a particle system
+    UE_LOG(LogAIPoolingIntegration, Verbose, TEXT("Returned effect to pool: %s"), 
+           *Effect->GetClass()->GetName());
+    
+    // Deactivates particle systems and returns the effect to its pool
+    if (PooledObjects.IsValid())
+    {
+        PooledObjects->Release(Effect, EPooledObjectKind::Effect);
+        return;
+    }
+    
     if (UParticleSystemComponent* ParticleComp = Cast<UParticleSystemComponent>(Effect))
     {
         ParticleComp->Deactivate();
     }
-    
-    // Remove from tracking
-    ActivePooledEffects.Remove(Effect);
-    
-    // Return to pool
     ObjectPoolManager->ReleaseObject(Effect);
-    
-    UE_LOG(LogAIPoolingIntegration, Verbose, TEXT("Returned effect to pool: %s"), 
-           *Effect->GetClass()->GetName());
 }
 
 UActorComponent* UAIPoolingIntegrationComponent::SpawnPooledAudioComponent(TSubclassOf<UActorComponent> AudioClass)
 {
-    if (!ObjectPoolManager || !AudioClass)
+    if (!ObjectPoolManager || !AudioClass || !HasPooledObjectBudget(EPooledObjectKind::Audio))
     {
         return nullptr;
     }
@@ -185,8 +213,11 @@ UActorComponent* UAIPoolingIntegrationComponent::SpawnPooledAudioComponent(TSubc
     
     if (AudioComponent)
     {
-        // Track the audio component
-        ActivePooledAudioComponents.AddUnique(AudioComponent);
+        // Track the audio component; it came from a component pool
+        if (PooledObjects.IsValid())
+        {
+            PooledObjects->Track(AudioComponent, EPooledObjectKind::Audio, PooledObjectOwner, true);
+        }
         
         UE_LOG(LogAIPoolingIntegration, Verbose, TEXT("Spawned pooled audio component: %s"), 
                *AudioComponent->GetClass()->GetName());
@@ -206,20 +237,21 @@ void UAIPoolingIntegrationComponent::ReturnPooledAudioComponent(UActorComponent*
         return;
     }
     
-    // Stop audio if it's playing
+    UE_LOG(LogAIPoolingIntegration, Verbose, TEXT("Returned audio component to pool: %s"), 
+           *AudioComponent->GetClass()->GetName());
+    
+    // Stops the audio and returns the component to its pool
+    if (PooledObjects.IsValid())
+    {
+        PooledObjects->Release(AudioComponent, EPooledObjectKind::Audio, true);
+        return;
+    }
+    
     if (UAudioComponent* Audio = Cast<UAudioComponent>(AudioComponent))
     {
         Audio->Stop();
     }
-    
-    // Remove from tracking
-    ActivePooledAudioComponents.Remove(AudioComponent);
-    
-    // Return to pool
     ObjectPoolManager->ReleaseComponent(AudioComponent);
-    
-    UE_LOG(LogAIPoolingIntegration, Verbose, TEXT("Returned audio component to pool: %s"), 
-           *AudioComponent->GetClass()->GetName());
 }
 
 void UAIPoolingIntegrationComponent::OptimizeAIForPooling()
@@ -231,9 +263,6 @@ void UAIPoolingIntegrationComponent::OptimizeAIForPooling()
     
     UE_LOG(LogAIPoolingIntegration, Log, TEXT("Optimizing AI for object pooling..."));
     
-    // Clean up any unused pooled objects
-    CleanupPooledObjects();
-    
     // Optimize memory usage by cleaning up pools
     if (ObjectPoolManager)
     {
@@ -248,9 +277,9 @@ FString UAIPoolingIntegrationComponent::GetPoolingPerformanceReport() const
     FString Report;
     
     Report += TEXT("=== AI Pooling Integration Performance Report ===\n");
-    Report += FString::Printf(TEXT("Active Pooled Projectiles: %d\n"), ActivePooledProjectiles.Num());
-    Report += FString::Printf(TEXT("Active Pooled Effects: %d\n"), ActivePooledEffects.Num());
-    Report += FString::Printf(TEXT("Active Pooled Audio Components: %d\n"), ActivePooledAudioComponents.Num());
+    Report += FString::Printf(TEXT("Active Pooled Projectiles: %d\n"), GetActiveCount(EPooledObjectKind::Projectile));
+    Report += FString::Printf(TEXT("Active Pooled Effects: %d\n"), GetActiveCount(EPooledObjectKind::Effect));
+    Report += FString::Printf(TEXT("Active Pooled Audio Components: %d\n"), GetActiveCount(EPooledObjectKind::Audio));
     
     if (ObjectPoolManager)
     {
@@ -272,63 +301,6 @@ FString UAIPoolingIntegrationComponent::GetPoolingPerformanceReport() const
     return Report;
 }
 
-void UAIPoolingIntegrationComponent::CleanupPooledObjects()
-{
-    // Clean up finished projectiles
-    for (int32 i = ActivePooledProjectiles.Num() - 1; i >= 0; --i)
-    {
-        AActor* Projectile = ActivePooledProjectiles[i];
-        if (!IsValid(Projectile) || Projectile->IsActorBeingDestroyed())
-        {
-            ActivePooledProjectiles.RemoveAt(i);
-        }
-        // Additional logic could check if projectile has finished its purpose
-        // For example, if it has hit something or traveled maximum distance
-    }
-    
-    // Clean up finished effects
-    for (int32 i = ActivePooledEffects.Num() - 1; i >= 0; --i)
-    {
-        UObject* Effect = ActivePooledEffects[i];
-        if (!IsValid(Effect))
-        {
-            ActivePooledEffects.RemoveAt(i);
-            continue;
-        }
-        
-        // Check if particle system has finished
-        if (UParticleSystemComponent* ParticleComp = Cast<UParticleSystemComponent>(Effect))
-        {
-            if (!ParticleComp->IsActive())
-            {
-                ReturnPooledEffect(Effect);
-                i--; // Adjust index since ReturnPooledEffect removes from array
-            }
-        }
-    }
-    
-    // Clean up finished audio components
-    for (int32 i = ActivePooledAudioComponents.Num() - 1; i >= 0; --i)
-    {
-        UActorComponent* AudioComponent = ActivePooledAudioComponents[i];
-        if (!IsValid(AudioComponent))
-        {
-            ActivePooledAudioComponents.RemoveAt(i);
-            continue;
-        }
-        
-        // Check if audio has finished playing
-        if (UAudioComponent* Audio = Cast<UAudioComponent>(AudioComponent))
-        {
-            if (!Audio->IsPlaying())
-            {
-                ReturnPooledAudioComponent(AudioComponent);
-                i--; // Adjust index since ReturnPooledAudioComponent removes from array
-            }
-        }
-    }
-}
-
 void UAIPoolingIntegrationComponent::UpdatePoolingStatistics()
 {
     if (!ObjectPoolManager)
@@ -361,3 +333,18 @@ void UAIPoolingIntegrationComponent::UpdatePoolingStatistics()
         }
     }
 }
+
+bool UAIPoolingIntegrationComponent::HasPooledObjectBudget(EPooledObjectKind Kind) const
+{
+    if (PooledObjects.IsValid() && !PooledObjects->HasBudget(Kind))
+    {
+        UE_LOG(LogAIPoolingIntegration, Verbose, TEXT("Global pooled object budget reached for %s"), *UEnum::GetValueAsString(Kind));
+        return false;
+    }
+    return true;
+}
+
+int32 UAIPoolingIntegrationComponent::GetActiveCount(EPooledObjectKind Kind) const
+{
+    return PooledObjects.IsValid() ? PooledObjects->GetOwnerActiveCount(PooledObjectOwner, Kind) : 0;
+}
@@ -4,6 +4,7 @@
 #include "Components/ActorComponent.h"
 #include "Engine/World.h"
 #include "../Optimization/AdvancedObjectPoolManager.h"
+#include "../Optimization/PooledObjectTracker.h"
 #include "AdvancedAISystem.h"
 #include "AIPoolingIntegrationComponent.generated.h"
 
@@ -66,17 +67,12 @@ protected:
     UPROPERTY()
     class UAdvancedAISystem* AISystem;
 
-    // Tracking
-    UPROPERTY()
-    TArray<AActor*> ActivePooledProjectiles;
-
-    UPROPERTY()
-    TArray<UObject*> ActivePooledEffects;
-
-    UPROPERTY()
-    TArray<UActorComponent*> ActivePooledAudioComponents;
+    // Tracking is shared with every other AI and weapon through the world's tracker
+    TWeakObjectPtr<UPooledObjectTrackerSubsystem> PooledObjects;
+    int32 PooledObjectOwner = INDEX_NONE;
 
 private:
-    void CleanupPooledObjects();
     void UpdatePoolingStatistics();
+    bool HasPooledObjectBudget(EPooledObjectKind Kind) const;
+    int32 GetActiveCount(EPooledObjectKind Kind) const;
 };
@@ -0,0 +1,438 @@
+#include "AISquadBlackboard.h"
+#include "Engine/World.h"
+#include "Engine/Engine.h"
+#include "CollisionQueryParams.h"
+#include "../Weapons/AdvancedWeaponSystem.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogAISquadBlackboard, Log, All);
+
+int64 FAIPerceptionStats::LineOfSightTraces = 0;
+int64 FAIPerceptionStats::SharedVisibilityHits = 0;
+
+// FAISquadSnapshot
+
+const FAISquadThreat* FAISquadSnapshot::FindThreat(const AActor* Actor) const
+{
+    for (const FAISquadThreat& Threat : Threats)
+    {
+        if (Threat.Actor.Get() == Actor)
+        {
+            return &Threat;
+        }
+    }
+    return nullptr;
+}
+
+bool FAISquadSnapshot::HasFreshTargetSighting(double Now, double MaxAge) const
+{
+    return Target.IsValid() && LastTargetSeenTime >= 0.0 && (Now - LastTargetSeenTime) <= MaxAge;
+}
+
+// UAISquadBlackboard
+
+UAISquadBlackboard::UAISquadBlackboard()
+{
+    RefreshInterval = 0.2f;
+    AutoSquadCellSize = 3000.0f;
+    MaxInterestPoints = 8;
+}
+
+void UAISquadBlackboard::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    TraceWindowStart = 0.0;
+    TraceCountAtWindowStart = FAIPerceptionStats::LineOfSightTraces;
+
+    UE_LOG(LogAISquadBlackboard, Log, TEXT("AI squad blackboard initialized"));
+}
+
+void UAISquadBlackboard::Deinitialize()
+{
+    Squads.Empty();
+    MemberToSquad.Empty();
+
+    Super::Deinitialize();
+}
+
+bool UAISquadBlackboard::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+TStatId UAISquadBlackboard::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UAISquadBlackboard, STATGROUP_Tickables);
+}
+
+UAISquadBlackboard* UAISquadBlackboard::Get(const UObject* WorldContextObject)
+{
+    UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
+    return World ? World->GetSubsystem<UAISquadBlackboard>() : nullptr;
+}
+
+void UAISquadBlackboard::Tick(float DeltaTime)
+{
+    UWorld* World = GetWorld();
+    if (!World)
+    {
+        return;
+    }
+
+    const double Now = World->GetTimeSeconds();
+    bool bPrunedMembers = false;
+
+    for (auto It = Squads.CreateIterator(); It; ++It)
+    {
+        FAISquad& Squad = It.Value();
+        if (Now < Squad.NextRefreshTime)
+        {
+            continue;
+        }
+
+        const int32 MembersBefore = Squad.Members.Num();
+        RefreshSquad(Squad, Now);
+        Squad.NextRefreshTime = Now + RefreshInterval;
+
+        bPrunedMembers |= Squad.Members.Num() != MembersBefore;
+        if (Squad.Members.Num() == 0)
+        {
+            It.RemoveCurrent();
+        }
+    }
+
+    // Members destroyed without unregistering leave stale keys behind
+    if (bPrunedMembers)
+    {
+        for (auto It = MemberToSquad.CreateIterator(); It; ++It)
+        {
+            if (!It.Key().IsValid())
+            {
+                It.RemoveCurrent();
+            }
+        }
+    }
+
+    UpdateTraceRate(Now);
+}
+
+FName UAISquadBlackboard::RegisterMember(AActor* Member, FName SquadId)
+{
+    if (!Member || !GetWorld())
+    {
+        return NAME_None;
+    }
+
+    if (const FName* ExistingSquad = MemberToSquad.Find(Member))
+    {
+        return *ExistingSquad;
+    }
+
+    // Members without an explicit squad are grouped by the cell they start in
+    if (SquadId.IsNone())
+    {
+        const FVector Location = Member->GetActorLocation();
+        const int32 CellX = FMath::FloorToInt(Location.X / AutoSquadCellSize);
+        const int32 CellY = FMath::FloorToInt(Location.Y / AutoSquadCellSize);
+        SquadId = FName(*FString::Printf(TEXT("AutoSquad_%d_%d"), CellX, CellY));
+    }
+
+    FAISquad* Squad = Squads.Find(SquadId);
+    if (!Squad)
+    {
+        Squad = &Squads.Add(SquadId);
+
+        // Stagger refreshes so squads don't all trace on the same frame
+        Squad->NextRefreshTime = GetWorld()->GetTimeSeconds() + FMath::FRandRange(0.0f, RefreshInterval);
+    }
+
+    Squad->Members.Add(Member);
+    MemberToSquad.Add(Member, SquadId);
+
+    return SquadId;
+}
+
+void UAISquadBlackboard::UnregisterMember(AActor* Member)
+{
+    FName SquadId;
+    if (!MemberToSquad.RemoveAndCopyValue(Member, SquadId))
+    {
+        return;
+    }
+
+    if (FAISquad* Squad = Squads.Find(SquadId))
+    {
+        Squad->Members.RemoveSingleSwap(Member, false);
+        if (Squad->Members.Num() == 0)
+        {
+            Squads.Remove(SquadId);
+        }
+    }
+}
+
+void UAISquadBlackboard::ReportSighting(AActor* Reporter, AActor* Target, const FVector& Location)
+{
+    FAISquad* Squad = FindSquad(Reporter);
+    if (!Squad || !Target)
+    {
+        return;
+    }
+
+    Squad->SightedTarget = Target;
+    Squad->SightedLocation = Location;
+    Squad->SightedTime = GetWorld()->GetTimeSeconds();
+    Squad->PerceivedActors.AddUnique(Target);
+}
+
+void UAISquadBlackboard::ReportPerceivedActor(AActor* Reporter, AActor* PerceivedActor)
+{
+    FAISquad* Squad = FindSquad(Reporter);
+    if (Squad && PerceivedActor && PerceivedActor != Reporter)
+    {
+        Squad->PerceivedActors.AddUnique(PerceivedActor);
+    }
+}
+
+void UAISquadBlackboard::ReportInterestPoint(AActor* Reporter, const FVector& Location)
+{
+    FAISquad* Squad = FindSquad(Reporter);
+    if (!Squad)
+    {
+        return;
+    }
+
+    // Several members hearing the same noise should produce one point
+    for (const FVector& Existing : Squad->PendingInterestPoints)
+    {
+        if (FVector::DistSquared(Existing, Location) < FMath::Square(100.0f))
+        {
+            return;
+        }
+    }
+
+    Squad->PendingInterestPoints.Add(Location);
+}
+
+FAISquadSnapshotPtr UAISquadBlackboard::GetSnapshot(const AActor* Member) const
+{
+    const FAISquad* Squad = FindSquad(Member);
+    return Squad ? Squad->Snapshot : FAISquadSnapshotPtr();
+}
+
+FName UAISquadBlackboard::GetSquadId(const AActor* Member) const
+{
+    const FName* SquadId = MemberToSquad.Find(Member);
+    return SquadId ? *SquadId : NAME_None;
+}
+
+int32 UAISquadBlackboard::GetSquadSize(const AActor* Member) const
+{
+    const FAISquad* Squad = FindSquad(Member);
+    return Squad ? Squad->Members.Num() : 0;
+}
+
+UAISquadBlackboard::FAISquad* UAISquadBlackboard::FindSquad(const AActor* Member)
+{
+    const FName* SquadId = MemberToSquad.Find(Member);
+    return SquadId ? Squads.Find(*SquadId) : nullptr;
+}
+
+const UAISquadBlackboard::FAISquad* UAISquadBlackboard::FindSquad(const AActor* Member) const
+{
+    const FName* SquadId = MemberToSquad.Find(Member);
+    return SquadId ? Squads.Find(*SquadId) : nullptr;
+}
+
+void UAISquadBlackboard::RefreshSquad(FAISquad& Squad, double Now)
+{
+    Squad.Members.RemoveAllSwap([](const TWeakObjectPtr<AActor>& Member) { return !Member.IsValid(); });
+    if (Squad.Members.Num() == 0)
+    {
+        return;
+    }
+
+    const bool bHasReports = Squad.SightedTime >= 0.0 || Squad.PerceivedActors.Num() > 0 || Squad.PendingInterestPoints.Num() > 0;
+    const bool bHasKnowledge = Squad.Snapshot.IsValid() && (Squad.Snapshot->Target.IsValid() || Squad.Snapshot->Threats.Num() > 0);
+
+    // Quiet squads keep their current snapshot and cost nothing
+    if (!bHasReports && !bHasKnowledge)
+    {
+        return;
+    }
+
+    // Copy on write: readers holding the previous snapshot are unaffected
+    TSharedRef<FAISquadSnapshot, ESPMode::ThreadSafe> NewSnapshot = Squad.Snapshot.IsValid()
+        ? MakeShared<FAISquadSnapshot, ESPMode::ThreadSafe>(*Squad.Snapshot)
+        : MakeShared<FAISquadSnapshot, ESPMode::ThreadSafe>();
+
+    NewSnapshot->Version++;
+    NewSnapshot->BuildTime = Now;
+
+    FVector Centroid = FVector::ZeroVector;
+    for (const TWeakObjectPtr<AActor>& Member : Squad.Members)
+    {
+        Centroid += Member->GetActorLocation();
+    }
+    Centroid /= Squad.Members.Num();
+
+    // Merge the freshest sighting
+    if (Squad.SightedTarget.IsValid() && Squad.SightedTime > NewSnapshot->LastTargetSeenTime)
+    {
+        NewSnapshot->Target = Squad.SightedTarget;
+        NewSnapshot->LastKnownTargetLocation = Squad.SightedLocation;
+        NewSnapshot->LastTargetSeenTime = Squad.SightedTime;
+    }
+
+    // One visibility trace for the whole squad, from the member closest to the target
+    AActor* Target = NewSnapshot->Target.Get();
+    NewSnapshot->bTargetVisible = false;
+    if (Target)
+    {
+        if (TraceVisibility(FindClosestMember(Squad, Target->GetActorLocation()), Target))
+        {
+            NewSnapshot->bTargetVisible = true;
+            NewSnapshot->LastKnownTargetLocation = Target->GetActorLocation();
+            NewSnapshot->LastTargetSeenTime = Now;
+        }
+    }
+
+    // Threats not perceived since the last refresh decay; perceived ones are re-evaluated once
+    TArray<FAISquadThreat>& Threats = NewSnapshot->Threats;
+    for (int32 Index = Threats.Num() - 1; Index >= 0; --Index)
+    {
+        FAISquadThreat& Threat = Threats[Index];
+        if (!Threat.Actor.IsValid())
+        {
+            Threats.RemoveAtSwap(Index, 1, false);
+        }
+        else if (!Squad.PerceivedActors.Contains(Threat.Actor))
+        {
+            Threat.ThreatLevel *= 0.9f;
+            Threat.bVisible = false;
+            if (Threat.ThreatLevel < 0.1f)
+            {
+                Threats.RemoveAtSwap(Index, 1, false);
+            }
+        }
+    }
+
+    for (const TWeakObjectPtr<AActor>& PerceivedActor : Squad.PerceivedActors)
+    {
+        AActor* Actor = PerceivedActor.Get();
+        if (!Actor)
+        {
+            continue;
+        }
+
+        const bool bVisible = (Actor == Target)
+            ? NewSnapshot->bTargetVisible
+            : TraceVisibility(FindClosestMember(Squad, Actor->GetActorLocation()), Actor);
+
+        FAISquadThreat* Threat = Threats.FindByPredicate([Actor](const FAISquadThreat& Entry) { return Entry.Actor.Get() == Actor; });
+        if (!Threat)
+        {
+            Threat = &Threats.AddDefaulted_GetRef();
+            Threat->Actor = Actor;
+        }
+
+        Threat->Location = Actor->GetActorLocation();
+        Threat->bVisible = bVisible;
+        Threat->ThreatLevel = EvaluateThreat(Actor, Centroid, bVisible);
+    }
+
+    // Keep only the most recent interest points
+    NewSnapshot->InterestPoints.Append(Squad.PendingInterestPoints);
+    if (NewSnapshot->InterestPoints.Num() > MaxInterestPoints)
+    {
+        NewSnapshot->InterestPoints.RemoveAt(0, NewSnapshot->InterestPoints.Num() - MaxInterestPoints);
+    }
+
+    Squad.SightedTarget.Reset();
+    Squad.SightedTime = -1.0;
+    Squad.PerceivedActors.Reset();
+    Squad.PendingInterestPoints.Reset();
+
+    Squad.Snapshot = NewSnapshot;
+}
+
+AActor* UAISquadBlackboard::FindClosestMember(const FAISquad& Squad, const FVector& Location) const
+{
+    AActor* Closest = nullptr;
+    float ClosestDistSq = TNumericLimits<float>::Max();
+
+    for (const TWeakObjectPtr<AActor>& Member : Squad.Members)
+    {
+        if (AActor* MemberActor = Member.Get())
+        {
+            const float DistSq = FVector::DistSquared(MemberActor->GetActorLocation(), Location);
+            if (DistSq < ClosestDistSq)
+            {
+                ClosestDistSq = DistSq;
+                Closest = MemberActor;
+            }
+        }
+    }
+
+    return Closest;
+}
+
+bool UAISquadBlackboard::TraceVisibility(AActor* Observer, AActor* Target) const
+{
+    if (!Observer || !Target)
+    {
+        return false;
+    }
+
+    FAIPerceptionStats::LineOfSightTraces++;
+
+    FHitResult HitResult;
+    FCollisionQueryParams Params(SCENE_QUERY_STAT(SquadVisibility), false, Observer);
+
+    const bool bHit = GetWorld()->LineTraceSingleByChannel(
+        HitResult,
+        Observer->GetActorLocation() + FVector(0, 0, 50), // Eye level
+        Target->GetActorLocation() + FVector(0, 0, 50),
+        ECC_Visibility,
+        Params
+    );
+
+    return !bHit || HitResult.GetActor() == Target;
+}
+
+float UAISquadBlackboard::EvaluateThreat(AActor* Actor, const FVector& SquadCentroid, bool bVisible) const
+{
+    float ThreatLevel = 1.0f;
+
+    // Armed targets are more dangerous
+    if (Actor->FindComponentByClass<UAdvancedWeaponSystem>())
+    {
+        ThreatLevel += 2.0f;
+    }
+
+    // Distance factor
+    const float Distance = FVector::Dist(SquadCentroid, Actor->GetActorLocation());
+    ThreatLevel += FMath::Max(0.0f, 3.0f - (Distance / 1000.0f));
+
+    // Line of sight factor
+    if (bVisible)
+    {
+        ThreatLevel += 1.0f;
+    }
+
+    return FMath::Clamp(ThreatLevel, 0.0f, 10.0f);
+}
+
+void UAISquadBlackboard::UpdateTraceRate(double Now)
+{
+    const double Elapsed = Now - TraceWindowStart;
+    if (Elapsed < 1.0)
+    {
+        return;
+    }
+
+    const int64 Traces = FAIPerceptionStats::LineOfSightTraces - TraceCountAtWindowStart;
+    TracesPerAgentPerSecond = (float)(Traces / Elapsed) / FMath::Max(1, MemberToSquad.Num());
+
+    TraceWindowStart = Now;
+    TraceCountAtWindowStart = FAIPerceptionStats::LineOfSightTraces;
+}
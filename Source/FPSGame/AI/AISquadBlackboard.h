@@ -0,0 +1,149 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "Templates/SharedPointer.h"
+#include "AISquadBlackboard.generated.h"
+
+/**
+ * Threat entry shared by every member of a squad
+ */
+struct FAISquadThreat
+{
+    TWeakObjectPtr<AActor> Actor;
+    FVector Location = FVector::ZeroVector;
+    float ThreatLevel = 0.0f;
+    bool bVisible = false;
+};
+
+/**
+ * Immutable view of a squad's shared knowledge.
+ * A new snapshot is published on each refresh, so readers may hold one across threads.
+ */
+struct FPSGAME_API FAISquadSnapshot
+{
+    uint32 Version = 0;
+    double BuildTime = 0.0;
+
+    TWeakObjectPtr<AActor> Target;
+    FVector LastKnownTargetLocation = FVector::ZeroVector;
+    double LastTargetSeenTime = -1.0;
+    bool bTargetVisible = false;
+
+    TArray<FAISquadThreat> Threats;
+    TArray<FVector> InterestPoints;
+
+    const FAISquadThreat* FindThreat(const AActor* Actor) const;
+    bool HasFreshTargetSighting(double Now, double MaxAge) const;
+};
+
+typedef TSharedPtr<const FAISquadSnapshot, ESPMode::ThreadSafe> FAISquadSnapshotPtr;
+
+/**
+ * Line-of-sight trace counters shared by the AI systems
+ */
+struct FPSGAME_API FAIPerceptionStats
+{
+    static int64 LineOfSightTraces;
+    static int64 SharedVisibilityHits;
+
+    static void Reset()
+    {
+        LineOfSightTraces = 0;
+        SharedVisibilityHits = 0;
+    }
+};
+
+/**
+ * Squad-level blackboard.
+ * Members report sightings, perceived actors and noises; once per refresh each squad merges
+ * those reports, evaluates visibility and threat with one trace per fact, and publishes a
+ * copy-on-write snapshot that all members read instead of re-querying the world.
+ */
+UCLASS()
+class FPSGAME_API UAISquadBlackboard : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    UAISquadBlackboard();
+
+    // USubsystem interface
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    // FTickableGameObject interface
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    static UAISquadBlackboard* Get(const UObject* WorldContextObject);
+
+    // Membership; a None squad id groups members by area. Returns the squad actually joined
+    FName RegisterMember(AActor* Member, FName SquadId = NAME_None);
+    void UnregisterMember(AActor* Member);
+
+    // Reports from members, merged on the next refresh
+    void ReportSighting(AActor* Reporter, AActor* Target, const FVector& Location);
+    void ReportPerceivedActor(AActor* Reporter, AActor* PerceivedActor);
+    void ReportInterestPoint(AActor* Reporter, const FVector& Location);
+
+    FAISquadSnapshotPtr GetSnapshot(const AActor* Member) const;
+
+    UFUNCTION(BlueprintCallable, Category = "AI|Squad")
+    FName GetSquadId(const AActor* Member) const;
+
+    UFUNCTION(BlueprintCallable, Category = "AI|Squad")
+    int32 GetSquadSize(const AActor* Member) const;
+
+    UFUNCTION(BlueprintCallable, Category = "AI|Squad")
+    int32 GetSquadCount() const { return Squads.Num(); }
+
+    UFUNCTION(BlueprintCallable, Category = "AI|Squad")
+    float GetTracesPerAgentPerSecond() const { return TracesPerAgentPerSecond; }
+
+    // How often each squad re-aggregates perception
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI|Squad")
+    float RefreshInterval = 0.2f;
+
+    // Cell size used to group members without an explicit squad id
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI|Squad")
+    float AutoSquadCellSize = 3000.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI|Squad")
+    int32 MaxInterestPoints = 8;
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    struct FAISquad
+    {
+        TArray<TWeakObjectPtr<AActor>> Members;
+        FAISquadSnapshotPtr Snapshot;
+
+        // Reports accumulated since the last refresh
+        TWeakObjectPtr<AActor> SightedTarget;
+        FVector SightedLocation = FVector::ZeroVector;
+        double SightedTime = -1.0;
+        TArray<TWeakObjectPtr<AActor>> PerceivedActors;
+        TArray<FVector> PendingInterestPoints;
+
+        double NextRefreshTime = 0.0;
+    };
+
+    TMap<FName, FAISquad> Squads;
+    TMap<TWeakObjectPtr<const AActor>, FName> MemberToSquad;
+
+    // Trace rate tracking
+    int64 TraceCountAtWindowStart = 0;
+    double TraceWindowStart = 0.0;
+    float TracesPerAgentPerSecond = 0.0f;
+
+    FAISquad* FindSquad(const AActor* Member);
+    const FAISquad* FindSquad(const AActor* Member) const;
+    void RefreshSquad(FAISquad& Squad, double Now);
+    AActor* FindClosestMember(const FAISquad& Squad, const FVector& Location) const;
+    bool TraceVisibility(AActor* Observer, AActor* Target) const;
+    float EvaluateThreat(AActor* Actor, const FVector& SquadCentroid, bool bVisible) const;
+    void UpdateTraceRate(double Now);
+};
@@ -0,0 +1,308 @@
+#include "AIUtilityScoring.h"
+
+namespace
+{
+    FAIUtilityConsideration MakeConsideration(EAIUtilityInput Input, const FAIUtilityCurve& Curve)
+    {
+        FAIUtilityConsideration Consideration;
+        Consideration.Input = Input;
+        Consideration.Curve = Curve;
+        return Consideration;
+    }
+
+    FAIUtilityAction MakeAction(EAIBehaviorState Behavior, float Weight, std::initializer_list<FAIUtilityConsideration> Considerations)
+    {
+        FAIUtilityAction Action;
+        Action.Behavior = Behavior;
+        Action.Weight = Weight;
+        Action.Considerations = Considerations;
+        return Action;
+    }
+
+    // Multiplying many scores in [0,1] punishes actions with more considerations; this evens it out
+    float CompensationFactor(int32 NumConsiderations)
+    {
+        return NumConsiderations > 0 ? 1.0f - (1.0f / NumConsiderations) : 0.0f;
+    }
+}
+
+// FAIUtilityCurve
+
+float FAIUtilityCurve::Evaluate(float X) const
+{
+    if (bInvert)
+    {
+        X = 1.0f - X;
+    }
+
+    const float Shifted = X - XShift;
+    float Y = 0.0f;
+
+    switch (CurveType)
+    {
+        case EAIUtilityCurveType::Linear:
+            Y = Slope * Shifted + YShift;
+            break;
+        case EAIUtilityCurveType::Polynomial:
+            Y = Slope * FMath::Pow(FMath::Max(Shifted, 0.0f), Exponent) + YShift;
+            break;
+        case EAIUtilityCurveType::Logistic:
+            Y = Exponent / (1.0f + FMath::Exp(-Slope * Shifted)) + YShift;
+            break;
+    }
+
+    return FMath::Clamp(Y, 0.0f, 1.0f);
+}
+
+void FAIUtilityCurve::EvaluateBatch(const float* Inputs, float* Outputs, int32 Num) const
+{
+    check(Num % 4 == 0);
+
+    const VectorRegister4Float Zero = GlobalVectorConstants::FloatZero;
+    const VectorRegister4Float One = GlobalVectorConstants::FloatOne;
+    const VectorRegister4Float M = VectorSetFloat1(Slope);
+    const VectorRegister4Float K = VectorSetFloat1(Exponent);
+    const VectorRegister4Float C = VectorSetFloat1(XShift);
+    const VectorRegister4Float B = VectorSetFloat1(YShift);
+    const VectorRegister4Float NegM = VectorNegate(M);
+
+    // The curve type is hoisted out of the loop so each pass is branch-free
+    switch (CurveType)
+    {
+        case EAIUtilityCurveType::Linear:
+            for (int32 Index = 0; Index < Num; Index += 4)
+            {
+                VectorRegister4Float X = VectorLoad(Inputs + Index);
+                X = bInvert ? VectorSubtract(One, X) : X;
+                const VectorRegister4Float Y = VectorMultiplyAdd(M, VectorSubtract(X, C), B);
+                VectorStore(VectorMin(VectorMax(Y, Zero), One), Outputs + Index);
+            }
+            break;
+
+        case EAIUtilityCurveType::Polynomial:
+            for (int32 Index = 0; Index < Num; Index += 4)
+            {
+                VectorRegister4Float X = VectorLoad(Inputs + Index);
+                X = bInvert ? VectorSubtract(One, X) : X;
+                const VectorRegister4Float Shifted = VectorMax(VectorSubtract(X, C), Zero);
+                const VectorRegister4Float Y = VectorMultiplyAdd(M, VectorPow(Shifted, K), B);
+                VectorStore(VectorMin(VectorMax(Y, Zero), One), Outputs + Index);
+            }
+            break;
+
+        case EAIUtilityCurveType::Logistic:
+            for (int32 Index = 0; Index < Num; Index += 4)
+            {
+                VectorRegister4Float X = VectorLoad(Inputs + Index);
+                X = bInvert ? VectorSubtract(One, X) : X;
+                const VectorRegister4Float Exp = VectorExp(VectorMultiply(NegM, VectorSubtract(X, C)));
+                const VectorRegister4Float Y = VectorAdd(VectorDivide(K, VectorAdd(One, Exp)), B);
+                VectorStore(VectorMin(VectorMax(Y, Zero), One), Outputs + Index);
+            }
+            break;
+    }
+}
+
+// FAIUtilityInputBatch
+
+void FAIUtilityInputBatch::Reset(int32 InNumAgents)
+{
+    NumAgents = InNumAgents;
+    PaddedNum = Align(InNumAgents, 4);
+
+    for (TArray<float>& Column : Columns)
+    {
+        Column.SetNumUninitialized(PaddedNum, false);
+        if (PaddedNum > 0)
+        {
+            FMemory::Memzero(Column.GetData(), PaddedNum * sizeof(float));
+        }
+    }
+}
+
+// FAIUtilityScorer
+
+void FAIUtilityScorer::EvaluateBatch(const FAIUtilityInputBatch& Batch, TArray<int32>& OutBestActions, TArray<float>* OutBestScores) const
+{
+    const int32 Num = Batch.PaddedNum;
+    OutBestActions.SetNumUninitialized(Batch.NumAgents);
+
+    if (Num == 0 || Actions.Num() == 0)
+    {
+        for (int32& BestAction : OutBestActions)
+        {
+            BestAction = INDEX_NONE;
+        }
+        return;
+    }
+
+    TArray<float> ActionScores;
+    TArray<float> CurveOutput;
+    TArray<float> BestScores;
+    TArray<float> BestIndices;
+    ActionScores.SetNumUninitialized(Num);
+    CurveOutput.SetNumUninitialized(Num);
+    BestScores.Init(-1.0f, Num);
+    BestIndices.Init(-1.0f, Num);
+
+    const VectorRegister4Float One = GlobalVectorConstants::FloatOne;
+
+    for (int32 ActionIndex = 0; ActionIndex < Actions.Num(); ++ActionIndex)
+    {
+        const FAIUtilityAction& Action = Actions[ActionIndex];
+
+        for (int32 Index = 0; Index < Num; Index += 4)
+        {
+            VectorStore(One, &ActionScores[Index]);
+        }
+
+        // Product of all consideration curves
+        for (const FAIUtilityConsideration& Consideration : Action.Considerations)
+        {
+            Consideration.Curve.EvaluateBatch(Batch.GetColumn(Consideration.Input), CurveOutput.GetData(), Num);
+
+            for (int32 Index = 0; Index < Num; Index += 4)
+            {
+                VectorStore(VectorMultiply(VectorLoad(&ActionScores[Index]), VectorLoad(&CurveOutput[Index])), &ActionScores[Index]);
+            }
+        }
+
+        const VectorRegister4Float Compensation = VectorSetFloat1(CompensationFactor(Action.Considerations.Num()));
+        const VectorRegister4Float Weight = VectorSetFloat1(Action.Weight);
+        const VectorRegister4Float ActionId = VectorSetFloat1((float)ActionIndex);
+
+        // Compensate, weight, then keep a running arg-max per lane
+        for (int32 Index = 0; Index < Num; Index += 4)
+        {
+            const VectorRegister4Float Score = VectorLoad(&ActionScores[Index]);
+            const VectorRegister4Float MakeUp = VectorMultiply(VectorSubtract(One, Score), Compensation);
+            const VectorRegister4Float Final = VectorMultiply(VectorMultiplyAdd(MakeUp, Score, Score), Weight);
+
+            const VectorRegister4Float Best = VectorLoad(&BestScores[Index]);
+            const VectorRegister4Float Mask = VectorCompareGT(Final, Best);
+            VectorStore(VectorSelect(Mask, Final, Best), &BestScores[Index]);
+            VectorStore(VectorSelect(Mask, ActionId, VectorLoad(&BestIndices[Index])), &BestIndices[Index]);
+        }
+    }
+
+    for (int32 AgentIndex = 0; AgentIndex < Batch.NumAgents; ++AgentIndex)
+    {
+        OutBestActions[AgentIndex] = (int32)BestIndices[AgentIndex];
+    }
+
+    if (OutBestScores)
+    {
+        OutBestScores->SetNumUninitialized(Batch.NumAgents);
+        FMemory::Memcpy(OutBestScores->GetData(), BestScores.GetData(), Batch.NumAgents * sizeof(float));
+    }
+}
+
+float FAIUtilityScorer::ScoreAction(const FAIUtilityInputBatch& Batch, int32 AgentIndex, int32 ActionIndex) const
+{
+    const FAIUtilityAction& Action = Actions[ActionIndex];
+
+    float Score = 1.0f;
+    for (const FAIUtilityConsideration& Consideration : Action.Considerations)
+    {
+        Score *= Consideration.Curve.Evaluate(Batch.Get(AgentIndex, Consideration.Input));
+    }
+
+    const float MakeUp = (1.0f - Score) * CompensationFactor(Action.Considerations.Num());
+    return (Score + MakeUp * Score) * Action.Weight;
+}
+
+int32 FAIUtilityScorer::SelectBestAction(const FAIUtilityInputBatch& Batch, int32 AgentIndex) const
+{
+    int32 BestAction = INDEX_NONE;
+    float BestScore = -1.0f;
+
+    for (int32 ActionIndex = 0; ActionIndex < Actions.Num(); ++ActionIndex)
+    {
+        const float Score = ScoreAction(Batch, AgentIndex, ActionIndex);
+        if (Score > BestScore)
+        {
+            BestScore = Score;
+            BestAction = ActionIndex;
+        }
+    }
+
+    return BestAction;
+}
+
+const FAIUtilityScorer& FAIUtilityScorer::GetDefault()
+{
+    static const FAIUtilityScorer DefaultScorer(MakeDefaultActions());
+    return DefaultScorer;
+}
+
+TArray<FAIUtilityAction> FAIUtilityScorer::MakeDefaultActions()
+{
+    using ECurve = EAIUtilityCurveType;
+    using EInput = EAIUtilityInput;
+
+    TArray<FAIUtilityAction> DefaultActions;
+
+    // Stand and fight while healthy, armed and close enough
+    DefaultActions.Add(MakeAction(EAIBehaviorState::Combat, 1.0f, {
+        MakeConsideration(EInput::Health, FAIUtilityCurve(ECurve::Logistic, 10.0f, 1.0f, 0.3f, 0.0f)),
+        MakeConsideration(EInput::Ammo, FAIUtilityCurve(ECurve::Logistic, 12.0f, 1.0f, 0.15f, 0.0f)),
+        MakeConsideration(EInput::TargetDistance, FAIUtilityCurve(ECurve::Linear, -0.5f, 1.0f, 0.0f, 1.0f)),
+        MakeConsideration(EInput::Aggression, FAIUtilityCurve(ECurve::Linear, 0.5f, 1.0f, 0.0f, 0.5f))
+    }));
+
+    // Seek cover under pressure when not already covered
+    DefaultActions.Add(MakeAction(EAIBehaviorState::TakeCover, 1.0f, {
+        MakeConsideration(EInput::Threat, FAIUtilityCurve(ECurve::Polynomial, 1.0f, 0.5f, 0.0f, 0.0f)),
+        MakeConsideration(EInput::Cover, FAIUtilityCurve(ECurve::Linear, -0.9f, 1.0f, 0.0f, 1.0f)),
+        MakeConsideration(EInput::Aggression, FAIUtilityCurve(ECurve::Linear, -0.5f, 1.0f, 0.0f, 1.0f))
+    }));
+
+    // Flank distant targets when the squad can back it up
+    DefaultActions.Add(MakeAction(EAIBehaviorState::Flank, 0.9f, {
+        MakeConsideration(EInput::TargetDistance, FAIUtilityCurve(ECurve::Logistic, 10.0f, 1.0f, 0.6f, 0.0f)),
+        MakeConsideration(EInput::Teamwork, FAIUtilityCurve(ECurve::Linear, 1.0f, 1.0f, 0.0f, 0.0f)),
+        MakeConsideration(EInput::Health, FAIUtilityCurve(ECurve::Logistic, 10.0f, 1.0f, 0.5f, 0.0f))
+    }));
+
+    // Suppress with plenty of ammunition
+    DefaultActions.Add(MakeAction(EAIBehaviorState::Suppress, 0.8f, {
+        MakeConsideration(EInput::Ammo, FAIUtilityCurve(ECurve::Polynomial, 1.0f, 2.0f, 0.0f, 0.0f)),
+        MakeConsideration(EInput::Aggression, FAIUtilityCurve(ECurve::Linear, 1.0f, 1.0f, 0.0f, 0.0f)),
+        MakeConsideration(EInput::Threat, FAIUtilityCurve(ECurve::Linear, 0.5f, 1.0f, 0.0f, 0.5f))
+    }));
+
+    // Call for help when heavily threatened
+    DefaultActions.Add(MakeAction(EAIBehaviorState::CallForBackup, 0.7f, {
+        MakeConsideration(EInput::Threat, FAIUtilityCurve(ECurve::Polynomial, 1.0f, 2.0f, 0.0f, 0.0f)),
+        MakeConsideration(EInput::Teamwork, FAIUtilityCurve(ECurve::Linear, 1.0f, 1.0f, 0.0f, 0.0f))
+    }));
+
+    // Retreat when badly hurt, more eagerly under threat
+    DefaultActions.Add(MakeAction(EAIBehaviorState::Retreat, 1.2f, {
+        MakeConsideration(EInput::Health, FAIUtilityCurve(ECurve::Logistic, -12.0f, 1.0f, 0.3f, 0.0f)),
+        MakeConsideration(EInput::Threat, FAIUtilityCurve(ECurve::Linear, 0.6f, 1.0f, 0.0f, 0.4f))
+    }));
+
+    return DefaultActions;
+}
+
+// UAIUtilityProfile
+
+const FAIUtilityScorer& UAIUtilityProfile::GetScorer() const
+{
+    if (!bScorerBuilt)
+    {
+        CachedScorer.SetActions(Actions.Num() > 0 ? Actions : FAIUtilityScorer::MakeDefaultActions());
+        bScorerBuilt = true;
+    }
+
+    return CachedScorer;
+}
+
+#if WITH_EDITOR
+void UAIUtilityProfile::PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent)
+{
+    Super::PostEditChangeProperty(PropertyChangedEvent);
+    bScorerBuilt = false;
+}
+#endif
@@ -0,0 +1,170 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/DataAsset.h"
+#include "AdvancedAISystem.h"
+#include "AIUtilityScoring.generated.h"
+
+UENUM(BlueprintType)
+enum class EAIUtilityInput : uint8
+{
+    Health          UMETA(DisplayName = "Health"),
+    TargetDistance  UMETA(DisplayName = "Target Distance"),
+    Ammo            UMETA(DisplayName = "Ammo"),
+    Threat          UMETA(DisplayName = "Threat"),
+    Cover           UMETA(DisplayName = "Cover"),
+    Aggression      UMETA(DisplayName = "Aggression"),
+    Teamwork        UMETA(DisplayName = "Teamwork"),
+    Count           UMETA(Hidden)
+};
+
+UENUM(BlueprintType)
+enum class EAIUtilityCurveType : uint8
+{
+    Linear      UMETA(DisplayName = "Linear"),
+    Polynomial  UMETA(DisplayName = "Polynomial"),
+    Logistic    UMETA(DisplayName = "Logistic")
+};
+
+/**
+ * Response curve mapping a normalized input (0-1) to a utility score (0-1).
+ * Linear: M*(x-C)+B, Polynomial: M*(x-C)^K+B, Logistic: K/(1+e^(-M*(x-C)))+B
+ */
+USTRUCT(BlueprintType)
+struct FPSGAME_API FAIUtilityCurve
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Utility")
+    EAIUtilityCurveType CurveType = EAIUtilityCurveType::Linear;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Utility")
+    float Slope = 1.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Utility")
+    float Exponent = 1.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Utility")
+    float XShift = 0.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Utility")
+    float YShift = 0.0f;
+
+    // Evaluates the curve on 1-x instead of x
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Utility")
+    bool bInvert = false;
+
+    FAIUtilityCurve() {}
+
+    FAIUtilityCurve(EAIUtilityCurveType InType, float InSlope, float InExponent, float InXShift, float InYShift, bool bInInvert = false)
+        : CurveType(InType), Slope(InSlope), Exponent(InExponent), XShift(InXShift), YShift(InYShift), bInvert(bInInvert)
+    {
+    }
+
+    float Evaluate(float X) const;
+
+    // Evaluates four inputs at a time; Num must be a multiple of 4
+    void EvaluateBatch(const float* Inputs, float* Outputs, int32 Num) const;
+};
+
+USTRUCT(BlueprintType)
+struct FPSGAME_API FAIUtilityConsideration
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Utility")
+    EAIUtilityInput Input = EAIUtilityInput::Health;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Utility")
+    FAIUtilityCurve Curve;
+};
+
+USTRUCT(BlueprintType)
+struct FPSGAME_API FAIUtilityAction
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Utility")
+    EAIBehaviorState Behavior = EAIBehaviorState::Combat;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Utility")
+    float Weight = 1.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Utility")
+    TArray<FAIUtilityConsideration> Considerations;
+};
+
+/**
+ * Structure-of-arrays input block: one float column per EAIUtilityInput, padded to a multiple of 4 agents
+ */
+struct FPSGAME_API FAIUtilityInputBatch
+{
+    int32 NumAgents = 0;
+    int32 PaddedNum = 0;
+    TArray<float> Columns[(int32)EAIUtilityInput::Count];
+
+    void Reset(int32 InNumAgents);
+
+    void Set(int32 AgentIndex, EAIUtilityInput Input, float Value)
+    {
+        Columns[(int32)Input][AgentIndex] = FMath::Clamp(Value, 0.0f, 1.0f);
+    }
+
+    float Get(int32 AgentIndex, EAIUtilityInput Input) const
+    {
+        return Columns[(int32)Input][AgentIndex];
+    }
+
+    const float* GetColumn(EAIUtilityInput Input) const { return Columns[(int32)Input].GetData(); }
+};
+
+/**
+ * Scores a set of utility actions for a whole batch of agents and picks the best action per agent.
+ * Cost is O(actions * considerations * agents / 4) with no branching on agent state.
+ */
+class FPSGAME_API FAIUtilityScorer
+{
+public:
+    FAIUtilityScorer() {}
+    explicit FAIUtilityScorer(const TArray<FAIUtilityAction>& InActions) { SetActions(InActions); }
+
+    void SetActions(const TArray<FAIUtilityAction>& InActions) { Actions = InActions; }
+
+    void EvaluateBatch(const FAIUtilityInputBatch& Batch, TArray<int32>& OutBestActions, TArray<float>* OutBestScores = nullptr) const;
+
+    // Scalar reference path, used for single queries and to validate the batch path
+    float ScoreAction(const FAIUtilityInputBatch& Batch, int32 AgentIndex, int32 ActionIndex) const;
+    int32 SelectBestAction(const FAIUtilityInputBatch& Batch, int32 AgentIndex) const;
+
+    int32 GetNumActions() const { return Actions.Num(); }
+    EAIBehaviorState GetActionBehavior(int32 ActionIndex) const { return Actions[ActionIndex].Behavior; }
+
+    static const FAIUtilityScorer& GetDefault();
+    static TArray<FAIUtilityAction> MakeDefaultActions();
+
+private:
+    TArray<FAIUtilityAction> Actions;
+};
+
+/**
+ * Data asset holding a designer-authored utility action set
+ */
+UCLASS(BlueprintType)
+class FPSGAME_API UAIUtilityProfile : public UDataAsset
+{
+    GENERATED_BODY()
+
+public:
+    UPROPERTY(EditAnywhere, BlueprintReadOnly, Category = "Utility")
+    TArray<FAIUtilityAction> Actions;
+
+    const FAIUtilityScorer& GetScorer() const;
+
+#if WITH_EDITOR
+    virtual void PostEditChangeProperty(FPropertyChangedEvent& PropertyChangedEvent) override;
+#endif
+
+private:
+    mutable FAIUtilityScorer CachedScorer;
+    mutable bool bScorerBuilt = false;
+};
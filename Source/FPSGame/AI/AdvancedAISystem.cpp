@@ -11,13 +11,16 @@
 #include "Kismet/KismetMathLibrary.h"
 #include "Engine/World.h"
 #include "DrawDebugHelpers.h"
+#include "AILODScheduler.h"
+#include "AIUtilityScoring.h"
+#include "AISquadBlackboard.h"
+#include "../Components/DamageComponent.h"
 #include "../Weapons/AdvancedWeaponSystem.h"
 #include "../Characters/FPSCharacter.h"
+#include "../Optimization/FPSGameStats.h"
 
 // Initialize static members
 TArray<UAdvancedAISystem*> UAdvancedAISystem::ActiveAISystems;
-int32 UAdvancedAISystem::CurrentTimeSliceIndex = 0;
-float UAdvancedAISystem::TimeSliceStartTime = 0.0f;
 
 UAdvancedAISystem::UAdvancedAISystem()
 {
@@ -58,6 +61,17 @@ void UAdvancedAISystem::BeginPlay()
     // Initialize AI components
     InitializeAI();
     
+    if (GetOwner())
+    {
+        PatrolHome = GetOwner()->GetActorLocation();
+    }
+    
+    // Join the squad blackboard so perception work is shared
+    if (UAISquadBlackboard* Blackboard = UAISquadBlackboard::Get(this))
+    {
+        SquadId = Blackboard->RegisterMember(GetOwner(), SquadId);
+    }
+    
     // Register for time slicing if enabled
     if (OptimizationSettings.bEnableTimeSlicing)
     {
@@ -76,6 +90,11 @@ void UAdvancedAISystem::EndPlay(const EEndPlayReason::Type EndPlayReason)
     // Unregister from time slicing
     UnregisterFromTimeSlicing();
     
+    if (UAISquadBlackboard* Blackboard = UAISquadBlackboard::Get(this))
+    {
+        Blackboard->UnregisterMember(GetOwner());
+    }
+    
     Super::EndPlay(EndPlayReason);
 }
 
@@ -83,25 +102,23 @@ void UAdvancedAISystem::TickComponent(float DeltaTime, ELevelTick TickType, FAct
 {
     Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
     
+    // Time-sliced agents are driven entirely by the LOD scheduler
+    if (bIsTimeSliced)
+    {
+        return;
+    }
+    
     // Update distance LOD
     if (OptimizationSettings.bEnableDistanceLOD)
     {
         UpdateDistanceLOD();
     }
     
-    // Time-sliced or regular update
-    if (OptimizationSettings.bEnableTimeSlicing)
-    {
-        // Time-sliced updates are handled by the static manager
-        ProcessTimeSlicedUpdates(DeltaTime);
-    }
-    else
+    // Regular update if not time-sliced
+    if (ShouldUpdateThisFrame())
     {
-        // Regular update if not time-sliced
-        if (ShouldUpdateThisFrame())
-        {
-            UpdateAILogicOptimized(DeltaTime);
-        }
+        UpdateAILogicOptimized(DeltaTime);
+        LastUpdateTime = GetWorld()->GetTimeSeconds();
     }
 }
 
@@ -116,25 +133,30 @@ void UAdvancedAISystem::UpdateDistanceLOD()
     
     DistanceToPlayer = FVector::Dist(GetOwner()->GetActorLocation(), Player->GetActorLocation());
     
-    EAILODLevel NewLODLevel = EAILODLevel::HighDetail;
+    EAILODLevel NewLODLevel = ComputeLODLevel(DistanceToPlayer);
     
-    if (DistanceToPlayer > OptimizationSettings.CullDistance)
+    if (NewLODLevel != CurrentLODLevel)
     {
-        NewLODLevel = EAILODLevel::Culled;
+        SetLODLevel(NewLODLevel);
     }
-    else if (DistanceToPlayer > OptimizationSettings.LowDetailDistance)
+}
+
+EAILODLevel UAdvancedAISystem::ComputeLODLevel(float Distance) const
+{
+    if (Distance > OptimizationSettings.CullDistance)
     {
-        NewLODLevel = EAILODLevel::LowDetail;
+        return EAILODLevel::Culled;
     }
-    else if (DistanceToPlayer > OptimizationSettings.MediumDetailDistance)
+    else if (Distance > OptimizationSettings.LowDetailDistance)
     {
-        NewLODLevel = EAILODLevel::MediumDetail;
+        return EAILODLevel::LowDetail;
     }
-    
-    if (NewLODLevel != CurrentLODLevel)
+    else if (Distance > OptimizationSettings.MediumDetailDistance)
     {
-        SetLODLevel(NewLODLevel);
+        return EAILODLevel::MediumDetail;
     }
+    
+    return EAILODLevel::HighDetail;
 }
 
 void UAdvancedAISystem::SetLODLevel(EAILODLevel NewLODLevel)
@@ -197,6 +219,15 @@ void UAdvancedAISystem::SetLODLevel(EAILODLevel NewLODLevel)
                 break;
         }
     }
+    
+    // Move to the matching scheduler bucket
+    if (bIsTimeSliced)
+    {
+        if (UAILODScheduler* Scheduler = UAILODScheduler::Get(this))
+        {
+            Scheduler->NotifyLODChanged(this);
+        }
+    }
 }
 
 bool UAdvancedAISystem::ShouldUpdateThisFrame() const
@@ -226,68 +257,67 @@ float UAdvancedAISystem::GetCurrentUpdateInterval() const
 
 void UAdvancedAISystem::RegisterForTimeSlicing()
 {
-    if (!ActiveAISystems.Contains(this))
+    ActiveAISystems.AddUnique(this);
+    
+    if (bIsTimeSliced)
     {
-        ActiveAISystems.Add(this);
+        return;
+    }
+    
+    // Without a scheduler (e.g. editor preview worlds) the component keeps ticking itself
+    UAILODScheduler* Scheduler = UAILODScheduler::Get(this);
+    if (Scheduler)
+    {
+        Scheduler->RegisterAgent(this);
         bIsTimeSliced = true;
+        
+        // The scheduler refreshes LOD and runs the logic, so the component tick is redundant
+        SetComponentTickEnabled(false);
     }
 }
 
 void UAdvancedAISystem::UnregisterFromTimeSlicing()
 {
     ActiveAISystems.Remove(this);
-    bIsTimeSliced = false;
+    
+    if (bIsTimeSliced)
+    {
+        if (UAILODScheduler* Scheduler = UAILODScheduler::Get(this))
+        {
+            Scheduler->UnregisterAgent(this);
+        }
+        
+        bIsTimeSliced = false;
+        SetComponentTickEnabled(true);
+    }
 }
 
-// Static time-slicing manager
 void UAdvancedAISystem::ProcessTimeSlicedUpdates(float DeltaTime)
 {
-    if (ActiveAISystems.Num() == 0)
-    {
-        return;
-    }
-    
-    float CurrentTime = FPlatformTime::Seconds();
-    
-    // Reset time slice if starting new frame
-    if (TimeSliceStartTime == 0.0f || (CurrentTime - TimeSliceStartTime) > 0.016f) // 60 FPS frame time
+    TArray<UWorld*, TInlineAllocator<2>> Worlds;
+    for (UAdvancedAISystem* AISystem : ActiveAISystems)
     {
-        TimeSliceStartTime = CurrentTime;
-        CurrentTimeSliceIndex = 0;
+        if (IsValid(AISystem) && AISystem->GetWorld())
+        {
+            Worlds.AddUnique(AISystem->GetWorld());
+        }
     }
     
-    // Calculate how many AI systems we can update this frame
-    int32 MaxUpdatesThisFrame = FMath::Min(
-        (int32)OptimizationSettings.MaxAIUpdatesPerFrame,
-        ActiveAISystems.Num()
-    );
-    
-    float TimeSliceBudget = OptimizationSettings.TimeSliceBudgetMS * 0.001f; // Convert to seconds
-    int32 UpdatesProcessed = 0;
-    
-    while (UpdatesProcessed < MaxUpdatesThisFrame && 
-           (FPlatformTime::Seconds() - TimeSliceStartTime) < TimeSliceBudget)
+    // Each scheduler ignores repeat calls within the same world tick
+    for (UWorld* World : Worlds)
     {
-        if (CurrentTimeSliceIndex >= ActiveAISystems.Num())
-        {
-            CurrentTimeSliceIndex = 0;
-        }
-        
-        UAdvancedAISystem* AISystem = ActiveAISystems[CurrentTimeSliceIndex];
-        if (IsValid(AISystem) && AISystem->ShouldUpdateThisFrame())
+        if (UAILODScheduler* Scheduler = World->GetSubsystem<UAILODScheduler>())
         {
-            AISystem->UpdateAILogicOptimized(DeltaTime);
-            AISystem->LastUpdateTime = FPlatformTime::Seconds();
+            Scheduler->ProcessDueAgents();
         }
-        
-        CurrentTimeSliceIndex++;
-        UpdatesProcessed++;
     }
 }
 
 // Optimized update functions
 void UAdvancedAISystem::UpdateAILogicOptimized(float DeltaTime)
 {
+    FPSGAME_SCOPE_CYCLE_COUNTER(AIUpdate);
+    
     UpdateStartTime = FPlatformTime::Seconds();
     
     switch (CurrentLODLevel)
@@ -463,6 +493,10 @@ void UAdvancedAISystem::InitializeAI()
     
     // Find weapon component
     CurrentWeapon = Owner->FindComponentByClass<AAdvancedWeaponSystem>();
+    
+    // Cached for utility scoring inputs
+    OwnerWeaponSystem = Owner->FindComponentByClass<UAdvancedWeaponSystem>();
+    HealthComponent = Owner->FindComponentByClass<UDamageComponent>();
 }
 
 void UAdvancedAISystem::UpdateAILogic(float DeltaTime)
@@ -544,9 +578,15 @@ void UAdvancedAISystem::OnPerceptionUpdated(AActor* Actor, FAIStimulus Stimulus)
             AIMemory.bHasSeenPlayer = true;
             AIMemory.LastCombatTime = GetWorld()->GetTimeSeconds();
             
+            // Share the sighting with the rest of the squad
+            if (UAISquadBlackboard* Blackboard = UAISquadBlackboard::Get(this))
+            {
+                Blackboard->ReportSighting(GetOwner(), Actor, LastKnownPlayerLocation);
+            }
+            
             // Add to memory
             AIMemory.LastKnownEnemyPositions.AddUnique(LastKnownPlayerLocation);
-            AIMemory.ThreatLevels.Add(Actor, CalculateThreatLevel(Actor));
+            AIMemory.ThreatLevels.Set(Actor, CalculateThreatLevel(Actor), GetWorld()->GetTimeSeconds());
             
             // Change to combat state
             if (CurrentBehaviorState != EAIBehaviorState::Combat)
@@ -576,8 +616,7 @@ void UAdvancedAISystem::OnDamageReceived(float DamageAmount, AActor* DamageInsti
     if (DamageInstigator)
     {
         // Update threat level
-        float CurrentThreat = AIMemory.ThreatLevels.FindRef(DamageInstigator);
-        AIMemory.ThreatLevels.Add(DamageInstigator, CurrentThreat + DamageAmount * 0.1f);
+        AIMemory.ThreatLevels.Accumulate(DamageInstigator, DamageAmount * 0.1f, GetWorld()->GetTimeSeconds());
         
         // If not already in combat, enter combat state
         if (!AIMemory.bIsInCombat)
@@ -734,36 +773,17 @@ FVector UAdvancedAISystem::FindFlankingPosition(FVector EnemyLocation, float Fla
 
 bool UAdvancedAISystem::ShouldRetreat()
 {
-    AActor* Owner = GetOwner();
-    if (!Owner) return false;
+    if (!GetOwner()) return false;
     
-    // Check health percentage (assuming character has health component)
-    APawn* PawnOwner = Cast<APawn>(Owner);
-    if (PawnOwner)
-    {
-        // Simple health check - in real implementation, get from health component
-        float HealthPercentage = 0.5f; // Placeholder
-        
-        // Retreat if health is low or outnumbered
-        if (HealthPercentage < 0.3f)
-        {
-            return true;
-        }
-        
-        // Retreat if facing multiple threats
-        int32 ThreatCount = 0;
-        for (auto& ThreatPair : AIMemory.ThreatLevels)
-        {
-            if (ThreatPair.Value > 0.5f)
-            {
-                ThreatCount++;
-            }
-        }
-        
-        return ThreatCount >= 3;
-    }
+    // Retreat when it outscores every other action for this agent
+    FAIUtilityInputBatch Batch;
+    Batch.Reset(1);
+    GatherUtilityInputs(Batch, 0);
+    
+    const FAIUtilityScorer& Scorer = GetUtilityScorer();
+    const int32 BestAction = Scorer.SelectBestAction(Batch, 0);
     
-    return false;
+    return BestAction != INDEX_NONE && Scorer.GetActionBehavior(BestAction) == EAIBehaviorState::Retreat;
 }
 
 void UAdvancedAISystem::CallForBackup(FVector Location)
@@ -795,6 +815,20 @@ float UAdvancedAISystem::CalculateThreatLevel(AActor* PotentialThreat)
 {
     if (!PotentialThreat) return 0.0f;
     
+    // Prefer the squad's assessment, which was made with a single shared trace
+    if (UAISquadBlackboard* Blackboard = UAISquadBlackboard::Get(this))
+    {
+        FAISquadSnapshotPtr Snapshot = Blackboard->GetSnapshot(GetOwner());
+        if (Snapshot.IsValid())
+        {
+            if (const FAISquadThreat* SquadThreat = Snapshot->FindThreat(PotentialThreat))
+            {
+                FAIPerceptionStats::SharedVisibilityHits++;
+                return SquadThreat->ThreatLevel;
+            }
+        }
+    }
+    
     float ThreatLevel = 1.0f;
     
     // Check if target has weapons
@@ -1032,11 +1066,13 @@ void UAdvancedAISystem::HandleRetreatState(float DeltaTime)
     // Find retreat point away from threats
     FVector RetreatPoint = GetOwner()->GetActorLocation();
     
-    for (auto& ThreatPair : AIMemory.ThreatLevels)
+    const double Now = GetWorld()->GetTimeSeconds();
+    for (int32 ThreatIndex = 0; ThreatIndex < AIMemory.ThreatLevels.Num(); ++ThreatIndex)
     {
-        if (ThreatPair.Key && ThreatPair.Value > 0.5f)
+        AActor* ThreatActor = AIMemory.ThreatLevels[ThreatIndex].Actor.Get();
+        if (ThreatActor && AIMemory.ThreatLevels.GetDecayedScore(ThreatIndex, Now) > 0.5f)
         {
-            FVector ThreatLocation = ThreatPair.Key->GetActorLocation();
+            FVector ThreatLocation = ThreatActor->GetActorLocation();
             FVector AwayDirection = (GetOwner()->GetActorLocation() - ThreatLocation).GetSafeNormal();
             RetreatPoint += AwayDirection * 1000.0f;
         }
@@ -1060,7 +1096,7 @@ void UAdvancedAISystem::HandleInvestigateState(float DeltaTime)
     // Move towards points of interest
     if (AIMemory.InterestPoints.Num() > 0)
     {
-        FVector InvestigatePoint = AIMemory.InterestPoints[0];
+        FVector InvestigatePoint = AIMemory.InterestPoints.Front();
         if (BlackboardComponent)
         {
             BlackboardComponent->SetValueAsVector(TEXT("InvestigatePoint"), InvestigatePoint);
@@ -1069,7 +1105,7 @@ void UAdvancedAISystem::HandleInvestigateState(float DeltaTime)
         // Remove investigated point
         if (FVector::Dist(GetOwner()->GetActorLocation(), InvestigatePoint) < 100.0f)
         {
-            AIMemory.InterestPoints.RemoveAt(0);
+            AIMemory.InterestPoints.PopFront();
         }
     }
     
@@ -1083,6 +1119,8 @@ void UAdvancedAISystem::HandleInvestigateState(float DeltaTime)
 // Utility functions
 bool UAdvancedAISystem::ValidateLineOfSight(FVector Start, FVector End, AActor* IgnoreActor)
 {
+    FAIPerceptionStats::LineOfSightTraces++;
+    
     FHitResult HitResult;
     FCollisionQueryParams Params;
     if (IgnoreActor)
@@ -1100,6 +1138,22 @@ FVector UAdvancedAISystem::GetRandomPatrolPoint()
     AActor* Owner = GetOwner();
     if (!Owner) return FVector::ZeroVector;
     
+    // Walk a navigable loop shared with other agents patrolling the same area
+    if (UAIPathCache* PathCache = UAIPathCache::Get(this))
+    {
+        if (!PatrolLoop.IsValid() || !PathCache->IsLoopCurrent(*PatrolLoop))
+        {
+            PatrolLoop = PathCache->GetPatrolLoopAround(PatrolHome, TacticalData.PatrolRadius, 6, Owner->GetSimpleCollisionRadius(), Owner);
+            PatrolLoopIndex = PatrolLoop.IsValid() ? FMath::RandRange(0, PatrolLoop->Waypoints.Num() - 1) : 0;
+        }
+        
+        if (PatrolLoop.IsValid() && PatrolLoop->Waypoints.Num() > 0)
+        {
+            PatrolLoopIndex = (PatrolLoopIndex + 1) % PatrolLoop->Waypoints.Num();
+            return PatrolLoop->Waypoints[PatrolLoopIndex];
+        }
+    }
+    
     FVector BaseLocation = Owner->GetActorLocation();
     float RandomAngle = FMath::RandRange(0.0f, 360.0f);
     float RandomDistance = FMath::RandRange(200.0f, TacticalData.PatrolRadius);
@@ -1113,43 +1167,26 @@ FVector UAdvancedAISystem::GetRandomPatrolPoint()
 
 void UAdvancedAISystem::UpdateMemory()
 {
-    // Clean old memory entries
-    float CurrentTime = GetWorld()->GetTimeSeconds();
+    // Threat scores decay by time on read; pruning only frees slots of dead or forgotten threats
+    const double CurrentTime = GetWorld()->GetTimeSeconds();
+    AIMemory.ThreatLevels.Prune(CurrentTime);
     
-    // Remove old threat levels
-    TArray<AActor*> ActorsToRemove;
-    for (auto& ThreatPair : AIMemory.ThreatLevels)
+    // Adopt a fresher target position seen by another squad member
+    if (UAISquadBlackboard* Blackboard = UAISquadBlackboard::Get(this))
     {
-        if (!IsValid(ThreatPair.Key))
-        {
-            ActorsToRemove.Add(ThreatPair.Key);
-        }
-        else
+        FAISquadSnapshotPtr Snapshot = Blackboard->GetSnapshot(GetOwner());
+        if (Snapshot.IsValid() && Snapshot->Target.IsValid() && Snapshot->LastTargetSeenTime > AIMemory.LastCombatTime)
         {
-            // Decay threat over time
-            AIMemory.ThreatLevels[ThreatPair.Key] *= 0.98f;
-            if (AIMemory.ThreatLevels[ThreatPair.Key] < 0.1f)
-            {
-                ActorsToRemove.Add(ThreatPair.Key);
-            }
+            LastKnownPlayerLocation = Snapshot->LastKnownTargetLocation;
+            AIMemory.LastKnownEnemyPositions.AddUnique(LastKnownPlayerLocation);
         }
     }
-    
-    for (AActor* Actor : ActorsToRemove)
-    {
-        AIMemory.ThreatLevels.Remove(Actor);
-    }
-    
-    // Limit memory arrays
-    if (AIMemory.LastKnownEnemyPositions.Num() > 10)
-    {
-        AIMemory.LastKnownEnemyPositions.RemoveAt(0);
-    }
-    
-    if (AIMemory.InterestPoints.Num() > 5)
-    {
-        AIMemory.InterestPoints.RemoveAt(0);
-    }
+}
+
+float UAdvancedAISystem::GetRememberedThreat(AActor* Actor) const
+{
+    const UWorld* World = GetWorld();
+    return World ? AIMemory.ThreatLevels.Get(Actor, World->GetTimeSeconds()) : 0.0f;
 }
 
 void UAdvancedAISystem::UpdateCombatLogic(float DeltaTime)
@@ -1222,23 +1259,49 @@ void UAdvancedAISystem::ProcessPerceptionData()
 {
     if (!PerceptionComponent) return;
     
-    TArray<AActor*> PerceivedActors;
+    // Scratch array keeps its allocation between calls
+    TArray<AActor*>& PerceivedActors = PerceivedActorsScratch;
+    PerceivedActors.Reset();
     PerceptionComponent->GetCurrentlyPerceivedActors(nullptr, PerceivedActors);
     
+    // Report to the squad and read back its merged view instead of tracing every actor ourselves
+    if (UAISquadBlackboard* Blackboard = UAISquadBlackboard::Get(this))
+    {
+        for (AActor* Actor : PerceivedActors)
+        {
+            Blackboard->ReportPerceivedActor(GetOwner(), Actor);
+        }
+        
+        FAISquadSnapshotPtr Snapshot = Blackboard->GetSnapshot(GetOwner());
+        if (Snapshot.IsValid())
+        {
+            for (const FAISquadThreat& Threat : Snapshot->Threats)
+            {
+                if (AActor* ThreatActor = Threat.Actor.Get())
+                {
+                    AIMemory.ThreatLevels.Set(ThreatActor, Threat.ThreatLevel, Snapshot->BuildTime);
+                }
+            }
+            
+            for (const FVector& Point : Snapshot->InterestPoints)
+            {
+                AIMemory.InterestPoints.AddUnique(Point);
+            }
+            return;
+        }
+    }
+    
     for (AActor* Actor : PerceivedActors)
     {
         if (Actor && Actor != GetOwner())
         {
             // Add to interest points if not already tracking
             FVector ActorLocation = Actor->GetActorLocation();
-            if (!AIMemory.InterestPoints.Contains(ActorLocation))
-            {
-                AIMemory.InterestPoints.Add(ActorLocation);
-            }
+            AIMemory.InterestPoints.AddUnique(ActorLocation);
             
             // Update threat assessment
             float ThreatLevel = CalculateThreatLevel(Actor);
-            AIMemory.ThreatLevels.Add(Actor, ThreatLevel);
+            AIMemory.ThreatLevels.Set(Actor, ThreatLevel, GetWorld()->GetTimeSeconds());
         }
     }
 }
@@ -1246,59 +1309,75 @@ void UAdvancedAISystem::ProcessPerceptionData()
 void UAdvancedAISystem::MakeTacticalDecision()
 {
     // High-level tactical decision making
-    if (AIMemory.bIsInCombat && CurrentTarget)
+    if (!AIMemory.bIsInCombat || !CurrentTarget)
     {
-        float RandomValue = FMath::RandFloat();
-        
-        // Personality-based decision making
-        switch (Personality)
+        return;
+    }
+    
+    // Time-sliced agents are scored together in one batch at the end of the scheduler pass
+    if (bIsTimeSliced)
+    {
+        if (UAILODScheduler* Scheduler = UAILODScheduler::Get(this))
         {
-            case EAIPersonality::Aggressive:
-                if (RandomValue < 0.6f)
-                {
-                    SetBehaviorState(EAIBehaviorState::Combat);
-                }
-                else if (RandomValue < 0.8f)
-                {
-                    SetBehaviorState(EAIBehaviorState::Flank);
-                }
-                else
-                {
-                    SetBehaviorState(EAIBehaviorState::Suppress);
-                }
-                break;
-                
-            case EAIPersonality::Defensive:
-                if (RandomValue < 0.7f)
-                {
-                    SetBehaviorState(EAIBehaviorState::TakeCover);
-                }
-                else
-                {
-                    SetBehaviorState(EAIBehaviorState::Combat);
-                }
-                break;
-                
-            case EAIPersonality::Tactical:
-                if (RandomValue < 0.3f)
-                {
-                    SetBehaviorState(EAIBehaviorState::Flank);
-                }
-                else if (RandomValue < 0.6f)
-                {
-                    SetBehaviorState(EAIBehaviorState::TakeCover);
-                }
-                else if (RandomValue < 0.8f)
-                {
-                    SetBehaviorState(EAIBehaviorState::Combat);
-                }
-                else
-                {
-                    SetBehaviorState(EAIBehaviorState::CallForBackup);
-                }
-                break;
+            Scheduler->RequestTacticalDecision(this);
+            return;
         }
     }
+    
+    FAIUtilityInputBatch Batch;
+    Batch.Reset(1);
+    GatherUtilityInputs(Batch, 0);
+    
+    const FAIUtilityScorer& Scorer = GetUtilityScorer();
+    const int32 BestAction = Scorer.SelectBestAction(Batch, 0);
+    if (BestAction != INDEX_NONE)
+    {
+        ApplyUtilityDecision(Scorer.GetActionBehavior(BestAction));
+    }
+}
+
+void UAdvancedAISystem::GatherUtilityInputs(FAIUtilityInputBatch& Batch, int32 AgentIndex)
+{
+    AActor* Owner = GetOwner();
+    
+    const float Health = HealthComponent ? HealthComponent->GetHealthPercentage() : 1.0f;
+    
+    float Ammo = 1.0f;
+    if (OwnerWeaponSystem && OwnerWeaponSystem->WeaponStats.MagazineSize > 0)
+    {
+        Ammo = (float)OwnerWeaponSystem->CurrentAmmo / OwnerWeaponSystem->WeaponStats.MagazineSize;
+    }
+    
+    float TargetDistance = 1.0f;
+    if (Owner && CurrentTarget && TacticalData.CombatRadius > 0.0f)
+    {
+        TargetDistance = FVector::Dist(Owner->GetActorLocation(), CurrentTarget->GetActorLocation()) / TacticalData.CombatRadius;
+    }
+    
+    // Threat pressure: three full-strength threats saturate the input
+    const float TotalThreat = AIMemory.ThreatLevels.GetTotal(GetWorld()->GetTimeSeconds());
+    
+    Batch.Set(AgentIndex, EAIUtilityInput::Health, Health);
+    Batch.Set(AgentIndex, EAIUtilityInput::Ammo, Ammo);
+    Batch.Set(AgentIndex, EAIUtilityInput::TargetDistance, TargetDistance);
+    Batch.Set(AgentIndex, EAIUtilityInput::Threat, TotalThreat / 30.0f);
+    Batch.Set(AgentIndex, EAIUtilityInput::Cover, IsInCover() ? 1.0f : 0.0f);
+    Batch.Set(AgentIndex, EAIUtilityInput::Aggression, TacticalData.AggresionLevel);
+    Batch.Set(AgentIndex, EAIUtilityInput::Teamwork, TacticalData.TeamworkFactor);
+}
+
+void UAdvancedAISystem::ApplyUtilityDecision(EAIBehaviorState Decision)
+{
+    // Targets can be lost between the request and the batched evaluation
+    if (AIMemory.bIsInCombat && CurrentTarget)
+    {
+        SetBehaviorState(Decision);
+    }
+}
+
+const FAIUtilityScorer& UAdvancedAISystem::GetUtilityScorer() const
+{
+    return UtilityProfile ? UtilityProfile->GetScorer() : FAIUtilityScorer::GetDefault();
 }
 
 bool UAdvancedAISystem::IsInCover()
@@ -10,10 +10,15 @@
 #include "Perception/AIPerceptionComponent.h"
 #include "Perception/AISightPerceptionComponent.h"
 #include "Perception/AIHearingPerceptionComponent.h"
+#include "AIPathCache.h"
+#include "AIMemoryTypes.h"
 #include "AdvancedAISystem.generated.h"
 
 class AFPSCharacter;
 class AAdvancedWeaponSystem;
+class UAIUtilityProfile;
+class FAIUtilityScorer;
+struct FAIUtilityInputBatch;
 
 UENUM(BlueprintType)
 enum class EAIBehaviorState : uint8
@@ -90,17 +95,11 @@ struct FAIMemory
 {
     GENERATED_BODY()
 
-    UPROPERTY(BlueprintReadWrite)
-    TArray<FVector> LastKnownEnemyPositions;
-
-    UPROPERTY(BlueprintReadWrite)
-    TArray<FVector> InterestPoints;
-
-    UPROPERTY(BlueprintReadWrite)
-    TArray<FVector> CoverPoints;
-
-    UPROPERTY(BlueprintReadWrite)
-    TMap<AActor*, float> ThreatLevels;
+    // Fixed-capacity storage: no allocation per perception event and the whole struct copies as a snapshot
+    TAIRingBuffer<FVector, 10> LastKnownEnemyPositions;
+    TAIRingBuffer<FVector, 8> InterestPoints;
+    TAIRingBuffer<FVector, 8> CoverPoints;
+    TAIThreatTable<8> ThreatLevels;
 
     UPROPERTY(BlueprintReadWrite)
     float LastCombatTime = 0.0f;
@@ -180,6 +179,7 @@ public:
 
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 public:
@@ -199,6 +199,14 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI Configuration")
     TSubclassOf<class UBlackboardAsset> BlackboardAsset;
 
+    // Utility actions used for tactical decisions; falls back to the built-in set when empty
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI Configuration")
+    UAIUtilityProfile* UtilityProfile = nullptr;
+
+    // Squad whose blackboard this agent shares; None groups agents by area
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI Configuration")
+    FName SquadId;
+
     // Current State
     UPROPERTY(BlueprintReadOnly, Category = "AI State")
     EAIBehaviorState CurrentBehaviorState = EAIBehaviorState::Patrol;
@@ -280,6 +288,21 @@ public:
     UFUNCTION(BlueprintCallable, Category = "AI Utility")
     void UpdateMemory();
 
+    // Blueprint views of the fixed-capacity memory
+    UFUNCTION(BlueprintCallable, Category = "AI Utility")
+    TArray<FVector> GetLastKnownEnemyPositions() const { return AIMemory.LastKnownEnemyPositions.ToArray(); }
+
+    UFUNCTION(BlueprintCallable, Category = "AI Utility")
+    TArray<FVector> GetInterestPoints() const { return AIMemory.InterestPoints.ToArray(); }
+
+    UFUNCTION(BlueprintCallable, Category = "AI Utility")
+    float GetRememberedThreat(AActor* Actor) const;
+
+    // Utility scoring
+    void GatherUtilityInputs(FAIUtilityInputBatch& Batch, int32 AgentIndex);
+    void ApplyUtilityDecision(EAIBehaviorState Decision);
+    const FAIUtilityScorer& GetUtilityScorer() const;
+
     // AI Optimization
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Optimization")
     FAIOptimizationSettings OptimizationSettings;
@@ -296,10 +319,8 @@ public:
     UPROPERTY(BlueprintReadOnly, Category = "Optimization")
     bool bIsTimeSliced = false;
 
-    // Static optimization management
+    // Static registry of active AI; time-sliced scheduling lives in UAILODScheduler
     static TArray<UAdvancedAISystem*> ActiveAISystems;
-    static int32 CurrentTimeSliceIndex;
-    static float TimeSliceStartTime;
 
     // AI Update Functions
     UFUNCTION(BlueprintCallable, Category = "AI|Optimization")
@@ -314,13 +335,16 @@ public:
     UFUNCTION(BlueprintCallable, Category = "AI|Optimization")
     float GetCurrentUpdateInterval() const;
 
+    UFUNCTION(BlueprintCallable, Category = "AI|Optimization")
+    EAILODLevel ComputeLODLevel(float Distance) const;
+
     UFUNCTION(BlueprintCallable, Category = "AI|Optimization")
     void RegisterForTimeSlicing();
 
     UFUNCTION(BlueprintCallable, Category = "AI|Optimization")
     void UnregisterFromTimeSlicing();
 
-    // Static time-slicing manager
+    // Pumps the per-world schedulers manually; they normally tick on their own
     UFUNCTION(BlueprintCallable, Category = "AI|Optimization", CallInEditor = true)
     static void ProcessTimeSlicedUpdates(float DeltaTime);
 
@@ -358,6 +382,12 @@ private:
     UPROPERTY()
     AAdvancedWeaponSystem* CurrentWeapon;
 
+    UPROPERTY()
+    class UAdvancedWeaponSystem* OwnerWeaponSystem;
+
+    UPROPERTY()
+    class UDamageComponent* HealthComponent;
+
     // Timers and counters
     float StateChangeTimer = 0.0f;
     float MemoryUpdateTimer = 0.0f;
@@ -365,6 +395,13 @@ private:
     float CombatTimer = 0.0f;
     float LastFireTime = 0.0f;
     
+    TArray<AActor*> PerceivedActorsScratch;
+    
+    // Shared patrol route around where the agent started
+    FVector PatrolHome = FVector::ZeroVector;
+    FAIPatrolLoopPtr PatrolLoop;
+    int32 PatrolLoopIndex = 0;
+    
     // Internal functions
     void InitializeAI();
     void UpdateBehaviorLogic(float DeltaTime);
@@ -12,6 +12,9 @@
 #include "../Components/DamageComponent.h"
 #include "../Components/InventoryComponent.h"
 #include "../Weapons/FPSWeapon.h"
+#include "AISquadBlackboard.h"
+#include "AdvancedAISystem.h"
+#include "AILODScheduler.h"
 
 AFPSAICharacter::AFPSAICharacter()
 {
@@ -82,6 +85,20 @@ void AFPSAICharacter::BeginPlay()
 		DamageComponent->OnDeath.AddDynamic(this, &AFPSAICharacter::OnAIDeath);
 	}
 
+	// Dormant AIs wake when their move finishes
+	BindMoveCompleted();
+
+	// Share sightings and visibility checks with nearby squad mates. An AdvancedAISystem has already
+	// joined its squad for us in its own BeginPlay, so only AIs without one register here
+	if (const UAdvancedAISystem* AISystem = FindComponentByClass<UAdvancedAISystem>())
+	{
+		SquadId = AISystem->SquadId;
+	}
+	else if (UAISquadBlackboard* Blackboard = UAISquadBlackboard::Get(this))
+	{
+		SquadId = Blackboard->RegisterMember(this, SquadId);
+	}
+
 	// Start with patrol if we have patrol points
 	if (PatrolPoints.Num() > 0)
 	{
@@ -93,6 +110,29 @@ void AFPSAICharacter::BeginPlay()
 	}
 }
 
+void AFPSAICharacter::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+	if (UAILODScheduler* Scheduler = UAILODScheduler::Get(this))
+	{
+		Scheduler->CancelWake(WakeHandle);
+	}
+	WakeHandle = 0;
+
+	if (UAISquadBlackboard* Blackboard = UAISquadBlackboard::Get(this))
+	{
+		Blackboard->UnregisterMember(this);
+	}
+
+	Super::EndPlay(EndPlayReason);
+}
+
+void AFPSAICharacter::PossessedBy(AController* NewController)
+{
+	Super::PossessedBy(NewController);
+
+	BindMoveCompleted();
+}
+
 void AFPSAICharacter::Tick(float DeltaTime)
 {
 	Super::Tick(DeltaTime);
@@ -107,10 +147,17 @@ void AFPSAICharacter::OnSeePlayer(APawn* Pawn)
 {
 	if (!Pawn || Pawn == this) return;
 
+	WakeUp();
+
 	// Check if this is a valid target
 	if (Pawn->IsA<AFPSAICharacter>() && Cast<AFPSAICharacter>(Pawn)->GetCurrentState() == EAIState::Dead)
 		return;
 
+	if (UAISquadBlackboard* Blackboard = UAISquadBlackboard::Get(this))
+	{
+		Blackboard->ReportSighting(this, Pawn, Pawn->GetActorLocation());
+	}
+
 	// React based on current state
 	switch (CurrentState)
 	{
@@ -156,6 +203,14 @@ void AFPSAICharacter::OnHearNoise(APawn* Instigator, const FVector& Location, fl
 {
 	if (!Instigator || Instigator == this) return;
 
+	WakeUp();
+
+	UAISquadBlackboard* Blackboard = UAISquadBlackboard::Get(this);
+	if (Blackboard && Volume > 0.5f)
+	{
+		Blackboard->ReportInterestPoint(this, Location);
+	}
+
 	// React based on current state and volume
 	switch (CurrentState)
 	{
@@ -175,10 +230,17 @@ void AFPSAICharacter::OnHearNoise(APawn* Instigator, const FVector& Location, fl
 			break;
 
 		case EAIState::Combat:
-			// If we lost visual contact, investigate noise
-			if (!CanSeeTarget(CurrentTarget))
+			// If we lost visual contact, investigate noise; the squad's last trace answers this when available
 			{
-				LastKnownTargetLocation = Location;
+				FAISquadSnapshotPtr Snapshot = Blackboard ? Blackboard->GetSnapshot(this) : FAISquadSnapshotPtr();
+				const bool bTargetVisible = (Snapshot.IsValid() && Snapshot->Target.Get() == CurrentTarget)
+					? Snapshot->bTargetVisible
+					: CanSeeTarget(CurrentTarget);
+
+				if (!bTargetVisible)
+				{
+					LastKnownTargetLocation = Location;
+				}
 			}
 			break;
 	}
@@ -191,6 +253,12 @@ void AFPSAICharacter::SetAIState(EAIState NewState)
 	EAIState PreviousState = CurrentState;
 	CurrentState = NewState;
 
+	// Only idle and patrolling AIs may sleep
+	if (NewState != EAIState::Idle && NewState != EAIState::Patrol)
+	{
+		WakeUp();
+	}
+
 	// Handle state transitions
 	switch (NewState)
 	{
@@ -239,6 +307,8 @@ void AFPSAICharacter::SetAIState(EAIState NewState)
 
 void AFPSAICharacter::UpdateAI(float DeltaTime)
 {
+	SyncWithSquad();
+
 	switch (CurrentState)
 	{
 		case EAIState::Idle:
@@ -276,6 +346,23 @@ void AFPSAICharacter::UpdateAI(float DeltaTime)
 
 void AFPSAICharacter::HandleIdleState(float DeltaTime)
 {
+	// Dormant variant of the per-frame rolls below: act once per wake-up, then sleep again
+	if (CanEnterDormancy())
+	{
+		FRotator NewRotation = GetActorRotation();
+		NewRotation.Yaw += FMath::RandRange(-45.0f, 45.0f);
+		SetActorRotation(NewRotation);
+
+		if (PatrolPoints.Num() > 0 && FMath::RandRange(0.0f, 1.0f) < 0.4f)
+		{
+			SetAIState(EAIState::Patrol);
+			return;
+		}
+
+		EnterDormancy(FMath::RandRange(1.0f, 2.5f));
+		return;
+	}
+
 	// Look around occasionally
 	if (FMath::RandRange(0.0f, 1.0f) < 0.01f) // 1% chance per frame
 	{
@@ -305,14 +392,29 @@ void AFPSAICharacter::HandlePatrolState(float DeltaTime)
 
 	if (DistanceToPatrolPoint < 100.0f) // Within 1 meter
 	{
-		// Wait at patrol point
-		GetWorld()->GetTimerManager().SetTimer(PatrolWaitTimer, 
-			this, &AFPSAICharacter::MoveToNextPatrolPoint, PatrolWaitTime, false);
+		// Wait at patrol point, asleep if allowed
+		if (CanEnterDormancy())
+		{
+			bAdvancePatrolOnWake = true;
+			EnterDormancy(PatrolWaitTime);
+		}
+		else if (!GetWorld()->GetTimerManager().IsTimerActive(PatrolWaitTimer))
+		{
+			GetWorld()->GetTimerManager().SetTimer(PatrolWaitTimer, 
+				this, &AFPSAICharacter::MoveToNextPatrolPoint, PatrolWaitTime, false);
+		}
 	}
 	else
 	{
-		// Move towards patrol point
+		// Move towards patrol point, sleeping until the move completes
 		MoveToLocation(CurrentPatrolPoint);
+
+		// A move that finished or failed straight away has already reported completion, so nothing would wake us
+		const AAIController* AIController = Cast<AAIController>(GetController());
+		if (CanEnterDormancy() && AIController && AIController->GetMoveStatus() == EPathFollowingStatus::Moving)
+		{
+			EnterDormancy(MaxDormantMoveTime);
+		}
 	}
 }
 
@@ -324,8 +426,25 @@ void AFPSAICharacter::HandleAlertState(float DeltaTime)
 		return;
 	}
 
-	// Check if we can see the target
-	if (CanSeeTarget(CurrentTarget))
+	// Check if we can see the target, reusing a squad mate's sighting from this refresh
+	FAISquadSnapshotPtr Snapshot;
+	if (UAISquadBlackboard* Blackboard = UAISquadBlackboard::Get(this))
+	{
+		Snapshot = Blackboard->GetSnapshot(this);
+	}
+
+	bool bTargetVisible = false;
+	if (Snapshot.IsValid() && Snapshot->Target.Get() == CurrentTarget && Snapshot->HasFreshTargetSighting(GetWorld()->GetTimeSeconds(), 0.25))
+	{
+		bTargetVisible = Snapshot->bTargetVisible;
+		FAIPerceptionStats::SharedVisibilityHits++;
+	}
+	else
+	{
+		bTargetVisible = CanSeeTarget(CurrentTarget);
+	}
+
+	if (bTargetVisible)
 	{
 		LastKnownTargetLocation = CurrentTarget->GetActorLocation();
 		LastTargetSeenTime = GetWorld()->GetTimeSeconds();
@@ -560,6 +679,8 @@ bool AFPSAICharacter::CanSeeTarget(AActor* Target)
 {
 	if (!Target) return false;
 
+	FAIPerceptionStats::LineOfSightTraces++;
+
 	FVector StartLocation = GetActorLocation() + FVector(0, 0, 50); // Eye level
 	FVector TargetLocation = Target->GetActorLocation() + FVector(0, 0, 50);
 
@@ -664,13 +785,72 @@ void AFPSAICharacter::MoveToCover()
 
 void AFPSAICharacter::MoveToLocation(FVector Location)
 {
+	AAIController* AIController = Cast<AAIController>(GetController());
+	if (!AIController) return;
+
+	// Already heading there; re-requesting would only restart path following
+	if (AIController->GetMoveStatus() == EPathFollowingStatus::Moving &&
+		FVector::DistSquared(CurrentMoveGoal, Location) < FMath::Square(50.0f))
+	{
+		return;
+	}
+
+	// Reuse a cached route when one exists for this start/goal
+	TArray<FVector> PathPoints;
+	UAIPathCache* PathCache = UAIPathCache::Get(this);
+	if (PathCache && PathCache->FindPath(GetActorLocation(), Location, GetCapsuleComponent()->GetScaledCapsuleRadius(), PathPoints, this))
+	{
+		if (FollowPath(PathPoints, Location))
+		{
+			return;
+		}
+	}
+
 	// Use AI Controller to move
+	AIController->MoveToLocation(Location);
+	CurrentMoveGoal = Location;
+}
+
+bool AFPSAICharacter::FollowPath(const TArray<FVector>& PathPoints, const FVector& Goal)
+{
+	AAIController* AIController = Cast<AAIController>(GetController());
+	if (!AIController || PathPoints.Num() < 2) return false;
+
+	// Cached routes match goals within a tolerance, so the route is finished at the exact goal
+	TArray<FVector> RoutePoints(PathPoints);
+	if (!RoutePoints.Last().Equals(Goal, 1.0f))
+	{
+		RoutePoints.Add(Goal);
+	}
+
+	// World-space route with no base actor; path following moves based points along with their base
+	FNavPathSharedPtr NavPath = MakeShared<FNavigationPath, ESPMode::ThreadSafe>(RoutePoints);
+
+	FAIMoveRequest MoveRequest(Goal);
+	MoveRequest.SetUsePathfinding(true);
+
+	if (!AIController->RequestMove(MoveRequest, NavPath).IsValid())
+	{
+		return false;
+	}
+
+	CurrentMoveGoal = Goal;
+	return true;
+}
+
+void AFPSAICharacter::BindMoveCompleted()
+{
 	if (AAIController* AIController = Cast<AAIController>(GetController()))
 	{
-		AIController->MoveToLocation(Location);
+		AIController->ReceiveMoveCompleted.AddUniqueDynamic(this, &AFPSAICharacter::OnMoveCompleted);
 	}
 }
 
+void AFPSAICharacter::OnMoveCompleted(FAIRequestID RequestID, EPathFollowingResult::Type Result)
+{
+	WakeUp();
+}
+
 void AFPSAICharacter::StopMovement()
 {
 	if (AAIController* AIController = Cast<AAIController>(GetController()))
@@ -718,7 +898,32 @@ void AFPSAICharacter::MoveToNextPatrolPoint()
 {
 	if (PatrolPoints.Num() == 0) return;
 
+	const int32 PreviousPatrolIndex = CurrentPatrolIndex;
 	CurrentPatrolIndex = (CurrentPatrolIndex + 1) % PatrolPoints.Num();
+
+	// Agents on the same route share one precomputed loop
+	UAIPathCache* PathCache = UAIPathCache::Get(this);
+	if (PathCache && PatrolPoints.Num() > 1)
+	{
+		if (!PatrolLoop.IsValid() || !PathCache->IsLoopCurrent(*PatrolLoop) || PatrolLoop->Legs.Num() != PatrolPoints.Num())
+		{
+			PatrolLoop = PathCache->GetPatrolLoop(PatrolPoints, GetCapsuleComponent()->GetScaledCapsuleRadius(), this);
+		}
+
+		if (PatrolLoop.IsValid() && PatrolLoop->Legs.IsValidIndex(PreviousPatrolIndex))
+		{
+			TArray<FVector> LegPoints = PatrolLoop->Legs[PreviousPatrolIndex];
+			if (LegPoints.Num() > 1)
+			{
+				LegPoints[0] = GetActorLocation();
+				if (FollowPath(LegPoints, PatrolPoints[CurrentPatrolIndex]))
+				{
+					return;
+				}
+			}
+		}
+	}
+
 	MoveToLocation(PatrolPoints[CurrentPatrolIndex]);
 }
 
@@ -811,6 +1016,8 @@ void AFPSAICharacter::UnequipWeapon()
 
 void AFPSAICharacter::OnTakeDamage(float Damage, EDamageType DamageType, FVector HitLocation, AActor* DamageDealer)
 {
+	WakeUp();
+
 	// React to taking damage
 	if (DamageDealer && DamageDealer != this)
 	{
@@ -845,6 +1052,60 @@ void AFPSAICharacter::OnAIDeath()
 	
 	// Stop all timers
 	GetWorld()->GetTimerManager().ClearAllTimersForObject(this);
+
+	if (UAILODScheduler* Scheduler = UAILODScheduler::Get(this))
+	{
+		Scheduler->CancelWake(WakeHandle);
+	}
+	WakeHandle = 0;
+
+	// Dead AIs no longer contribute to the squad
+	if (UAISquadBlackboard* Blackboard = UAISquadBlackboard::Get(this))
+	{
+		Blackboard->UnregisterMember(this);
+	}
+}
+
+void AFPSAICharacter::SyncWithSquad()
+{
+	UAISquadBlackboard* Blackboard = UAISquadBlackboard::Get(this);
+	FAISquadSnapshotPtr Snapshot = Blackboard ? Blackboard->GetSnapshot(this) : FAISquadSnapshotPtr();
+	if (!Snapshot.IsValid() || !Snapshot->Target.IsValid() || Snapshot->LastTargetSeenTime <= LastTargetSeenTime)
+	{
+		return;
+	}
+
+	AActor* SquadTarget = Snapshot->Target.Get();
+
+	// Already searching AIs pick up the squad's target; calm ones are merely alerted
+	switch (CurrentState)
+	{
+		case EAIState::Alert:
+		case EAIState::Searching:
+		case EAIState::Investigating:
+			CurrentTarget = SquadTarget;
+			break;
+
+		case EAIState::Idle:
+		case EAIState::Patrol:
+			if (!Snapshot->bTargetVisible)
+			{
+				return;
+			}
+			CurrentTarget = SquadTarget;
+			SetAIState(EAIState::Alert);
+			break;
+
+		default:
+			if (CurrentTarget != SquadTarget)
+			{
+				return;
+			}
+			break;
+	}
+
+	LastKnownTargetLocation = Snapshot->LastKnownTargetLocation;
+	LastTargetSeenTime = Snapshot->LastTargetSeenTime;
 }
 
 void AFPSAICharacter::AlertToLocation(FVector Location)
@@ -865,6 +1126,7 @@ void AFPSAICharacter::SetCombatStyle(EAICombatStyle NewStyle)
 void AFPSAICharacter::AddPatrolPoint(FVector Point)
 {
 	PatrolPoints.Add(Point);
+	PatrolLoop.Reset();
 }
 
 void AFPSAICharacter::SetAIStats(FAIStats NewStats)
@@ -879,3 +1141,54 @@ void AFPSAICharacter::SetAIStats(FAIStats NewStats)
 		PawnSensingComponent->LOSHearingThreshold = AIStats.HearingRange * 0.5f;
 	}
 }
+
+bool AFPSAICharacter::CanEnterDormancy() const
+{
+	// Only the LOD scheduler can wake a dormant AI; without one it keeps ticking
+	return bEnableDormancy && UAILODScheduler::Get(this) != nullptr;
+}
+
+void AFPSAICharacter::EnterDormancy(float WakeDelay)
+{
+	UAILODScheduler* Scheduler = UAILODScheduler::Get(this);
+	if (!Scheduler) return;
+
+	Scheduler->CancelWake(WakeHandle);
+	WakeHandle = Scheduler->ScheduleWake(WakeDelay, FSimpleDelegate::CreateUObject(this, &AFPSAICharacter::OnDormancyExpired));
+	if (WakeHandle == 0) return;
+
+	bDormant = true;
+	SetActorTickEnabled(false);
+}
+
+void AFPSAICharacter::WakeUp()
+{
+	if (!bDormant) return;
+
+	if (UAILODScheduler* Scheduler = UAILODScheduler::Get(this))
+	{
+		Scheduler->CancelWake(WakeHandle);
+	}
+	WakeHandle = 0;
+
+	bDormant = false;
+	bAdvancePatrolOnWake = false;
+	SetActorTickEnabled(true);
+}
+
+void AFPSAICharacter::OnDormancyExpired()
+{
+	WakeHandle = 0;
+
+	// Patrol waits end by heading to the next point, then ticking once to go back to sleep
+	if (bAdvancePatrolOnWake)
+	{
+		bAdvancePatrolOnWake = false;
+		if (CurrentState == EAIState::Patrol)
+		{
+			MoveToNextPatrolPoint();
+		}
+	}
+
+	WakeUp();
+}
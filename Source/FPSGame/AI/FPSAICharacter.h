@@ -12,6 +12,7 @@
 #include "../Components/DamageComponent.h"
 #include "../Components/InventoryComponent.h"
 #include "../Weapons/FPSWeapon.h"
+#include "AIPathCache.h"
 #include "FPSAICharacter.generated.h"
 
 UENUM(BlueprintType)
@@ -83,6 +84,7 @@ public:
 
 protected:
 	virtual void BeginPlay() override;
+	virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
 
 	// AI Components
 	UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
@@ -117,6 +119,18 @@ protected:
 	UPROPERTY(BlueprintReadOnly, Category = "AI")
 	float LastTargetSeenTime;
 
+	// Squad whose blackboard this AI shares; None groups AIs by area. An AdvancedAISystem component's SquadId takes precedence
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI")
+	FName SquadId;
+
+	// Idle and patrolling AIs stop ticking and wake on sensing, move completion or a scheduled time
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI")
+	bool bEnableDormancy = true;
+
+	// Longest a dormant AI waits on a move before re-checking it
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "AI")
+	float MaxDormantMoveTime = 2.0f;
+
 	// Patrol system
 	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Patrol")
 	TArray<FVector> PatrolPoints;
@@ -166,6 +180,7 @@ protected:
 	void StartCombat(AActor* Target);
 	void UpdateCombat(float DeltaTime);
 	bool CanSeeTarget(AActor* Target);
+	void SyncWithSquad();
 	bool IsInWeaponRange(AActor* Target);
 	void AimAtTarget(AActor* Target);
 	void FireAtTarget();
@@ -174,6 +189,16 @@ protected:
 
 	// Movement functions
 	void MoveToLocation(FVector Location);
+	void BindMoveCompleted();
+
+	UFUNCTION()
+	void OnMoveCompleted(FAIRequestID RequestID, EPathFollowingResult::Type Result);
+
+	// Dormancy
+	bool CanEnterDormancy() const;
+	void EnterDormancy(float WakeDelay);
+	void WakeUp();
+	void OnDormancyExpired();
 	void StopMovement();
 	void UpdateMovementSpeed();
 
@@ -195,6 +220,17 @@ protected:
 	void EquipWeapon(TSubclassOf<AFPSWeapon> WeaponClass);
 	void UnequipWeapon();
 
+	// Goal of the move currently being followed
+	FVector CurrentMoveGoal = FVector::ZeroVector;
+
+	// Shared precomputed route through PatrolPoints
+	FAIPatrolLoopPtr PatrolLoop;
+
+	// Dormancy state
+	bool bDormant = false;
+	bool bAdvancePatrolOnWake = false;
+	uint64 WakeHandle = 0;
+
 	// Timer handles
 	FTimerHandle PatrolWaitTimer;
 	FTimerHandle FireDelayTimer;
@@ -203,6 +239,7 @@ protected:
 
 public:
 	virtual void Tick(float DeltaTime) override;
+	virtual void PossessedBy(AController* NewController) override;
 
 	// Getters
 	UFUNCTION(BlueprintPure, Category = "AI")
@@ -217,6 +254,9 @@ public:
 	UFUNCTION(BlueprintPure, Category = "AI")
 	float GetAccuracy() const { return AIStats.Accuracy; }
 
+	UFUNCTION(BlueprintPure, Category = "AI")
+	bool IsDormant() const { return bDormant; }
+
 	// Damage handling
 	UFUNCTION()
 	void OnTakeDamage(float Damage, EDamageType DamageType, FVector HitLocation, AActor* DamageDealer);
@@ -236,4 +276,7 @@ public:
 
 	UFUNCTION(BlueprintCallable, Category = "AI")
 	void SetAIStats(FAIStats NewStats);
+
+	// Follows a precomputed route, e.g. from UAIPathCache, finishing at Goal
+	bool FollowPath(const TArray<FVector>& PathPoints, const FVector& Goal);
 };
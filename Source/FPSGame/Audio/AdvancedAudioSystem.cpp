@@ -7,6 +7,285 @@
 #include "GameFramework/PlayerController.h"
 #include "Camera/CameraComponent.h"
 #include "DrawDebugHelpers.h"
+#include "Optimization/FPSGameStats.h"
+
+namespace
+{
+	// Real voices per layer and the weight of the layer's priority where layers compete, in EAudioLayer order
+	const int32 DefaultMaxRealVoices[FAudioVoiceManager::NumLayers] = { 8, 4, 24, 8, 12, 8, 24 };
+	const float DefaultLayerPriority[FAudioVoiceManager::NumLayers] = { 1.0f, 2.0f, 1.0f, 1.5f, 0.6f, 2.0f, 1.2f };
+
+	// Real voices win close calls when ranked, so voices of similar priority don't swap every update
+	const float RealVoiceBias = 1.1f;
+
+	const float AmbientMinDistance = 100.0f;
+	const float AmbientMaxDistance = 5000.0f;
+}
+
+// FAudioVoiceManager
+
+FAudioVoiceManager::FAudioVoiceManager()
+{
+	for (int32 i = 0; i < NumLayers; i++)
+	{
+		Layers[i].MaxRealVoices = DefaultMaxRealVoices[i];
+		Layers[i].PriorityWeight = DefaultLayerPriority[i];
+	}
+}
+
+void FAudioVoiceManager::SetLayerLimit(EAudioLayer Layer, int32 InMaxRealVoices, float PriorityWeight)
+{
+	// Lowering a limit takes effect at the next Update
+	FLayerLimit& Limit = Layers[(int32)Layer];
+	Limit.MaxRealVoices = FMath::Max(0, InMaxRealVoices);
+	Limit.PriorityWeight = FMath::Max(0.0f, PriorityWeight);
+}
+
+FSlotHandle FAudioVoiceManager::Add(const FAudioVoice& Voice, const FVector& ListenerLocation, TArray<FAudioVoiceChange>& OutChanges)
+{
+	const FSlotHandle Handle = Slots.Add();
+	const int32 Index = Voices.Add(Voice);
+
+	FAudioVoice& NewVoice = Voices[Index];
+	NewVoice.Priority = CalculatePriority(NewVoice, ListenerLocation);
+	NewVoice.bReal = false;
+	NewVoice.Component.Reset();
+
+	const FLayerLimit& Limit = Layers[(int32)NewVoice.Layer];
+	if (NewVoice.Priority <= 0.0f || Limit.MaxRealVoices <= 0 || MaxRealVoices <= 0)
+	{
+		return Handle;
+	}
+
+	const bool bLayerFull = Limit.NumReal >= Limit.MaxRealVoices;
+	if (bLayerFull || RealVoices.Num() >= MaxRealVoices)
+	{
+		// Only a voice of the same layer frees a slot in a full layer; otherwise the quietest of any layer does
+		int32 Quietest = INDEX_NONE;
+		for (const FSlotHandle& RealHandle : RealVoices)
+		{
+			const int32 RealIndex = Slots.GetDenseIndex(RealHandle);
+			if (bLayerFull && Voices[RealIndex].Layer != NewVoice.Layer)
+			{
+				continue;
+			}
+			if (Quietest == INDEX_NONE || Voices[RealIndex].Priority < Voices[Quietest].Priority)
+			{
+				Quietest = RealIndex;
+			}
+		}
+
+		if (Quietest == INDEX_NONE || Voices[Quietest].Priority >= NewVoice.Priority)
+		{
+			return Handle;
+		}
+
+		SetReal(Quietest, false);
+
+		FAudioVoiceChange& Demoted = OutChanges.AddDefaulted_GetRef();
+		Demoted.Voice = Slots.GetHandle(Quietest);
+		Demoted.bPromoted = false;
+	}
+
+	SetReal(Index, true);
+
+	FAudioVoiceChange& Promoted = OutChanges.AddDefaulted_GetRef();
+	Promoted.Voice = Handle;
+	Promoted.bPromoted = true;
+	return Handle;
+}
+
+bool FAudioVoiceManager::Remove(FSlotHandle Handle)
+{
+	const int32 Index = Slots.GetDenseIndex(Handle);
+	if (Index == INDEX_NONE)
+	{
+		return false;
+	}
+
+	RemoveAt(Index);
+	return true;
+}
+
+void FAudioVoiceManager::RemoveLayer(EAudioLayer Layer)
+{
+	for (int32 i = Voices.Num() - 1; i >= 0; i--)
+	{
+		if (Voices[i].Layer == Layer)
+		{
+			RemoveAt(i);
+		}
+	}
+}
+
+FAudioVoice* FAudioVoiceManager::Find(FSlotHandle Handle)
+{
+	const int32 Index = Slots.GetDenseIndex(Handle);
+	return Index != INDEX_NONE ? &Voices[Index] : nullptr;
+}
+
+const FAudioVoice* FAudioVoiceManager::Find(FSlotHandle Handle) const
+{
+	const int32 Index = Slots.GetDenseIndex(Handle);
+	return Index != INDEX_NONE ? &Voices[Index] : nullptr;
+}
+
+int32 FAudioVoiceManager::Update(double Now, const FVector& ListenerLocation, TArray<FAudioVoiceChange>& OutChanges)
+{
+	// Walking down means a swap-remove only moves a voice that was already visited
+	int32 Dropped = 0;
+	for (int32 i = Voices.Num() - 1; i >= 0; i--)
+	{
+		FAudioVoice& Voice = Voices[i];
+		if (!Voice.bReal && !Voice.bLoop && Now - Voice.StartTime >= Voice.Duration)
+		{
+			RemoveAt(i);
+			Dropped++;
+			continue;
+		}
+
+		Voice.Priority = CalculatePriority(Voice, ListenerLocation);
+	}
+
+	Ranked.Reset();
+	for (int32 i = 0; i < Voices.Num(); i++)
+	{
+		if (Voices[i].Priority > 0.0f)
+		{
+			Ranked.Add(i);
+		}
+	}
+
+	Ranked.Sort([this](int32 A, int32 B)
+	{
+		const float PriorityA = Voices[A].Priority * (Voices[A].bReal ? RealVoiceBias : 1.0f);
+		const float PriorityB = Voices[B].Priority * (Voices[B].bReal ? RealVoiceBias : 1.0f);
+		return PriorityA > PriorityB;
+	});
+
+	TStaticArray<int32, NumLayers> LayerWanted;
+	for (int32& Count : LayerWanted)
+	{
+		Count = 0;
+	}
+
+	WantReal.Init(false, Voices.Num());
+	int32 NumWanted = 0;
+	for (int32 Index : Ranked)
+	{
+		if (NumWanted >= MaxRealVoices)
+		{
+			break;
+		}
+
+		const int32 Layer = (int32)Voices[Index].Layer;
+		if (LayerWanted[Layer] >= Layers[Layer].MaxRealVoices)
+		{
+			continue;
+		}
+
+		WantReal[Index] = true;
+		LayerWanted[Layer]++;
+		NumWanted++;
+	}
+
+	// Demotions come first so their components are stopped before the promoted voices start
+	for (int32 i = 0; i < Voices.Num(); i++)
+	{
+		if (Voices[i].bReal && !WantReal[i])
+		{
+			SetReal(i, false);
+
+			FAudioVoiceChange& Demoted = OutChanges.AddDefaulted_GetRef();
+			Demoted.Voice = Slots.GetHandle(i);
+			Demoted.bPromoted = false;
+		}
+	}
+
+	for (int32 i = 0; i < Voices.Num(); i++)
+	{
+		FAudioVoice& Voice = Voices[i];
+		if (!Voice.bReal && WantReal[i])
+		{
+			SetReal(i, true);
+
+			const float Elapsed = (float)FMath::Max(Now - Voice.StartTime, 0.0);
+			FAudioVoiceChange& Promoted = OutChanges.AddDefaulted_GetRef();
+			Promoted.Voice = Slots.GetHandle(i);
+			Promoted.bPromoted = true;
+			Promoted.StartOffset = Voice.bLoop && Voice.Duration > 0.0f ? FMath::Fmod(Elapsed, Voice.Duration) : Elapsed;
+		}
+	}
+
+	return Dropped;
+}
+
+float FAudioVoiceManager::CalculatePriority(const FAudioVoice& Voice, const FVector& ListenerLocation) const
+{
+	const float Attenuation = Voice.bIs3D
+		? CalculateAttenuation(FVector::Dist(Voice.Location, ListenerLocation), Voice.MinDistance, Voice.MaxDistance)
+		: 1.0f;
+
+	return Layers[(int32)Voice.Layer].PriorityWeight * Voice.Volume * Attenuation;
+}
+
+float FAudioVoiceManager::CalculateAttenuation(float Distance, float MinDistance, float MaxDistance)
+{
+	if (Distance <= MinDistance)
+	{
+		return 1.0f;
+	}
+	else if (Distance >= MaxDistance)
+	{
+		return 0.0f;
+	}
+	else
+	{
+		// Linear attenuation
+		return 1.0f - ((Distance - MinDistance) / (MaxDistance - MinDistance));
+	}
+}
+
+void FAudioVoiceManager::Reset()
+{
+	Slots.Reset();
+	Voices.Reset();
+	RealVoices.Reset();
+	for (FLayerLimit& Limit : Layers)
+	{
+		Limit.NumReal = 0;
+	}
+}
+
+void FAudioVoiceManager::SetReal(int32 DenseIndex, bool bReal)
+{
+	FAudioVoice& Voice = Voices[DenseIndex];
+	if (Voice.bReal == bReal)
+	{
+		return;
+	}
+
+	Voice.bReal = bReal;
+	if (bReal)
+	{
+		RealVoices.Add(Slots.GetHandle(DenseIndex));
+		Layers[(int32)Voice.Layer].NumReal++;
+	}
+	else
+	{
+		RealVoices.RemoveSingleSwap(Slots.GetHandle(DenseIndex), false);
+		Layers[(int32)Voice.Layer].NumReal--;
+	}
+}
+
+void FAudioVoiceManager::RemoveAt(int32 DenseIndex)
+{
+	SetReal(DenseIndex, false);
+	Slots.Remove(Slots.GetHandle(DenseIndex));
+	Voices.RemoveAtSwap(DenseIndex, 1, false);
+}
+
+// UAdvancedAudioSystem
 
 UAdvancedAudioSystem::UAdvancedAudioSystem()
 {
@@ -31,6 +310,13 @@ UAdvancedAudioSystem::UAdvancedAudioSystem()
 	// This is just example setup
 	CurrentMusicState = EMusicState::Menu;
 	CurrentEnvironment = EAudioEnvironment::None;
+
+	// Default voice limits
+	for (int32 i = 0; i < FAudioVoiceManager::NumLayers; i++)
+	{
+		MaxRealVoicesPerLayer.Add((EAudioLayer)i, VoiceManager.GetLayerMaxRealVoices((EAudioLayer)i));
+		LayerVoicePriority.Add((EAudioLayer)i, VoiceManager.GetLayerPriorityWeight((EAudioLayer)i));
+	}
 }
 
 void UAdvancedAudioSystem::BeginPlay()
@@ -45,6 +331,15 @@ void UAdvancedAudioSystem::BeginPlay()
 	{
 		ActiveAudioComponents.Add((EAudioLayer)i, TArray<UAudioComponent*>());
 	}
+
+	// Apply voice limits
+	VoiceManager.SetMaxRealVoices(MaxRealVoices);
+	for (int32 i = 0; i < FAudioVoiceManager::NumLayers; i++)
+	{
+		const int32* LayerMaxVoices = MaxRealVoicesPerLayer.Find((EAudioLayer)i);
+		const float* LayerPriority = LayerVoicePriority.Find((EAudioLayer)i);
+		VoiceManager.SetLayerLimit((EAudioLayer)i, LayerMaxVoices ? *LayerMaxVoices : MaxRealVoices, LayerPriority ? *LayerPriority : 1.0f);
+	}
 }
 
 void UAdvancedAudioSystem::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
@@ -56,6 +351,8 @@ void UAdvancedAudioSystem::TickComponent(float DeltaTime, ELevelTick TickType, F
 	// Update at reduced frequency for performance
 	if (TimeSinceLastUpdate >= AudioUpdateInterval)
 	{
+		FPSGAME_SCOPE_CYCLE_COUNTER(AudioUpdate);
+
 		TimeSinceLastUpdate = 0.0f;
 
 		// Update listener position
@@ -71,6 +368,11 @@ void UAdvancedAudioSystem::TickComponent(float DeltaTime, ELevelTick TickType, F
 			UpdateListenerLocation(NewLocation, NewRotation);
 		}
 
+		// Re-rank voices from the new listener position, promoting virtual voices that became audible
+		RemoveFinishedVoices();
+		VoiceManager.Update(GetWorld()->GetTimeSeconds(), LastListenerLocation, VoiceChanges);
+		ApplyVoiceChanges();
+
 		// Update music crossfade
 		if (bIsCrossfading)
 		{
@@ -187,54 +489,29 @@ float UAdvancedAudioSystem::GetLayerVolume(EAudioLayer Layer) const
 
 UAudioComponent* UAdvancedAudioSystem::PlaySoundAtLocation(const FAudioCue& AudioCue, const FVector& Location, const FRotator& Rotation)
 {
-	if (!AudioCue.SoundCue)
+	if (!AudioCue.SoundCue || !GetWorld())
 	{
 		return nullptr;
 	}
 
-	UAudioComponent* AudioComponent = UGameplayStatics::SpawnSoundAtLocation(
-		GetWorld(),
-		AudioCue.SoundCue,
-		Location,
-		Rotation,
-		AudioCue.Volume * GetVolumeForLayer(AudioCue.AudioLayer),
-		AudioCue.Pitch,
-		AudioCue.FadeInTime,
-		nullptr, // Attenuation will be handled manually
-		nullptr,
-		AudioCue.bAutoDestroy
-	);
-
-	if (AudioComponent)
-	{
-		// Configure 3D audio properties
-		if (AudioCue.bIs3D && AudioSettings.bEnable3DAudio)
-		{
-			AudioComponent->bAllowSpatialization = true;
-			AudioComponent->AttenuationOverrides.bAttenuate = true;
-			AudioComponent->AttenuationOverrides.bSpatialize = true;
-			AudioComponent->AttenuationOverrides.DistanceAlgorithm = EAttenuationDistanceModel::Linear;
-			AudioComponent->AttenuationOverrides.AttenuationShape = EAttenuationShape::Sphere;
-			AudioComponent->AttenuationOverrides.FalloffDistance = AudioCue.MaxDistance - AudioCue.MinDistance;
-			AudioComponent->AttenuationOverrides.AttenuationShapeExtents = FVector(AudioCue.MaxDistance);
-		}
-		else
-		{
-			AudioComponent->bAllowSpatialization = false;
-			AudioComponent->AttenuationOverrides.bAttenuate = false;
-		}
-
-		// Add to active components
-		if (ActiveAudioComponents.Contains(AudioCue.AudioLayer))
-		{
-			ActiveAudioComponents[AudioCue.AudioLayer].Add(AudioComponent);
-		}
-
-		// Apply layer volume
-		ApplyLayerVolumeToComponent(AudioComponent, AudioCue.AudioLayer);
-	}
-
-	return AudioComponent;
+	FAudioVoice Voice;
+	Voice.Sound = AudioCue.SoundCue;
+	Voice.Layer = AudioCue.AudioLayer;
+	Voice.Location = Location;
+	Voice.Rotation = Rotation;
+	Voice.Volume = AudioCue.Volume;
+	Voice.Pitch = AudioCue.Pitch;
+	Voice.MinDistance = AudioCue.MinDistance;
+	Voice.MaxDistance = AudioCue.MaxDistance;
+	Voice.bIs3D = AudioCue.bIs3D && AudioSettings.bEnable3DAudio;
+	Voice.bLoop = AudioCue.bLoop || AudioCue.SoundCue->IsLooping();
+	Voice.bAutoDestroy = AudioCue.bAutoDestroy;
+	Voice.Duration = AudioCue.SoundCue->GetDuration();
+	Voice.StartTime = GetWorld()->GetTimeSeconds();
+
+	// Over the layer's voice limit the sound plays virtually, with no component to return
+	const FAudioVoice* Playing = VoiceManager.Find(PlayVoice(Voice));
+	return Playing ? Playing->Component.Get() : nullptr;
 }
 
 UAudioComponent* UAdvancedAudioSystem::PlaySoundAttached(const FAudioCue& AudioCue, USceneComponent* AttachToComponent, const FVector& LocationOffset)
@@ -450,7 +727,7 @@ void UAdvancedAudioSystem::ResumeMusic()
 
 void UAdvancedAudioSystem::AddAmbientSound(const FString& SoundName, USoundCue* SoundCue, const FVector& Location, float Volume)
 {
-	if (!SoundCue)
+	if (!SoundCue || !GetWorld())
 	{
 		return;
 	}
@@ -465,30 +742,25 @@ void UAdvancedAudioSystem::AddAmbientSound(const FString& SoundName, USoundCue*
 	AmbientInfo.Volume = Volume;
 	AmbientInfo.bIsActive = true;
 
-	// Spawn audio component
-	AmbientInfo.AudioComponent = UGameplayStatics::SpawnSoundAtLocation(
-		GetWorld(),
-		SoundCue,
-		Location,
-		FRotator::ZeroRotator,
-		Volume * AudioSettings.AmbientVolume * AudioSettings.MasterVolume,
-		1.0f,
-		0.0f,
-		nullptr,
-		nullptr,
-		false // Don't auto-destroy
-	);
-
-	if (AmbientInfo.AudioComponent)
+	FAudioVoice Voice;
+	Voice.Sound = SoundCue;
+	Voice.Layer = EAudioLayer::Ambient;
+	Voice.Location = Location;
+	Voice.Volume = Volume;
+	Voice.MinDistance = AmbientMinDistance;
+	Voice.MaxDistance = AmbientMaxDistance;
+	Voice.bIs3D = AudioSettings.bEnable3DAudio;
+	Voice.bLoop = SoundCue->IsLooping();
+	Voice.bAutoDestroy = false; // Don't auto-destroy
+	Voice.Duration = SoundCue->GetDuration();
+	Voice.StartTime = GetWorld()->GetTimeSeconds();
+
+	// A virtual ambient sound is still added; its AudioComponent follows the voice as it is promoted and demoted
+	AmbientInfo.Voice = PlayVoice(Voice);
+	if (const FAudioVoice* Playing = VoiceManager.Find(AmbientInfo.Voice))
 	{
-		AmbientInfo.AudioComponent->bAllowSpatialization = true;
+		AmbientInfo.AudioComponent = Playing->Component.Get();
 		AmbientSounds.Add(SoundName, AmbientInfo);
-
-		// Add to active components
-		if (ActiveAudioComponents.Contains(EAudioLayer::Ambient))
-		{
-			ActiveAudioComponents[EAudioLayer::Ambient].Add(AmbientInfo.AudioComponent);
-		}
 	}
 }
 
@@ -497,15 +769,10 @@ void UAdvancedAudioSystem::RemoveAmbientSound(const FString& SoundName)
 	if (AmbientSounds.Contains(SoundName))
 	{
 		FAmbientSoundInfo& AmbientInfo = AmbientSounds[SoundName];
-		if (AmbientInfo.AudioComponent && IsValid(AmbientInfo.AudioComponent))
+		if (FAudioVoice* Voice = VoiceManager.Find(AmbientInfo.Voice))
 		{
-			AmbientInfo.AudioComponent->Stop();
-			
-			// Remove from active components
-			if (ActiveAudioComponents.Contains(EAudioLayer::Ambient))
-			{
-				ActiveAudioComponents[EAudioLayer::Ambient].Remove(AmbientInfo.AudioComponent);
-			}
+			StopVoiceComponent(*Voice);
+			VoiceManager.Remove(AmbientInfo.Voice);
 		}
 		AmbientSounds.Remove(SoundName);
 	}
@@ -517,6 +784,11 @@ void UAdvancedAudioSystem::SetAmbientSoundVolume(const FString& SoundName, float
 	{
 		FAmbientSoundInfo& AmbientInfo = AmbientSounds[SoundName];
 		AmbientInfo.Volume = Volume;
+
+		if (FAudioVoice* Voice = VoiceManager.Find(AmbientInfo.Voice))
+		{
+			Voice->Volume = Volume;
+		}
 		
 		if (AmbientInfo.AudioComponent && IsValid(AmbientInfo.AudioComponent))
 		{
@@ -533,6 +805,11 @@ void UAdvancedAudioSystem::SetAmbientSoundLocation(const FString& SoundName, con
 	{
 		FAmbientSoundInfo& AmbientInfo = AmbientSounds[SoundName];
 		AmbientInfo.Location = NewLocation;
+
+		if (FAudioVoice* Voice = VoiceManager.Find(AmbientInfo.Voice))
+		{
+			Voice->Location = NewLocation;
+		}
 		
 		if (AmbientInfo.AudioComponent && IsValid(AmbientInfo.AudioComponent))
 		{
@@ -607,6 +884,9 @@ void UAdvancedAudioSystem::StopAllSounds()
 		LayerPair.Value.Empty();
 	}
 
+	// Virtual voices have nothing playing; dropping their records is enough
+	VoiceManager.Reset();
+
 	// Stop music
 	StopMusic(0.0f);
 
@@ -634,6 +914,8 @@ void UAdvancedAudioSystem::StopSoundsByLayer(EAudioLayer Layer)
 		}
 		ActiveAudioComponents[Layer].Empty();
 	}
+
+	VoiceManager.RemoveLayer(Layer);
 }
 
 void UAdvancedAudioSystem::FadeAllSounds(float FadeTime, float TargetVolume)
@@ -652,21 +934,7 @@ void UAdvancedAudioSystem::FadeAllSounds(float FadeTime, float TargetVolume)
 
 float UAdvancedAudioSystem::CalculateDistanceAttenuation(const FVector& SoundLocation, const FVector& ListenerLocation, float MinDistance, float MaxDistance) const
 {
-	float Distance = FVector::Dist(SoundLocation, ListenerLocation);
-	
-	if (Distance <= MinDistance)
-	{
-		return 1.0f;
-	}
-	else if (Distance >= MaxDistance)
-	{
-		return 0.0f;
-	}
-	else
-	{
-		// Linear attenuation
-		return 1.0f - ((Distance - MinDistance) / (MaxDistance - MinDistance));
-	}
+	return FAudioVoiceManager::CalculateAttenuation(FVector::Dist(SoundLocation, ListenerLocation), MinDistance, MaxDistance);
 }
 
 bool UAdvancedAudioSystem::IsLocationOccluded(const FVector& SoundLocation, const FVector& ListenerLocation) const
@@ -704,6 +972,12 @@ void UAdvancedAudioSystem::UpdateListenerLocation(const FVector& Location, const
 	}
 }
 
+void UAdvancedAudioSystem::SetMaxRealVoices(EAudioLayer Layer, int32 MaxVoices)
+{
+	MaxRealVoicesPerLayer.Add(Layer, MaxVoices);
+	VoiceManager.SetLayerLimit(Layer, MaxVoices, VoiceManager.GetLayerPriorityWeight(Layer));
+}
+
 // Voice chat functions
 void UAdvancedAudioSystem::SetVoiceChatEnabled(bool bEnabled)
 {
@@ -847,6 +1121,145 @@ void UAdvancedAudioSystem::CleanupFinishedAudioComponents()
 	}
 }
 
+FSlotHandle UAdvancedAudioSystem::PlayVoice(const FAudioVoice& Voice)
+{
+	VoiceChanges.Reset();
+	const FSlotHandle Handle = VoiceManager.Add(Voice, LastListenerLocation, VoiceChanges);
+	ApplyVoiceChanges();
+	return Handle;
+}
+
+void UAdvancedAudioSystem::ApplyVoiceChanges()
+{
+	for (const FAudioVoiceChange& Change : VoiceChanges)
+	{
+		FAudioVoice* Voice = VoiceManager.Find(Change.Voice);
+		if (!Voice)
+		{
+			continue;
+		}
+
+		UAudioComponent* AudioComponent = nullptr;
+		if (Change.bPromoted)
+		{
+			AudioComponent = SpawnVoiceComponent(*Voice, Change.StartOffset);
+		}
+		else
+		{
+			StopVoiceComponent(*Voice);
+		}
+
+		if (Voice->Layer == EAudioLayer::Ambient)
+		{
+			for (auto& AmbientPair : AmbientSounds)
+			{
+				if (AmbientPair.Value.Voice == Change.Voice)
+				{
+					AmbientPair.Value.AudioComponent = AudioComponent;
+				}
+			}
+		}
+
+		// A voice that could not start would otherwise hold a real voice with nothing playing
+		if (Change.bPromoted && !AudioComponent)
+		{
+			VoiceManager.Remove(Change.Voice);
+		}
+	}
+
+	VoiceChanges.Reset();
+}
+
+UAudioComponent* UAdvancedAudioSystem::SpawnVoiceComponent(FAudioVoice& Voice, float StartOffset)
+{
+	USoundBase* Sound = Voice.Sound.Get();
+	if (!Sound)
+	{
+		return nullptr;
+	}
+
+	UAudioComponent* AudioComponent = UGameplayStatics::SpawnSoundAtLocation(
+		GetWorld(),
+		Sound,
+		Voice.Location,
+		Voice.Rotation,
+		Voice.Volume * GetVolumeForLayer(Voice.Layer),
+		Voice.Pitch,
+		StartOffset,
+		nullptr, // Attenuation will be handled manually
+		nullptr,
+		Voice.bAutoDestroy
+	);
+
+	if (!AudioComponent)
+	{
+		return nullptr;
+	}
+
+	// Configure 3D audio properties
+	if (Voice.bIs3D)
+	{
+		AudioComponent->bAllowSpatialization = true;
+		AudioComponent->AttenuationOverrides.bAttenuate = true;
+		AudioComponent->AttenuationOverrides.bSpatialize = true;
+		AudioComponent->AttenuationOverrides.DistanceAlgorithm = EAttenuationDistanceModel::Linear;
+		AudioComponent->AttenuationOverrides.AttenuationShape = EAttenuationShape::Sphere;
+		AudioComponent->AttenuationOverrides.FalloffDistance = Voice.MaxDistance - Voice.MinDistance;
+		AudioComponent->AttenuationOverrides.AttenuationShapeExtents = FVector(Voice.MaxDistance);
+	}
+	else
+	{
+		AudioComponent->bAllowSpatialization = false;
+		AudioComponent->AttenuationOverrides.bAttenuate = false;
+	}
+
+	// Add to active components
+	if (ActiveAudioComponents.Contains(Voice.Layer))
+	{
+		ActiveAudioComponents[Voice.Layer].Add(AudioComponent);
+	}
+
+	Voice.Component = AudioComponent;
+	return AudioComponent;
+}
+
+void UAdvancedAudioSystem::StopVoiceComponent(FAudioVoice& Voice)
+{
+	UAudioComponent* AudioComponent = Voice.Component.Get();
+	Voice.Component.Reset();
+
+	if (!AudioComponent || !IsValid(AudioComponent))
+	{
+		return;
+	}
+
+	if (ActiveAudioComponents.Contains(Voice.Layer))
+	{
+		ActiveAudioComponents[Voice.Layer].Remove(AudioComponent);
+	}
+
+	AudioComponent->Stop();
+	if (!Voice.bAutoDestroy)
+	{
+		AudioComponent->DestroyComponent();
+	}
+}
+
+void UAdvancedAudioSystem::RemoveFinishedVoices()
+{
+	// A real voice ends with its component, freeing the voice for a virtual one
+	const TArray<FSlotHandle>& RealVoices = VoiceManager.GetRealVoices();
+	for (int32 i = RealVoices.Num() - 1; i >= 0; i--)
+	{
+		const FAudioVoice* Voice = VoiceManager.Find(RealVoices[i]);
+		UAudioComponent* AudioComp = Voice ? Voice->Component.Get() : nullptr;
+		if (!AudioComp || !IsValid(AudioComp) || !AudioComp->IsPlaying())
+		{
+			VoiceManager.Remove(RealVoices[i]);
+		}
+	}
+}
+
 float UAdvancedAudioSystem::GetVolumeForLayer(EAudioLayer Layer) const
 {
 	float LayerVolume = 1.0f;
@@ -7,6 +7,7 @@
 #include "Sound/SoundAttenuation.h"
 #include "Engine/Engine.h"
 #include "Kismet/GameplayStatics.h"
+#include "../Optimization/SlotMap.h"
 #include "AdvancedAudioSystem.generated.h"
 
 UENUM(BlueprintType)
@@ -179,6 +180,112 @@ struct FAmbientSoundInfo
 
 	UPROPERTY(EditAnywhere, BlueprintReadWrite)
 	UAudioComponent* AudioComponent = nullptr;
+
+	// Voice playing this sound; AudioComponent is null while the voice is virtual
+	FSlotHandle Voice;
+};
+
+// Sound tracked by the voice manager; only real voices have a component playing
+struct FAudioVoice
+{
+	TWeakObjectPtr<USoundBase> Sound;
+	TWeakObjectPtr<UAudioComponent> Component;
+	EAudioLayer Layer = EAudioLayer::SFX;
+	FVector Location = FVector::ZeroVector;
+	FRotator Rotation = FRotator::ZeroRotator;
+	float Volume = 1.0f;
+	float Pitch = 1.0f;
+	float MinDistance = 100.0f;
+	float MaxDistance = 1000.0f;
+	bool bIs3D = true;
+	bool bLoop = false;
+	bool bAutoDestroy = true;
+
+	// Seconds per play; a virtual voice that does not loop is dropped once it has run this long
+	float Duration = 0.0f;
+	double StartTime = 0.0;
+	float Priority = 0.0f;
+	bool bReal = false;
+};
+
+struct FAudioVoiceChange
+{
+	FSlotHandle Voice;
+	bool bPromoted = false;
+
+	// Playback position to resume from when promoted
+	float StartOffset = 0.0f;
+};
+
+/**
+ * Every sound played through the audio system, capped to a number of real voices per layer and overall.
+ * Voices over a cap stay virtual: a record of the sound and when it started, promoted back at its current
+ * playback position once it ranks among the loudest. Priority is layer weight x volume x distance attenuation.
+ */
+class FPSGAME_API FAudioVoiceManager
+{
+public:
+	static constexpr int32 NumLayers = (int32)EAudioLayer::Weapon + 1;
+
+	FAudioVoiceManager();
+
+	void SetMaxRealVoices(int32 InMaxRealVoices) { MaxRealVoices = FMath::Max(0, InMaxRealVoices); }
+	int32 GetMaxRealVoices() const { return MaxRealVoices; }
+
+	void SetLayerLimit(EAudioLayer Layer, int32 InMaxRealVoices, float PriorityWeight);
+	int32 GetLayerMaxRealVoices(EAudioLayer Layer) const { return Layers[(int32)Layer].MaxRealVoices; }
+	float GetLayerPriorityWeight(EAudioLayer Layer) const { return Layers[(int32)Layer].PriorityWeight; }
+
+	// Starts the voice real if its layer has room or it outranks the quietest real voice that would free one, which is demoted
+	FSlotHandle Add(const FAudioVoice& Voice, const FVector& ListenerLocation, TArray<FAudioVoiceChange>& OutChanges);
+
+	// Returns false for a stale handle
+	bool Remove(FSlotHandle Handle);
+	void RemoveLayer(EAudioLayer Layer);
+
+	FAudioVoice* Find(FSlotHandle Handle);
+	const FAudioVoice* Find(FSlotHandle Handle) const;
+
+	/**
+	 * Drops virtual voices that have finished and re-ranks the rest from the listener, appending the demotions
+	 * and then the promotions that keep the highest audible priorities real. Returns the number dropped.
+	 */
+	int32 Update(double Now, const FVector& ListenerLocation, TArray<FAudioVoiceChange>& OutChanges);
+
+	const TArray<FSlotHandle>& GetRealVoices() const { return RealVoices; }
+
+	int32 Num() const { return Voices.Num(); }
+	int32 GetNumReal() const { return RealVoices.Num(); }
+	int32 GetNumReal(EAudioLayer Layer) const { return Layers[(int32)Layer].NumReal; }
+	int32 GetNumVirtual() const { return Voices.Num() - RealVoices.Num(); }
+
+	float CalculatePriority(const FAudioVoice& Voice, const FVector& ListenerLocation) const;
+
+	// Linear falloff from 1 at MinDistance to 0 at MaxDistance
+	static float CalculateAttenuation(float Distance, float MinDistance, float MaxDistance);
+
+	void Reset();
+
+private:
+	struct FLayerLimit
+	{
+		int32 MaxRealVoices = 0;
+		float PriorityWeight = 1.0f;
+		int32 NumReal = 0;
+	};
+
+	TStaticArray<FLayerLimit, NumLayers> Layers;
+	int32 MaxRealVoices = 64;
+	FSlotMap Slots;
+	TArray<FAudioVoice> Voices;
+	TArray<FSlotHandle> RealVoices;
+
+	// Update scratch, kept to avoid reallocating every pass
+	TArray<int32> Ranked;
+	TBitArray<> WantReal;
+
+	void SetReal(int32 DenseIndex, bool bReal);
+	void RemoveAt(int32 DenseIndex);
 };
 
 UCLASS(ClassGroup=(Custom), meta=(BlueprintSpawnableComponent))
@@ -283,6 +390,16 @@ public:
 	UFUNCTION(BlueprintCallable, Category = "Audio")
 	void UpdateListenerLocation(const FVector& Location, const FRotator& Rotation);
 
+	// Voice management
+	UFUNCTION(BlueprintCallable, Category = "Voices")
+	void SetMaxRealVoices(EAudioLayer Layer, int32 MaxVoices);
+
+	UFUNCTION(BlueprintPure, Category = "Voices")
+	int32 GetRealVoiceCount() const { return VoiceManager.GetNumReal(); }
+
+	UFUNCTION(BlueprintPure, Category = "Voices")
+	int32 GetVirtualVoiceCount() const { return VoiceManager.GetNumVirtual(); }
+
 	// Voice chat
 	UFUNCTION(BlueprintCallable, Category = "Voice")
 	void SetVoiceChatEnabled(bool bEnabled);
@@ -339,6 +456,20 @@ protected:
 	UPROPERTY(BlueprintReadOnly, Category = "Voice")
 	TSet<FString> MutedPlayers;
 
+	// Real voices allowed per layer; sounds over the limit play virtually until they outrank a real one
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Voices")
+	TMap<EAudioLayer, int32> MaxRealVoicesPerLayer;
+
+	// Scales a layer's priority where layers compete for MaxRealVoices
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Voices")
+	TMap<EAudioLayer, float> LayerVoicePriority;
+
+	UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Voices")
+	int32 MaxRealVoices = 64;
+
+	FAudioVoiceManager VoiceManager;
+	TArray<FAudioVoiceChange> VoiceChanges;
+
 	// Audio processing
 	void ProcessOcclusion(UAudioComponent* AudioComponent, const FVector& SoundLocation);
 	void ProcessDopplerEffect(UAudioComponent* AudioComponent, const FVector& SoundLocation, const FVector& SoundVelocity);
@@ -346,6 +477,13 @@ protected:
 	void UpdateMusicCrossfade(float DeltaTime);
 	void CleanupFinishedAudioComponents();
 
+	// Voice management
+	FSlotHandle PlayVoice(const FAudioVoice& Voice);
+	void ApplyVoiceChanges();
+	UAudioComponent* SpawnVoiceComponent(FAudioVoice& Voice, float StartOffset);
+	void StopVoiceComponent(FAudioVoice& Voice);
+	void RemoveFinishedVoices();
+
 	// Helper functions
 	float GetVolumeForLayer(EAudioLayer Layer) const;
 	USoundAttenuation* GetAttenuationSettingsForEnvironment(EAudioEnvironment Environment);
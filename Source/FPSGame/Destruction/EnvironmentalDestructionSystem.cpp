@@ -12,6 +12,7 @@
 #include "DrawDebugHelpers.h"
 #include "Particles/ParticleSystemComponent.h"
 #include "Components/AudioComponent.h"
+#include "Optimization/FPSGameStats.h"
 
 UEnvironmentalDestructionSystem::UEnvironmentalDestructionSystem()
 {
@@ -261,6 +262,8 @@ void UEnvironmentalDestructionSystem::SetDestructionProperties(const FDestructio
 
 void UEnvironmentalDestructionSystem::CreateDestructionChunks(int32 NumChunks, float MinChunkSize, float MaxChunkSize)
 {
+	FPSGAME_SCOPE_CYCLE_COUNTER(DestructionChunks);
+
 	if (!OriginalMesh || !OriginalStaticMesh)
 	{
 		return;
@@ -414,6 +417,8 @@ void UEnvironmentalDestructionSystem::ApplyImpactForce(FDestructionChunk& Chunk,
 
 void UEnvironmentalDestructionSystem::UpdateChunks(float DeltaTime)
 {
+	FPSGAME_SCOPE_CYCLE_COUNTER(DestructionChunks);
+
 	for (int32 i = DestructionChunks.Num() - 1; i >= 0; i--)
 	{
 		FDestructionChunk& Chunk = DestructionChunks[i];
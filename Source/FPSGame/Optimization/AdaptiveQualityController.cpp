@@ -0,0 +1,123 @@
+#include "AdaptiveQualityController.h"
+
+namespace
+{
+    // Share of the reduction a knob takes even when its measured cost is negligible
+    const float MinKnobWeight = 0.25f;
+
+    // Render-bound frames: game-thread knobs help little, draw distance helps most
+    const float RenderBoundWeights[(int32)EQualityKnob::Count] = { 0.25f, 0.5f, 1.0f, 1.0f };
+}
+
+FAdaptiveQualityController::FAdaptiveQualityController()
+{
+    Reset();
+}
+
+void FAdaptiveQualityController::Reset()
+{
+    for (float& Level : Levels)
+    {
+        Level = 1.0f;
+    }
+    IntegralError = 0.0f;
+    LastError = 0.0f;
+    bHasLastError = false;
+}
+
+FAdaptiveQualityDecision FAdaptiveQualityController::Update(const FAdaptiveQualityInput& Input)
+{
+    FAdaptiveQualityDecision Decision;
+    FMemory::Memcpy(Decision.Levels, Levels, sizeof(Levels));
+
+    if (Input.TargetFrameTimeMs <= 0.0f || Input.FrameTimeMs <= 0.0f)
+    {
+        return Decision;
+    }
+
+    const float MinLevel = FMath::Clamp(Settings.MinLevel, 0.0f, 1.0f);
+    const float MaxLevel = FMath::Clamp(Input.MaxLevel, MinLevel, 1.0f);
+    const float DeltaSeconds = FMath::Max(Input.DeltaSeconds, KINDA_SMALL_NUMBER);
+
+    // Positive while frames are slower than the target
+    Decision.Error = (Input.FrameTimeMs - Input.TargetFrameTimeMs) / Input.TargetFrameTimeMs;
+
+    float Derivative = 0.0f;
+    if (FMath::Abs(Decision.Error) > Settings.Deadband)
+    {
+        IntegralError += Decision.Error * DeltaSeconds;
+        if (bHasLastError)
+        {
+            Derivative = (Decision.Error - LastError) / DeltaSeconds;
+        }
+
+        Decision.Proportional = Settings.ProportionalGain * Decision.Error;
+        Decision.Derivative = Settings.DerivativeGain * Derivative;
+    }
+    LastError = Decision.Error;
+    bHasLastError = true;
+
+    // The integrator alone holds the reduction once on target; clamp it to the range it can use
+    const float MaxReduction = 1.0f - MinLevel;
+    IntegralError = Settings.IntegralGain > 0.0f ? FMath::Clamp(IntegralError, 0.0f, MaxReduction / Settings.IntegralGain) : 0.0f;
+    Decision.Integral = Settings.IntegralGain * IntegralError;
+
+    const float Reduction = FMath::Clamp(Decision.Proportional + Decision.Integral + Decision.Derivative, 0.0f, MaxReduction);
+    Decision.QualityLevel = 1.0f - Reduction;
+
+    // The most expensive knob takes the whole reduction, the others in proportion to their cost
+    float Weights[(int32)EQualityKnob::Count];
+    Decision.bRenderBound = Input.GameThreadMs > 0.0f && Input.GameThreadMs < Input.FrameTimeMs * Settings.RenderBoundGameThreadRatio;
+    if (Decision.bRenderBound)
+    {
+        FMemory::Memcpy(Weights, RenderBoundWeights, sizeof(Weights));
+    }
+    else
+    {
+        float MaxCost = 0.0f;
+        for (int32 Knob = 0; Knob < (int32)EQualityKnob::Count; ++Knob)
+        {
+            MaxCost = FMath::Max(MaxCost, Input.KnobCostMs[Knob]);
+        }
+
+        for (int32 Knob = 0; Knob < (int32)EQualityKnob::Count; ++Knob)
+        {
+            Weights[Knob] = MaxCost > KINDA_SMALL_NUMBER ? FMath::Max(MinKnobWeight, Input.KnobCostMs[Knob] / MaxCost) : 1.0f;
+        }
+    }
+
+    for (int32 Knob = 0; Knob < (int32)EQualityKnob::Count; ++Knob)
+    {
+        const float Target = FMath::Clamp(1.0f - Reduction * Weights[Knob], MinLevel, MaxLevel);
+        const float Delta = Target - Levels[Knob];
+
+        // Small corrections wait until they add up, except the last step onto a bound
+        const bool bReachesBound = Target >= MaxLevel || Target <= MinLevel;
+        if (FMath::Abs(Delta) <= KINDA_SMALL_NUMBER || (FMath::Abs(Delta) < Settings.MinLevelChange && !bReachesBound))
+        {
+            continue;
+        }
+
+        const float Step = Delta < 0.0f
+            ? FMath::Max(Delta, -Settings.MaxLevelChange)
+            : FMath::Min(Delta, Settings.MaxLevelChange * Settings.RecoveryRate);
+
+        Levels[Knob] = FMath::Clamp(Levels[Knob] + Step, MinLevel, 1.0f);
+        Decision.Levels[Knob] = Levels[Knob];
+        Decision.bChanged = true;
+    }
+
+    return Decision;
+}
+
+const TCHAR* FAdaptiveQualityController::GetKnobName(EQualityKnob Knob)
+{
+    switch (Knob)
+    {
+        case EQualityKnob::AIUpdates:       return TEXT("AIUpdates");
+        case EQualityKnob::EffectBudget:    return TEXT("EffectBudget");
+        case EQualityKnob::LODDistance:     return TEXT("LODDistance");
+        case EQualityKnob::CullingDistance: return TEXT("CullingDistance");
+        default:                            return TEXT("Unknown");
+    }
+}
@@ -0,0 +1,111 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "AdaptiveQualityController.generated.h"
+
+// Quality knobs the controller drives; each runs from MinLevel (cheapest) to 1 (authored quality)
+enum class EQualityKnob : uint8
+{
+    AIUpdates,
+    EffectBudget,
+    LODDistance,
+    CullingDistance,
+    Count
+};
+
+USTRUCT(BlueprintType)
+struct FAdaptiveQualitySettings
+{
+    GENERATED_BODY()
+
+    // PID gains on the frame-time error as a fraction of the target frame time
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Adaptive Quality")
+    float ProportionalGain = 0.6f;
+
+    // Per second of accumulated error
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Adaptive Quality")
+    float IntegralGain = 0.4f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Adaptive Quality")
+    float DerivativeGain = 0.05f;
+
+    // Errors within this fraction of the target are treated as on target and the integrator holds
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Adaptive Quality")
+    float Deadband = 0.05f;
+
+    // Knobs only move once their target differs from the applied level by at least this much
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Adaptive Quality")
+    float MinLevelChange = 0.05f;
+
+    // Largest level drop per update; raises are limited to this times RecoveryRate
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Adaptive Quality")
+    float MaxLevelChange = 0.2f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Adaptive Quality")
+    float RecoveryRate = 0.25f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Adaptive Quality")
+    float MinLevel = 0.3f;
+
+    // Frames whose game thread is below this fraction of the frame are treated as render bound
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Adaptive Quality")
+    float RenderBoundGameThreadRatio = 0.7f;
+};
+
+// What the controller sees each update
+struct FAdaptiveQualityInput
+{
+    float DeltaSeconds = 0.0f;
+    float FrameTimeMs = 0.0f;
+    float TargetFrameTimeMs = 0.0f;
+    float GameThreadMs = 0.0f;
+
+    // Measured per-frame cost of the work each knob scales
+    float KnobCostMs[(int32)EQualityKnob::Count] = {};
+
+    // Upper bound on every knob, e.g. lowered under thermal pressure
+    float MaxLevel = 1.0f;
+};
+
+// One controller update, kept whole so it can be logged for offline tuning
+struct FAdaptiveQualityDecision
+{
+    float Error = 0.0f;
+    float Proportional = 0.0f;
+    float Integral = 0.0f;
+    float Derivative = 0.0f;
+    float QualityLevel = 1.0f;
+    float Levels[(int32)EQualityKnob::Count] = {};
+    bool bRenderBound = false;
+    bool bChanged = false;
+};
+
+/**
+ * PID controller from frame time to quality knob levels.
+ * The overall quality reduction is shared out by each knob's measured cost (render-bound frames
+ * favour LOD and culling), and knobs move with a deadband, a minimum step and slower recovery than degradation.
+ */
+class FPSGAME_API FAdaptiveQualityController
+{
+public:
+    FAdaptiveQualityController();
+
+    void SetSettings(const FAdaptiveQualitySettings& InSettings) { Settings = InSettings; }
+    const FAdaptiveQualitySettings& GetSettings() const { return Settings; }
+
+    FAdaptiveQualityDecision Update(const FAdaptiveQualityInput& Input);
+
+    float GetLevel(EQualityKnob Knob) const { return Levels[(int32)Knob]; }
+
+    // Back to authored quality with a cleared integrator
+    void Reset();
+
+    static const TCHAR* GetKnobName(EQualityKnob Knob);
+
+private:
+    FAdaptiveQualitySettings Settings;
+    float Levels[(int32)EQualityKnob::Count];
+    float IntegralError = 0.0f;
+    float LastError = 0.0f;
+    bool bHasLastError = false;
+};
@@ -16,6 +16,8 @@
 #include "Stats/Stats.h"
 #include "HAL/IConsoleManager.h"
 #include "UObject/UObjectGlobals.h"
+#include "FPSGameStats.h"
+#include "FrameBudgetSubsystem.h"
 
 DEFINE_LOG_CATEGORY(LogObjectPool);
 
@@ -75,6 +77,7 @@ void UAdvancedObjectPoolManager::Deinitialize()
     if (UWorld* World = GetWorld())
     {
         World->GetTimerManager().ClearTimer(MaintenanceTimerHandle);
+        World->GetTimerManager().ClearTimer(MaintenanceDeferralHandle);
     }
     
     // Destroy all pools
@@ -87,6 +90,8 @@ void UAdvancedObjectPoolManager::Deinitialize()
 
 AActor* UAdvancedObjectPoolManager::AcquireActor(TSubclassOf<AActor> ActorClass, const FString& PoolName)
 {
+    FPSGAME_SCOPE_CYCLE_COUNTER(PoolAcquire);
+    
     // Input validation with security checks
     if (!ActorClass)
     {
@@ -126,44 +131,16 @@ AActor* UAdvancedObjectPoolManager::AcquireActor(TSubclassOf<AActor> ActorClass,
     
     FString EffectivePoolName = PoolName.IsEmpty() ? GeneratePoolName(ActorClass, PoolName) : PoolName;
     
-    FAdvancedObjectPool<AActor>** FoundPool = ActorPools.Find(EffectivePoolName);
+    FAdvancedObjectPool<AActor>* FoundPool = ActorPools.FindRef(EffectivePoolName);
     if (!FoundPool)
     {
-        // Create new pool with proper creation functions
-        auto CreateActorFunc = [ActorClass](UObject* Outer, TSubclassOf<AActor> Class) -> AActor*
-        {
-            if (UWorld* World = Outer ? Outer->GetWorld() : nullptr)
-            {
-                FActorSpawnParameters SpawnParams;
-                SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
-                return World->SpawnActor<AActor>(ActorClass, SpawnParams);
-            }
-            return nullptr;
-        };
-        
-        auto ResetActorFunc = [](AActor* Actor)
-        {
-            if (Actor)
-            {
-                Actor->SetActorHiddenInGame(true);
-                Actor->SetActorEnableCollision(ECollisionEnabled::NoCollision);
-                Actor->SetActorTickEnabled(false);
-                Actor->SetActorLocation(FVector::ZeroVector);
-                Actor->SetActorRotation(FRotator::ZeroRotator);
-            }
-        };
-        
-        FAdvancedObjectPool<AActor>* NewPool = new FAdvancedObjectPool<AActor>(
-            GlobalConfig, CreateActorFunc, ResetActorFunc, GetWorld(), ActorClass);
-        ActorPools.Add(EffectivePoolName, NewPool);
-        FoundPool = &NewPool;
-        
+        FoundPool = CreateActorPool(ActorClass, GlobalConfig, EffectivePoolName);
         BroadcastPoolEvent(EffectivePoolName, TEXT("Actor Pool Created"));
     }
     
-    if (*FoundPool)
+    if (FoundPool)
     {
-        AActor* Actor = (*FoundPool)->AcquireObject();
+        AActor* Actor = FoundPool->AcquireObject();
         if (Actor)
         {
             // Reset actor state for use
@@ -199,6 +176,8 @@ AActor* UAdvancedObjectPoolManager::AcquireActor(TSubclassOf<AActor> ActorClass,
 
 void UAdvancedObjectPoolManager::ReleaseActor(AActor* Actor)
 {
+    FPSGAME_SCOPE_CYCLE_COUNTER(PoolRelease);
+    
     // Enhanced input validation for security
     if (!Actor)
     {
@@ -215,14 +194,10 @@ void UAdvancedObjectPoolManager::ReleaseActor(AActor* Actor)
     
     FScopeLock Lock(&ManagerMutex);
     
-    // Pre-allocate temporary arrays for better performance
-    TArray<FString> PoolsToCheck;
-    PoolsToCheck.Reserve(ActorPools.Num());
-    
     // Find which pool this actor belongs to
     for (auto& PoolPair : ActorPools)
     {
-        if (PoolPair.Value)
+        if (PoolPair.Value && PoolPair.Value->IsObjectInUse(Actor))
         {
             PoolPair.Value->ReleaseObject(Actor);
             
@@ -248,6 +223,8 @@ void UAdvancedObjectPoolManager::ReleaseActor(AActor* Actor)
 
 UActorComponent* UAdvancedObjectPoolManager::AcquireComponent(TSubclassOf<UActorComponent> ComponentClass, const FString& PoolName)
 {
+    FPSGAME_SCOPE_CYCLE_COUNTER(PoolAcquire);
+    
     if (!ComponentClass)
     {
         UE_LOG(LogObjectPool, Warning, TEXT("AcquireComponent called with null ComponentClass"));
@@ -316,6 +293,8 @@ UActorComponent* UAdvancedObjectPoolManager::AcquireComponent(TSubclassOf<UActor
 
 void UAdvancedObjectPoolManager::ReleaseComponent(UActorComponent* Component)
 {
+    FPSGAME_SCOPE_CYCLE_COUNTER(PoolRelease);
+    
     if (!Component)
     {
         return;
@@ -348,6 +327,8 @@ void UAdvancedObjectPoolManager::ReleaseComponent(UActorComponent* Component)
 
 UObject* UAdvancedObjectPoolManager::AcquireObject(TSubclassOf<UObject> ObjectClass, const FString& PoolName)
 {
+    FPSGAME_SCOPE_CYCLE_COUNTER(PoolAcquire);
+    
     // Enhanced security validation
     if (!ObjectClass)
     {
@@ -440,6 +421,8 @@ UObject* UAdvancedObjectPoolManager::AcquireObject(TSubclassOf<UObject> ObjectCl
 
 void UAdvancedObjectPoolManager::ReleaseObject(UObject* Object)
 {
+    FPSGAME_SCOPE_CYCLE_COUNTER(PoolRelease);
+    
     // Enhanced security validation
     if (!Object)
     {
@@ -506,9 +489,8 @@ void UAdvancedObjectPoolManager::CreatePool(TSubclassOf<UObject> ObjectClass, co
     {
         if (!ActorPools.Contains(EffectivePoolName))
         {
-            FAdvancedObjectPool<AActor>* NewPool = new FAdvancedObjectPool<AActor>(Config);
+            FAdvancedObjectPool<AActor>* NewPool = CreateActorPool(ObjectClass.Get(), Config, EffectivePoolName);
             NewPool->InitializePool();
-            ActorPools.Add(EffectivePoolName, NewPool);
             
             BroadcastPoolEvent(EffectivePoolName, TEXT("Actor Pool Created with Custom Config"));
         }
@@ -1037,6 +1019,59 @@ void UAdvancedObjectPoolManager::OptimizePoolSizes()
     BroadcastPoolEvent(TEXT("System"), FString::Printf(TEXT("Optimized %d pools"), PoolsOptimized));
 }
 
+int64 UAdvancedObjectPoolManager::TrimIdleObjects(const FString& PoolName, int32 MaxIdleToKeep)
+{
+    FScopeLock Lock(&ManagerMutex);
+    
+    if (FAdvancedObjectPool<AActor>* ActorPool = ActorPools.FindRef(PoolName))
+    {
+        return ActorPool->TrimIdleObjects(MaxIdleToKeep);
+    }
+    if (FAdvancedObjectPool<UActorComponent>* ComponentPool = ComponentPools.FindRef(PoolName))
+    {
+        return ComponentPool->TrimIdleObjects(MaxIdleToKeep);
+    }
+    if (FAdvancedObjectPool<UObject>* ObjectPool = ObjectPools.FindRef(PoolName))
+    {
+        return ObjectPool->TrimIdleObjects(MaxIdleToKeep);
+    }
+    return 0;
+}
+
+int64 UAdvancedObjectPoolManager::TrimAllIdleObjects()
+{
+    FScopeLock Lock(&ManagerMutex);
+    
+    // Each pool keeps the idle objects it was created with; only growth since then is given back
+    int64 TrimmedBytes = 0;
+    for (auto& PoolPair : ActorPools)
+    {
+        if (PoolPair.Value)
+        {
+            TrimmedBytes += PoolPair.Value->TrimIdleObjects(PoolPair.Value->GetConfig().InitialSize);
+        }
+    }
+    
+    for (auto& PoolPair : ComponentPools)
+    {
+        if (PoolPair.Value)
+        {
+            TrimmedBytes += PoolPair.Value->TrimIdleObjects(PoolPair.Value->GetConfig().InitialSize);
+        }
+    }
+    
+    for (auto& PoolPair : ObjectPools)
+    {
+        if (PoolPair.Value)
+        {
+            TrimmedBytes += PoolPair.Value->TrimIdleObjects(PoolPair.Value->GetConfig().InitialSize);
+        }
+    }
+    
+    BroadcastPoolEvent(TEXT("System"), FString::Printf(TEXT("Trimmed idle objects (~%lld bytes)"), TrimmedBytes));
+    return TrimmedBytes;
+}
+
 // Specialized convenience functions for FPS game
 AActor* UAdvancedObjectPoolManager::AcquireBullet()
 {
@@ -1058,6 +1093,38 @@ AActor* UAdvancedObjectPoolManager::AcquireDecal()
     return AcquireActor(AActor::StaticClass(), TEXT("DecalPool"));
 }
 
+FAdvancedObjectPool<AActor>* UAdvancedObjectPoolManager::CreateActorPool(TSubclassOf<AActor> ActorClass, const FObjectPoolConfig& Config, const FString& PoolName)
+{
+    // Create new pool with proper creation functions
+    auto CreateActorFunc = [ActorClass](UObject* Outer, TSubclassOf<AActor> Class) -> AActor*
+    {
+        if (UWorld* World = Outer ? Outer->GetWorld() : nullptr)
+        {
+            FActorSpawnParameters SpawnParams;
+            SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+            return World->SpawnActor<AActor>(ActorClass, SpawnParams);
+        }
+        return nullptr;
+    };
+    
+    auto ResetActorFunc = [](AActor* Actor)
+    {
+        if (Actor)
+        {
+            Actor->SetActorHiddenInGame(true);
+            Actor->SetActorEnableCollision(ECollisionEnabled::NoCollision);
+            Actor->SetActorTickEnabled(false);
+            Actor->SetActorLocation(FVector::ZeroVector);
+            Actor->SetActorRotation(FRotator::ZeroRotator);
+        }
+    };
+    
+    FAdvancedObjectPool<AActor>* NewPool = new FAdvancedObjectPool<AActor>(
+        Config, CreateActorFunc, ResetActorFunc, GetWorld(), ActorClass);
+    ActorPools.Add(PoolName, NewPool);
+    return NewPool;
+}
+
 FString UAdvancedObjectPoolManager::GeneratePoolName(UClass* ObjectClass, const FString& CustomName) const
 {
     // Security-focused pool name generation
@@ -1162,6 +1229,46 @@ void UAdvancedObjectPoolManager::BroadcastPoolEvent(const FString& PoolName, con
 }
 
 void UAdvancedObjectPoolManager::TickPoolMaintenance()
+{
+    // The looping timer leaves maintenance to a deferred run that is already waiting, so only one is ever queued
+    UWorld* World = GetWorld();
+    if (World && World->GetTimerManager().IsTimerPending(MaintenanceDeferralHandle))
+    {
+        return;
+    }
+    
+    // The arbiter is per world; register again whenever the game instance moves to a new one
+    UFrameBudgetSubsystem* FrameBudget = UFrameBudgetSubsystem::Get(this);
+    if (FrameBudget != MaintenanceBudget.Get())
+    {
+        MaintenanceBudget = FrameBudget;
+        MaintenanceBudgetConsumer = FrameBudget
+            ? FrameBudget->RegisterConsumer(TEXT("PoolMaintenance"), EFrameBudgetPriority::Low, 0.0f, MaintenanceFrameBudgetMS * 1000.0f)
+            : INDEX_NONE;
+    }
+    
+    // Lowest priority: wait for a frame with room rather than adding to one that is already over
+    if (World && FrameBudget && MaintenanceBudgetConsumer != INDEX_NONE && MaintenanceDeferrals < MaxMaintenanceDeferrals &&
+        FrameBudget->GetRemainingBudgetUs(MaintenanceBudgetConsumer) < AverageMaintenanceCostUs)
+    {
+        MaintenanceDeferrals++;
+        MaintenanceDeferralHandle = World->GetTimerManager().SetTimerForNextTick(this, &UAdvancedObjectPoolManager::TickPoolMaintenance);
+        return;
+    }
+    MaintenanceDeferrals = 0;
+    
+    const uint64 StartCycles = FPlatformTime::Cycles64();
+    RunPoolMaintenance();
+    const float CostUs = (float)(FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles) * 1000.0);
+    
+    AverageMaintenanceCostUs = FMath::Lerp(AverageMaintenanceCostUs, CostUs, 0.5f);
+    if (FrameBudget)
+    {
+        FrameBudget->ReportUsage(MaintenanceBudgetConsumer, CostUs);
+    }
+}
+
+void UAdvancedObjectPoolManager::RunPoolMaintenance()
 {
     float CurrentTime = FPlatformTime::Seconds();
     
@@ -1186,8 +1293,10 @@ void UAdvancedObjectPoolManager::TickPoolMaintenance()
         UE_LOG(LogObjectPool, Warning, TEXT("Pool memory usage (%.2f MB) exceeds limit (%.2f MB), optimizing"), 
                TotalMemory, GlobalConfig.MemoryLimitMB);
         
+        // Destroyed pool objects are left to the regular incremental GC rather than forcing a full purge mid-match
         OptimizePoolSizes();
-        ForceGarbageCollection();
+        const int64 TrimmedBytes = TrimAllIdleObjects();
+        UE_LOG(LogObjectPool, Log, TEXT("Trimmed idle pool capacity (~%.2f MB)"), TrimmedBytes / (1024.0f * 1024.0f));
         
         BroadcastPoolEvent(TEXT("System"), 
                           FString::Printf(TEXT("Memory limit exceeded (%.2f MB), optimized pools"), TotalMemory));
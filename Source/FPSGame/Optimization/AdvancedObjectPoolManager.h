@@ -15,6 +15,8 @@
 
 DECLARE_LOG_CATEGORY_EXTERN(LogObjectPool, Log, All);
 
+class UFrameBudgetSubsystem;
+
 // Pool statistics for monitoring
 USTRUCT(BlueprintType)
 struct FPoolStatistics
@@ -267,12 +269,18 @@ public:
     void CleanupPool();
     void DestroyPool();
 
+    // Destroys the longest-idle available objects until at most MaxIdleToKeep remain; returns the estimated bytes freed
+    int64 TrimIdleObjects(int32 MaxIdleToKeep);
+
     // Statistics and monitoring - FORCEINLINE for frequent access
     FORCEINLINE FPoolStatistics GetStatistics() const;
     FORCEINLINE void UpdateStatistics();
     FORCEINLINE bool IsHealthy() const;
     void ResetStatistics();
 
+    // True while Object is checked out of this pool
+    FORCEINLINE bool IsObjectInUse(T* Object) const;
+
     // Configuration
     void UpdateConfig(const FObjectPoolConfig& NewConfig);
     FObjectPoolConfig GetConfig() const { return Config; }
@@ -287,6 +295,7 @@ private:
     TArray<FAdvancedPooledObject> Pool; // Stores all objects, active or inactive
     TQueue<int32> AvailableIndices;     // Indices into 'Pool' for available objects
     TMap<T*, int32> ObjectToIndexMap;   // Maps an active T* to its index in 'Pool'
+    TArray<int32> FreeSlots;            // Slots whose object was trimmed; refilled before 'Pool' grows
     
     // Statistics
     mutable FPoolStatistics Statistics;
@@ -306,6 +315,7 @@ private:
     T* CreateNewObjectInternal(); // Uses CreateObjectFunc
     void ResetObjectInternal(T* ObjectToReset); // Uses ResetObjectFunc
     void DestroyObjectInternal(int32 PoolIndex); // Handles actual destruction
+    float CalculateMemoryFootprint(T* Object) const;
     bool ShouldCleanupObject(const FAdvancedPooledObject& PooledObject, double CurrentTime) const;
 };
 
@@ -402,6 +412,14 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Object Pool")
     void OptimizePoolSizes();
 
+    // Destroys idle objects beyond MaxIdleToKeep in one pool; returns the estimated bytes freed
+    UFUNCTION(BlueprintCallable, Category = "Object Pool")
+    int64 TrimIdleObjects(const FString& PoolName, int32 MaxIdleToKeep);
+
+    // Trims every pool back to its initial size of idle objects; returns the estimated bytes freed
+    UFUNCTION(BlueprintCallable, Category = "Object Pool")
+    int64 TrimAllIdleObjects();
+
     // Specialized convenience functions for FPS game
     UFUNCTION(BlueprintCallable, Category = "FPS Pool")
     AActor* AcquireBullet();
@@ -430,6 +448,10 @@ protected:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Configuration")
     FObjectPoolConfig GlobalConfig;
 
+    // Game-thread time a maintenance pass asks the frame budget arbiter for
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Configuration")
+    float MaintenanceFrameBudgetMS = 1.0f;
+
     // Monitoring
     float LastGlobalCleanupTime;
     float LastGlobalHealthCheckTime;
@@ -442,10 +464,21 @@ private:
     FString GeneratePoolName(UClass* ObjectClass, const FString& CustomName) const;
     void RegisterCommonPools();
     void BroadcastPoolEvent(const FString& PoolName, const FString& EventDescription);
+    FAdvancedObjectPool<AActor>* CreateActorPool(TSubclassOf<AActor> ActorClass, const FObjectPoolConfig& Config, const FString& PoolName);
     void TickPoolMaintenance();
+    void RunPoolMaintenance();
 
     // Timer handle for maintenance
     FTimerHandle MaintenanceTimerHandle;
+    FTimerHandle MaintenanceDeferralHandle;
+
+    // Maintenance waits for a frame whose Low-priority grant covers its usual cost, for at most this many frames
+    static constexpr int32 MaxMaintenanceDeferrals = 30;
+
+    TWeakObjectPtr<UFrameBudgetSubsystem> MaintenanceBudget;
+    int32 MaintenanceBudgetConsumer = INDEX_NONE;
+    int32 MaintenanceDeferrals = 0;
+    float AverageMaintenanceCostUs = 0.0f;
 };
 
 // Template implementation
@@ -494,15 +527,17 @@ T* FAdvancedObjectPool<T>::AcquireObject()
         AvailableIndices.Dequeue(ObjectIndex);
         Statistics.CacheHits++;
     }
-    else if (Pool.Num() < Config.MaxSize || Config.MaxSize <= 0) // Allow growth if MaxSize is 0 or not reached
+    else if (FreeSlots.Num() > 0 || Pool.Num() < Config.MaxSize || Config.MaxSize <= 0) // Allow growth if MaxSize is 0 or not reached
     {
-        if (Config.bAllowGrowth)
+        // Trimmed slots were capacity the pool already had, so they are refilled even when growth is disabled
+        if (Config.bAllowGrowth || FreeSlots.Num() > 0)
         {
             T* NewRawObject = CreateNewObjectInternal();
             if (NewRawObject)
             {
-                ObjectIndex = Pool.Emplace(); // Add new FAdvancedPooledObject to Pool array
+                ObjectIndex = FreeSlots.Num() > 0 ? FreeSlots.Pop(false) : Pool.Emplace(); // Add new FAdvancedPooledObject to Pool array
                 FAdvancedPooledObject& NewPooledObject = Pool[ObjectIndex];
+                NewPooledObject = FAdvancedPooledObject();
                 NewPooledObject.Object = NewRawObject;
                 NewPooledObject.CreationTime = CurrentTime;
                 NewPooledObject.ObjectID = FString::Printf(TEXT("%s_PoolObj_%d"), *ObjectClass->GetName(), ObjectIndex);
@@ -844,6 +879,7 @@ void FAdvancedObjectPool<T>::CleanupPool()
             if (ShouldCleanupObject(PooledObject, CurrentTime))
             {
                 DestroyObjectInternal(ObjectIndex); // Destroys UObject and marks FAdvancedPooledObject
+                FreeSlots.Add(ObjectIndex);
             }
             else
             {
@@ -868,6 +904,44 @@ void FAdvancedObjectPool<T>::CleanupPool()
     if (Config.bEnableDebugLogging) UE_LOG(LogObjectPool, Log, TEXT("Pool [%s]: Cleanup finished. Available: %d"), *ObjectClass->GetName(), AvailableIndices.Num());
 }
 
+template<typename T>
+int64 FAdvancedObjectPool<T>::TrimIdleObjects(int32 MaxIdleToKeep)
+{
+    FScopeLock Lock(&PoolMutex);
+
+    // Released objects are queued at the back, so the front has been idle longest
+    TArray<int32> IdleIndices;
+    int32 ObjectIndex;
+    while (AvailableIndices.Dequeue(ObjectIndex))
+    {
+        IdleIndices.Add(ObjectIndex);
+    }
+
+    const int32 NumToTrim = FMath::Max(0, IdleIndices.Num() - FMath::Max(0, MaxIdleToKeep));
+    int64 FreedBytes = 0;
+    for (int32 Index = 0; Index < IdleIndices.Num(); ++Index)
+    {
+        const int32 PoolIndex = IdleIndices[Index];
+        if (Index >= NumToTrim)
+        {
+            AvailableIndices.Enqueue(PoolIndex);
+        }
+        else if (Pool.IsValidIndex(PoolIndex))
+        {
+            FreedBytes += (int64)(Pool[PoolIndex].MemoryFootprintKB * 1024.0f);
+            DestroyObjectInternal(PoolIndex);
+            FreeSlots.Add(PoolIndex);
+        }
+    }
+
+    Statistics.AvailableObjects = IdleIndices.Num() - NumToTrim;
+    UpdateStatistics();
+
+    if (Config.bEnableDebugLogging && NumToTrim > 0) UE_LOG(LogObjectPool, Log, TEXT("Pool [%s]: Trimmed %d idle objects (~%lld bytes)"), *ObjectClass->GetName(), NumToTrim, FreedBytes);
+
+    return FreedBytes;
+}
+
 template<typename T>
 bool FAdvancedObjectPool<T>::ShouldCleanupObject(const FAdvancedPooledObject& PooledObject, double CurrentTime) const
 {
@@ -1025,6 +1099,7 @@ void FAdvancedObjectPool<T>::DestroyPool()
     Pool.Empty();
     AvailableIndices = TQueue<int32>();
     ObjectToIndexMap.Empty();
+    FreeSlots.Empty();
     
     // Reset state
     bInitialized = false;
@@ -1079,6 +1154,13 @@ FORCEINLINE bool FAdvancedObjectPool<T>::IsHealthy() const
     return Statistics.bIsHealthy;
 }
 
+template<typename T>
+FORCEINLINE bool FAdvancedObjectPool<T>::IsObjectInUse(T* Object) const
+{
+    FScopeLock Lock(&PoolMutex);
+    return ObjectToIndexMap.Contains(Object);
+}
+
 template<typename T>
 void FAdvancedObjectPool<T>::ResetStatistics()
 {
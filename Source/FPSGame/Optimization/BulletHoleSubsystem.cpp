@@ -0,0 +1,324 @@
+#include "BulletHoleSubsystem.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/World.h"
+#include "Engine/Engine.h"
+#include "GameFramework/Actor.h"
+#include "Materials/Material.h"
+#include "Materials/MaterialInterface.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogBulletHoles, Log, All);
+
+namespace
+{
+    const TCHAR* DefaultBulletHoleMeshPath = TEXT("/Engine/BasicShapes/Plane.Plane");
+
+    // Keeps the hole off the surface it was projected onto
+    const float SurfaceOffset = 0.2f;
+
+    const float PlaneMeshSize = 100.0f;
+}
+
+// FBulletHoleRingBuffer
+
+FBulletHoleRingBuffer::FBulletHoleRingBuffer(int32 InMaxHoles, int32 InMaxHolesPerRegion, float InRegionSize)
+    : MaxHoles(FMath::Max(1, InMaxHoles))
+    , MaxHolesPerRegion(FMath::Max(1, InMaxHolesPerRegion))
+    , RegionSize(FMath::Max(InRegionSize, 1.0f))
+{
+}
+
+int32 FBulletHoleRingBuffer::Add(const FVector& Location)
+{
+    const FIntVector Key = ToRegion(Location);
+
+    // A full region overwrites its own oldest hole, so one wall being hammered never evicts holes elsewhere
+    if (FRegion* Region = Regions.Find(Key))
+    {
+        if (Region->Count >= MaxHolesPerRegion)
+        {
+            const int32 Slot = Region->Ring[Region->Head];
+            Region->Head = (Region->Head + 1) % Region->Ring.Num();
+            Unlink(Slot);
+            LinkNewest(Slot);
+            return Slot;
+        }
+    }
+
+    int32 Slot;
+    if (Slots.Num() < MaxHoles)
+    {
+        Slot = Slots.AddDefaulted();
+    }
+    else
+    {
+        // The oldest hole overall is also the oldest in its region, so it sits at that region's head
+        Slot = Oldest;
+        Unlink(Slot);
+
+        const FIntVector OldKey = Slots[Slot].Region;
+        FRegion& OldRegion = Regions.FindChecked(OldKey);
+        OldRegion.Head = (OldRegion.Head + 1) % OldRegion.Ring.Num();
+        OldRegion.Count--;
+        if (OldRegion.Count == 0 && OldKey != Key)
+        {
+            Regions.Remove(OldKey);
+        }
+    }
+
+    FRegion& Region = Regions.FindOrAdd(Key);
+    if (Region.Ring.Num() == 0)
+    {
+        Region.Ring.SetNumUninitialized(MaxHolesPerRegion);
+    }
+    Region.Ring[(Region.Head + Region.Count) % Region.Ring.Num()] = Slot;
+    Region.Count++;
+
+    Slots[Slot].Region = Key;
+    LinkNewest(Slot);
+    return Slot;
+}
+
+int32 FBulletHoleRingBuffer::GetRegionCount(const FVector& Location) const
+{
+    const FRegion* Region = Regions.Find(ToRegion(Location));
+    return Region ? Region->Count : 0;
+}
+
+void FBulletHoleRingBuffer::Reset()
+{
+    Slots.Reset();
+    Regions.Reset();
+    Oldest = INDEX_NONE;
+    Newest = INDEX_NONE;
+}
+
+FIntVector FBulletHoleRingBuffer::ToRegion(const FVector& Location) const
+{
+    return FIntVector(
+        FMath::FloorToInt32(Location.X / RegionSize),
+        FMath::FloorToInt32(Location.Y / RegionSize),
+        FMath::FloorToInt32(Location.Z / RegionSize));
+}
+
+void FBulletHoleRingBuffer::Unlink(int32 Slot)
+{
+    FSlot& Entry = Slots[Slot];
+    if (Entry.Older != INDEX_NONE)
+    {
+        Slots[Entry.Older].Newer = Entry.Newer;
+    }
+    else if (Oldest == Slot)
+    {
+        Oldest = Entry.Newer;
+    }
+
+    if (Entry.Newer != INDEX_NONE)
+    {
+        Slots[Entry.Newer].Older = Entry.Older;
+    }
+    else if (Newest == Slot)
+    {
+        Newest = Entry.Older;
+    }
+
+    Entry.Older = INDEX_NONE;
+    Entry.Newer = INDEX_NONE;
+}
+
+void FBulletHoleRingBuffer::LinkNewest(int32 Slot)
+{
+    Slots[Slot].Older = Newest;
+    if (Newest != INDEX_NONE)
+    {
+        Slots[Newest].Newer = Slot;
+    }
+    Newest = Slot;
+
+    if (Oldest == INDEX_NONE)
+    {
+        Oldest = Slot;
+    }
+}
+
+// UBulletHoleSubsystem
+
+void UBulletHoleSubsystem::Deinitialize()
+{
+    if (IsValid(HostActor))
+    {
+        HostActor->Destroy();
+    }
+    HostActor = nullptr;
+    BatchComponents.Reset();
+    Batches.Reset();
+
+    Super::Deinitialize();
+}
+
+bool UBulletHoleSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UBulletHoleSubsystem::Tick(float DeltaTime)
+{
+    // Holes written this frame reach the renderer in one update per material
+    for (TPair<const UMaterialInterface*, FBulletHoleBatch>& Pair : Batches)
+    {
+        FBulletHoleBatch& Batch = Pair.Value;
+        if (Batch.bRenderStateDirty && IsValid(Batch.Instances))
+        {
+            Batch.Instances->MarkRenderStateDirty();
+        }
+        Batch.bRenderStateDirty = false;
+    }
+}
+
+TStatId UBulletHoleSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UBulletHoleSubsystem, STATGROUP_Tickables);
+}
+
+UBulletHoleSubsystem* UBulletHoleSubsystem::Get(const UObject* WorldContextObject)
+{
+    UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
+    return World ? World->GetSubsystem<UBulletHoleSubsystem>() : nullptr;
+}
+
+void UBulletHoleSubsystem::AddBulletHole(UMaterialInterface* HoleMaterial, const FVector& Location, const FRotator& Rotation, const FVector& Size, float Lifespan)
+{
+    FBulletHoleBatch* Batch = FindOrCreateBatch(HoleMaterial);
+    if (!Batch)
+    {
+        return;
+    }
+
+    // The plane faces back out of the surface and keeps the decal's roll
+    const FVector Normal = -Rotation.Vector();
+    const FRotator PlaneRotation = FRotationMatrix::MakeFromZX(Normal, FRotationMatrix(Rotation).GetUnitAxis(EAxis::Z)).Rotator();
+    const FVector Scale(Size.Z * 2.0f / PlaneMeshSize, Size.Y * 2.0f / PlaneMeshSize, 1.0f);
+    const FTransform Transform(PlaneRotation, Location + Normal * SurfaceOffset, Scale);
+
+    TArray<float, TInlineAllocator<NumCustomDataFloats>> CustomData;
+    CustomData.Add((float)FMath::RandHelper(FMath::Max(1, AtlasTileCount)));
+    CustomData.Add(GetWorld()->GetTimeSeconds());
+    CustomData.Add(Lifespan);
+
+    const int32 Slot = Batch->Holes.Add(Location);
+    if (Slot == Batch->Instances->GetInstanceCount())
+    {
+        Batch->Instances->AddInstance(Transform, true);
+    }
+    else
+    {
+        Batch->Instances->UpdateInstanceTransform(Slot, Transform, true, false, true);
+        Batch->Recycled++;
+    }
+    Batch->Instances->SetCustomData(Slot, CustomData, false);
+    Batch->bRenderStateDirty = true;
+}
+
+int32 UBulletHoleSubsystem::GetBulletHoleCount() const
+{
+    int32 Count = 0;
+    for (const TPair<const UMaterialInterface*, FBulletHoleBatch>& Pair : Batches)
+    {
+        Count += Pair.Value.Holes.Num();
+    }
+    return Count;
+}
+
+FString UBulletHoleSubsystem::GenerateBulletHoleReport() const
+{
+    FString Report = TEXT("=== BULLET HOLE REPORT ===\n");
+    Report += FString::Printf(TEXT("Materials: %d\n"), Batches.Num());
+    Report += FString::Printf(TEXT("Holes: %d\n"), GetBulletHoleCount());
+
+    for (const TPair<const UMaterialInterface*, FBulletHoleBatch>& Pair : Batches)
+    {
+        const FBulletHoleBatch& Batch = Pair.Value;
+        Report += FString::Printf(TEXT("  %s: %d/%d holes, %d regions, %d recycled\n"),
+            *GetNameSafe(Pair.Key), Batch.Holes.Num(), Batch.Holes.GetMaxHoles(), Batch.Holes.GetNumRegions(), Batch.Recycled);
+    }
+
+    return Report;
+}
+
+UBulletHoleSubsystem::FBulletHoleBatch* UBulletHoleSubsystem::FindOrCreateBatch(UMaterialInterface* HoleMaterial)
+{
+    if (!HoleMaterial)
+    {
+        return nullptr;
+    }
+
+    // Deferred decals only render through a decal component, never on the instanced plane
+    const UMaterial* BaseMaterial = HoleMaterial->GetMaterial();
+    if (BaseMaterial && BaseMaterial->MaterialDomain == MD_DeferredDecal)
+    {
+        UE_CLOG(!bWarnedDeferredDecal, LogBulletHoles, Warning, TEXT("%s is a deferred decal material; bullet holes need a surface (mesh decal) material"), *HoleMaterial->GetName());
+        bWarnedDeferredDecal = true;
+        return nullptr;
+    }
+
+    if (FBulletHoleBatch* Existing = Batches.Find(HoleMaterial))
+    {
+        return IsValid(Existing->Instances) ? Existing : nullptr;
+    }
+
+    UWorld* World = GetWorld();
+    if (!World)
+    {
+        return nullptr;
+    }
+
+    if (!BulletHoleMesh)
+    {
+        BulletHoleMesh = LoadObject<UStaticMesh>(nullptr, DefaultBulletHoleMeshPath);
+        if (!BulletHoleMesh)
+        {
+            UE_LOG(LogBulletHoles, Warning, TEXT("Bullet hole mesh %s could not be loaded"), DefaultBulletHoleMeshPath);
+            return nullptr;
+        }
+    }
+
+    if (!IsValid(HostActor))
+    {
+        FActorSpawnParameters SpawnParams;
+        SpawnParams.Name = MakeUniqueObjectName(World, AActor::StaticClass(), TEXT("BulletHoles"));
+        SpawnParams.ObjectFlags |= RF_Transient;
+        SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+        HostActor = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParams);
+        if (!HostActor)
+        {
+            return nullptr;
+        }
+    }
+
+    UInstancedStaticMeshComponent* Instances = NewObject<UInstancedStaticMeshComponent>(HostActor, NAME_None, RF_Transient);
+    Instances->SetMobility(EComponentMobility::Movable);
+    Instances->SetStaticMesh(BulletHoleMesh);
+    Instances->SetMaterial(0, HoleMaterial);
+    Instances->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+    Instances->SetCastShadow(false);
+    Instances->SetCullDistances(0, FMath::RoundToInt32(CullDistance));
+    Instances->NumCustomDataFloats = NumCustomDataFloats;
+
+    if (!HostActor->GetRootComponent())
+    {
+        HostActor->SetRootComponent(Instances);
+    }
+    else
+    {
+        Instances->SetupAttachment(HostActor->GetRootComponent());
+    }
+    Instances->RegisterComponent();
+    BatchComponents.Add(Instances);
+
+    FBulletHoleBatch& Batch = Batches.Add(HoleMaterial);
+    Batch.Holes = FBulletHoleRingBuffer(MaxHolesPerMaterial, MaxHolesPerRegion, RegionSize);
+    Batch.Instances = Instances;
+
+    UE_LOG(LogBulletHoles, Log, TEXT("Created bullet hole batch for %s (%d holes)"), *HoleMaterial->GetName(), MaxHolesPerMaterial);
+    return &Batch;
+}
@@ -0,0 +1,149 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "BulletHoleSubsystem.generated.h"
+
+class UInstancedStaticMeshComponent;
+class UMaterialInterface;
+class UStaticMesh;
+
+/**
+ * Fixed-capacity bullet hole slots grouped into surface regions.
+ * A full region recycles its own oldest hole; once every slot is used the oldest hole anywhere is recycled.
+ * Slots never move, so each maps directly onto one instance of the owner's instanced mesh.
+ */
+class FPSGAME_API FBulletHoleRingBuffer
+{
+public:
+    FBulletHoleRingBuffer(int32 InMaxHoles = 1024, int32 InMaxHolesPerRegion = 32, float InRegionSize = 400.0f);
+
+    // Returns the slot to write the new hole into
+    int32 Add(const FVector& Location);
+
+    // Slots written so far; never more than the capacity
+    int32 Num() const { return Slots.Num(); }
+    int32 GetMaxHoles() const { return MaxHoles; }
+    int32 GetNumRegions() const { return Regions.Num(); }
+
+    // Holes in the region containing Location
+    int32 GetRegionCount(const FVector& Location) const;
+
+    // Next slot Add would take once full; INDEX_NONE while empty
+    int32 GetOldestSlot() const { return Oldest; }
+
+    void Reset();
+
+private:
+    struct FSlot
+    {
+        FIntVector Region = FIntVector::ZeroValue;
+
+        // Age list, oldest to newest
+        int32 Older = INDEX_NONE;
+        int32 Newer = INDEX_NONE;
+    };
+
+    struct FRegion
+    {
+        TArray<int32> Ring;
+        int32 Head = 0;
+        int32 Count = 0;
+    };
+
+    int32 MaxHoles;
+    int32 MaxHolesPerRegion;
+    float RegionSize;
+
+    TArray<FSlot> Slots;
+    TMap<FIntVector, FRegion> Regions;
+    int32 Oldest = INDEX_NONE;
+    int32 Newest = INDEX_NONE;
+
+    FIntVector ToRegion(const FVector& Location) const;
+    void Unlink(int32 Slot);
+    void LinkNewest(int32 Slot);
+};
+
+/**
+ * Per-world bullet holes drawn as one instanced mesh per decal material.
+ * The material is expected to be a mesh decal reading per-instance custom data:
+ * 0 = atlas tile, 1 = spawn time, 2 = lifespan. Holes fade out in the material and their slot is reused later,
+ * so decal cost stays bounded by the capacity however many rounds are fired.
+ */
+UCLASS()
+class FPSGAME_API UBulletHoleSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // USubsystem interface
+    virtual void Deinitialize() override;
+
+    // FTickableGameObject interface
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    static UBulletHoleSubsystem* Get(const UObject* WorldContextObject);
+
+    // Rotation and size follow UDecalComponent: X projects into the surface, Size is the half extent.
+    // HoleMaterial must be a surface-domain mesh decal; deferred decal materials are rejected
+    UFUNCTION(BlueprintCallable, Category = "Bullet Holes")
+    void AddBulletHole(UMaterialInterface* HoleMaterial, const FVector& Location, const FRotator& Rotation, const FVector& Size, float Lifespan = 30.0f);
+
+    // Unit plane (100x100, facing +Z) the holes are drawn with
+    UFUNCTION(BlueprintCallable, Category = "Bullet Holes")
+    void SetBulletHoleMesh(UStaticMesh* InMesh) { BulletHoleMesh = InMesh; }
+
+    UFUNCTION(BlueprintCallable, Category = "Bullet Holes")
+    int32 GetBulletHoleCount() const;
+
+    UFUNCTION(BlueprintCallable, Category = "Bullet Holes")
+    FString GenerateBulletHoleReport() const;
+
+    // Applies to materials seen after the change
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Bullet Holes")
+    int32 MaxHolesPerMaterial = 1024;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Bullet Holes")
+    int32 MaxHolesPerRegion = 32;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Bullet Holes")
+    float RegionSize = 400.0f;
+
+    // Tiles in the decal atlas; each hole picks one
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Bullet Holes")
+    int32 AtlasTileCount = 4;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Bullet Holes")
+    float CullDistance = 5000.0f;
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    struct FBulletHoleBatch
+    {
+        FBulletHoleRingBuffer Holes;
+        UInstancedStaticMeshComponent* Instances = nullptr;
+        int32 Recycled = 0;
+        bool bRenderStateDirty = false;
+    };
+
+    static constexpr int32 NumCustomDataFloats = 3;
+
+    // Keeps the instanced components alive; the batches point into it
+    UPROPERTY()
+    AActor* HostActor = nullptr;
+
+    UPROPERTY()
+    TArray<UInstancedStaticMeshComponent*> BatchComponents;
+
+    UPROPERTY()
+    UStaticMesh* BulletHoleMesh = nullptr;
+
+    TMap<const UMaterialInterface*, FBulletHoleBatch> Batches;
+    bool bWarnedDeferredDecal = false;
+
+    FBulletHoleBatch* FindOrCreateBatch(UMaterialInterface* HoleMaterial);
+};
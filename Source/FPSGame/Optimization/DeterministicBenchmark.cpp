@@ -0,0 +1,429 @@
+#include "DeterministicBenchmark.h"
+#include "Engine/World.h"
+#include "Engine/StaticMeshActor.h"
+#include "GameFramework/PlayerController.h"
+#include "GameFramework/Pawn.h"
+#include "Misc/App.h"
+#include "RenderCore.h"
+#include "EngineUtils.h"
+#include "AI/FPSAICharacter.h"
+#include "Destruction/EnvironmentalDestructionSystem.h"
+#include "PooledWeaponEffectsComponent.h"
+#include "PerformanceOptimizationSystem.h"
+#include "FrameTelemetrySubsystem.h"
+
+namespace
+{
+    FVector RandomRingPoint(FRandomStream& Stream, float MinRadius, float MaxRadius)
+    {
+        const float Angle = Stream.FRandRange(0.0f, 2.0f * PI);
+        const float Radius = Stream.FRandRange(MinRadius, MaxRadius);
+        return FVector(FMath::Cos(Angle) * Radius, FMath::Sin(Angle) * Radius, 0.0f);
+    }
+
+    FBenchmarkScriptEvent MakeEvent(int32 Frame, FBenchmarkScriptEvent::EType Type, int32 Target, const FVector& Location, const FVector& Direction = FVector::ForwardVector)
+    {
+        FBenchmarkScriptEvent Event;
+        Event.Frame = Frame;
+        Event.Type = Type;
+        Event.Target = Target;
+        Event.Location = Location;
+        Event.Direction = Direction;
+        return Event;
+    }
+}
+
+FDeterministicBenchmark::FDeterministicBenchmark(UWorld* InWorld, EBenchmarkScenario InScenario, const FBenchmarkRunSettings& InSettings)
+    : World(InWorld)
+    , Scenario(InScenario)
+    , Settings(InSettings)
+{
+}
+
+FDeterministicBenchmark::~FDeterministicBenchmark()
+{
+    End();
+}
+
+void FDeterministicBenchmark::Begin()
+{
+    if (bRunning || !World) return;
+
+    if (APlayerController* PC = World->GetFirstPlayerController())
+    {
+        if (APawn* Pawn = PC->GetPawn())
+        {
+            Origin = Pawn->GetActorLocation();
+        }
+    }
+
+    bSavedFixedTimeStep = FApp::UseFixedTimeStep();
+    SavedFixedDeltaTime = FApp::GetFixedDeltaTime();
+    FApp::SetUseFixedTimeStep(true);
+    FApp::SetFixedDeltaTime(FMath::Max(Settings.FixedStepSeconds, KINDA_SMALL_NUMBER));
+
+    FMath::RandInit(Settings.RandomSeed);
+    FMath::SRandInit(Settings.RandomSeed);
+
+    for (TActorIterator<AActor> It(World); It; ++It)
+    {
+        TInlineComponentArray<UPooledWeaponEffectsComponent*> Components(*It);
+        for (UPooledWeaponEffectsComponent* Component : Components)
+        {
+            PausedEffectQuality.Add({ Component, Component->HasExternalQualityControl(), Component->GetEffectQualityScale() });
+        }
+    }
+
+    for (TActorIterator<APerformanceOptimizationSystem> It(World); It; ++It)
+    {
+        PausedQualityControllers.Add({ *It, It->OptimizationSettings.bEnablePredictiveOptimization, It->OptimizationSettings.MaxCullingDistance });
+        It->OptimizationSettings.bEnablePredictiveOptimization = false;
+        It->ResetAdaptiveQuality();
+    }
+
+    BuildScript(Scenario, Settings, Script);
+    NextEvent = 0;
+    Frame = 0;
+    FrameTimesMs.Reset(Settings.MeasuredFrames);
+    GameThreadTimesMs.Reset(Settings.MeasuredFrames);
+    ScopeTotalsMs.Reset();
+    LastScopeFrame = GFrameCounter;
+    LastStepTime = FPlatformTime::Seconds();
+    bRunning = true;
+}
+
+bool FDeterministicBenchmark::Step()
+{
+    if (!bRunning) return false;
+
+    // This call closes the previous frame, which ran the previous frame's events
+    const double Now = FPlatformTime::Seconds();
+    if (Frame > Settings.WarmupFrames)
+    {
+        RecordFrame(Now);
+    }
+    LastStepTime = Now;
+
+    if (FrameTimesMs.Num() >= FMath::Max(Settings.MeasuredFrames, 1))
+    {
+        return false;
+    }
+
+    while (NextEvent < Script.Num() && Script[NextEvent].Frame <= Frame)
+    {
+        RunEvent(Script[NextEvent++]);
+    }
+
+    Frame++;
+    return true;
+}
+
+void FDeterministicBenchmark::End()
+{
+    if (!bRunning) return;
+    bRunning = false;
+
+    for (const TWeakObjectPtr<APawn>& AI : SpawnedAI)
+    {
+        if (APawn* Pawn = AI.Get())
+        {
+            if (AController* Controller = Pawn->GetController())
+            {
+                Controller->Destroy();
+            }
+            Pawn->Destroy();
+        }
+    }
+
+    for (const TWeakObjectPtr<AActor>& Host : Destructibles)
+    {
+        if (AActor* Actor = Host.Get())
+        {
+            Actor->Destroy();
+        }
+    }
+
+    if (AActor* Host = EffectHost.Get())
+    {
+        Host->Destroy();
+    }
+
+    SpawnedAI.Empty();
+    Destructibles.Empty();
+    DestructionComponents.Empty();
+    EffectHost.Reset();
+    EffectComponent.Reset();
+
+    for (const FPausedQualityController& Paused : PausedQualityControllers)
+    {
+        if (APerformanceOptimizationSystem* System = Paused.System.Get())
+        {
+            System->OptimizationSettings.bEnablePredictiveOptimization = Paused.bWasEnabled;
+            System->OptimizationSettings.MaxCullingDistance = Paused.MaxCullingDistance;
+        }
+    }
+    PausedQualityControllers.Empty();
+
+    for (const FPausedEffectQuality& Paused : PausedEffectQuality)
+    {
+        if (UPooledWeaponEffectsComponent* Component = Paused.Component.Get())
+        {
+            if (Paused.bWasExternal)
+            {
+                Component->SetEffectQualityScale(Paused.QualityScale);
+            }
+            else
+            {
+                Component->ReleaseEffectQualityScale();
+            }
+        }
+    }
+    PausedEffectQuality.Empty();
+
+    FApp::SetUseFixedTimeStep(bSavedFixedTimeStep);
+    FApp::SetFixedDeltaTime(SavedFixedDeltaTime);
+}
+
+void FDeterministicBenchmark::RecordFrame(double Now)
+{
+    FrameTimesMs.Add((float)((Now - LastStepTime) * 1000.0));
+    GameThreadTimesMs.Add((float)FPlatformTime::ToMilliseconds(GGameThreadTime));
+
+    // Telemetry closes frames on its own tick, so take each closed frame once
+    const UFrameTelemetrySubsystem* Telemetry = UFrameTelemetrySubsystem::Get(World);
+    FFrameTelemetrySample Sample;
+    if (Telemetry && Telemetry->GetBuffer().ReadSample(0, Sample) && Sample.FrameNumber != LastScopeFrame)
+    {
+        const FFrameTelemetryBuffer& Frames = Telemetry->GetBuffer();
+        for (int32 ScopeIndex = 0; ScopeIndex < Frames.GetNumScopes(); ++ScopeIndex)
+        {
+            ScopeTotalsMs.FindOrAdd(Frames.GetScopeName(ScopeIndex)) += Sample.ScopeMs[ScopeIndex];
+        }
+        LastScopeFrame = Sample.FrameNumber;
+    }
+}
+
+void FDeterministicBenchmark::RunEvent(const FBenchmarkScriptEvent& Event)
+{
+    const FVector Location = Origin + Event.Location;
+
+    FActorSpawnParameters SpawnParams;
+    SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+    switch (Event.Type)
+    {
+        case FBenchmarkScriptEvent::EType::SpawnAI:
+        {
+            UClass* AIClass = Settings.AIClass ? *Settings.AIClass : AFPSAICharacter::StaticClass();
+            APawn* Pawn = World->SpawnActor<APawn>(AIClass, Location, (Origin - Location).Rotation(), SpawnParams);
+            if (Pawn && !Pawn->GetController())
+            {
+                Pawn->SpawnDefaultController();
+            }
+            SpawnedAI.Add(Pawn);
+            break;
+        }
+
+        case FBenchmarkScriptEvent::EType::AlertAI:
+            if (SpawnedAI.IsValidIndex(Event.Target))
+            {
+                if (AFPSAICharacter* AI = Cast<AFPSAICharacter>(SpawnedAI[Event.Target].Get()))
+                {
+                    AI->AlertToLocation(Location);
+                }
+            }
+            break;
+
+        case FBenchmarkScriptEvent::EType::SpawnDestructible:
+        {
+            AStaticMeshActor* Host = World->SpawnActor<AStaticMeshActor>(Location, FRotator::ZeroRotator, SpawnParams);
+            UEnvironmentalDestructionSystem* Destruction = nullptr;
+            if (Host)
+            {
+                Destruction = NewObject<UEnvironmentalDestructionSystem>(Host);
+                Destruction->RegisterComponent();
+            }
+            Destructibles.Add(Host);
+            DestructionComponents.Add(Destruction);
+            break;
+        }
+
+        case FBenchmarkScriptEvent::EType::DamageDestructible:
+        case FBenchmarkScriptEvent::EType::ResetDestructible:
+        {
+            UEnvironmentalDestructionSystem* Destruction = DestructionComponents.IsValidIndex(Event.Target) ? DestructionComponents[Event.Target].Get() : nullptr;
+            AActor* Host = Destructibles.IsValidIndex(Event.Target) ? Destructibles[Event.Target].Get() : nullptr;
+            if (!Destruction || !Host) break;
+
+            if (Event.Type == FBenchmarkScriptEvent::EType::ResetDestructible)
+            {
+                if (Destruction->IsDestroyed())
+                {
+                    Destruction->ResetObject();
+                }
+            }
+            else if (!Destruction->IsDestroyed())
+            {
+                Destruction->ApplyDamage(Destruction->GetMaxHealth() * 2.0f, EDamageType::Explosion, Host->GetActorLocation() + Event.Location, Event.Direction);
+            }
+            break;
+        }
+
+        case FBenchmarkScriptEvent::EType::MuzzleFlash:
+        case FBenchmarkScriptEvent::EType::Impact:
+        case FBenchmarkScriptEvent::EType::Tracer:
+        {
+            if (!EffectComponent.IsValid())
+            {
+                AStaticMeshActor* Host = World->SpawnActor<AStaticMeshActor>(Origin, FRotator::ZeroRotator, SpawnParams);
+                if (!Host) break;
+
+                UPooledWeaponEffectsComponent* Effects = NewObject<UPooledWeaponEffectsComponent>(Host);
+                Effects->RegisterComponent();
+                EffectHost = Host;
+                EffectComponent = Effects;
+            }
+
+            UPooledWeaponEffectsComponent* Effects = EffectComponent.Get();
+            if (Event.Type == FBenchmarkScriptEvent::EType::MuzzleFlash)
+            {
+                Effects->SpawnMuzzleFlash(Location, Event.Direction.Rotation());
+            }
+            else if (Event.Type == FBenchmarkScriptEvent::EType::Impact)
+            {
+                FHitResult Hit;
+                Hit.Location = Location;
+                Hit.ImpactPoint = Location;
+                Hit.Normal = -Event.Direction;
+                Hit.ImpactNormal = -Event.Direction;
+                Effects->SpawnImpactEffect(Location, Event.Direction.Rotation(), Hit);
+            }
+            else
+            {
+                Effects->SpawnBulletTracer(Location, Location + Event.Direction * 2000.0f);
+            }
+            break;
+        }
+    }
+}
+
+TMap<FString, float> FDeterministicBenchmark::GetScopeAveragesMs() const
+{
+    TMap<FString, float> Averages;
+    const int32 NumFrames = FMath::Max(FrameTimesMs.Num(), 1);
+    for (const TPair<FName, double>& Scope : ScopeTotalsMs)
+    {
+        Averages.Add(Scope.Key.ToString(), (float)(Scope.Value / NumFrames));
+    }
+    return Averages;
+}
+
+FString FDeterministicBenchmark::GetScenarioName(EBenchmarkScenario Scenario)
+{
+    switch (Scenario)
+    {
+        case EBenchmarkScenario::AIFirefight:      return TEXT("AIFirefight");
+        case EBenchmarkScenario::DestructionBurst: return TEXT("DestructionBurst");
+        case EBenchmarkScenario::EffectSpam:       return TEXT("EffectSpam");
+        default:                                   return TEXT("Unknown");
+    }
+}
+
+void FDeterministicBenchmark::BuildScript(EBenchmarkScenario Scenario, const FBenchmarkRunSettings& Settings, TArray<FBenchmarkScriptEvent>& OutEvents)
+{
+    using EType = FBenchmarkScriptEvent::EType;
+
+    OutEvents.Reset();
+    FRandomStream Stream(Settings.RandomSeed);
+    const int32 TotalFrames = FMath::Max(Settings.WarmupFrames, 0) + FMath::Max(Settings.MeasuredFrames, 1);
+
+    switch (Scenario)
+    {
+        case EBenchmarkScenario::AIFirefight:
+        {
+            const int32 AICount = FMath::Max(Settings.AICount, 1);
+            for (int32 Index = 0; Index < AICount; ++Index)
+            {
+                OutEvents.Add(MakeEvent(0, EType::SpawnAI, Index, RandomRingPoint(Stream, 1500.0f, 3000.0f)));
+            }
+
+            // Gunfire around the player keeps the squad moving and engaging
+            for (int32 Frame = 1; Frame < TotalFrames; Frame += 10)
+            {
+                OutEvents.Add(MakeEvent(Frame, EType::AlertAI, Stream.RandRange(0, AICount - 1), RandomRingPoint(Stream, 0.0f, 800.0f)));
+            }
+            break;
+        }
+
+        case EBenchmarkScenario::DestructionBurst:
+        {
+            const int32 Count = FMath::Max(Settings.DestructibleCount, 1);
+            for (int32 Index = 0; Index < Count; ++Index)
+            {
+                OutEvents.Add(MakeEvent(0, EType::SpawnDestructible, Index, RandomRingPoint(Stream, 800.0f, 2500.0f)));
+            }
+
+            // Everything is restored before each burst so every burst breaks the same number of objects
+            const int32 Interval = FMath::Max(Settings.DestructionBurstInterval, 1);
+            for (int32 Frame = Interval; Frame < TotalFrames; Frame += Interval)
+            {
+                for (int32 Index = 0; Index < Count; ++Index)
+                {
+                    OutEvents.Add(MakeEvent(Frame, EType::ResetDestructible, Index, FVector::ZeroVector));
+                }
+
+                for (int32 Hit = 0; Hit < Settings.DestructiblesPerBurst; ++Hit)
+                {
+                    OutEvents.Add(MakeEvent(Frame, EType::DamageDestructible, Stream.RandRange(0, Count - 1), Stream.VRand() * 50.0f, Stream.VRand()));
+                }
+            }
+            break;
+        }
+
+        case EBenchmarkScenario::EffectSpam:
+        {
+            static const EType EffectTypes[] = { EType::MuzzleFlash, EType::Impact, EType::Tracer };
+            for (int32 Frame = 0; Frame < TotalFrames; ++Frame)
+            {
+                for (int32 Effect = 0; Effect < Settings.EffectsPerFrame; ++Effect)
+                {
+                    FVector Location = RandomRingPoint(Stream, 200.0f, 2000.0f);
+                    Location.Z = Stream.FRandRange(0.0f, 300.0f);
+                    OutEvents.Add(MakeEvent(Frame, EffectTypes[Effect % UE_ARRAY_COUNT(EffectTypes)], INDEX_NONE, Location, Stream.VRand()));
+                }
+            }
+            break;
+        }
+    }
+
+    OutEvents.StableSort([](const FBenchmarkScriptEvent& A, const FBenchmarkScriptEvent& B) { return A.Frame < B.Frame; });
+}
+
+float FDeterministicBenchmark::GetPercentile(const TArray<float>& SortedValues, float Percentile)
+{
+    if (SortedValues.Num() == 0) return 0.0f;
+
+    const int32 Rank = FMath::CeilToInt(FMath::Clamp(Percentile, 0.0f, 1.0f) * SortedValues.Num());
+    return SortedValues[FMath::Clamp(Rank - 1, 0, SortedValues.Num() - 1)];
+}
+
+void FDeterministicBenchmark::AddFrameTimeStats(const TArray<float>& InFrameTimesMs, float HitchThresholdMs, TMap<FString, float>& OutMetrics)
+{
+    TArray<float> Sorted = InFrameTimesMs;
+    Sorted.Sort();
+
+    double Sum = 0.0;
+    int32 Hitches = 0;
+    for (float FrameTimeMs : Sorted)
+    {
+        Sum += FrameTimeMs;
+        Hitches += FrameTimeMs > HitchThresholdMs ? 1 : 0;
+    }
+
+    OutMetrics.Add(TEXT("FrameTimeAvgMs"), Sorted.Num() > 0 ? (float)(Sum / Sorted.Num()) : 0.0f);
+    OutMetrics.Add(TEXT("FrameTimeP50Ms"), GetPercentile(Sorted, 0.5f));
+    OutMetrics.Add(TEXT("FrameTimeP95Ms"), GetPercentile(Sorted, 0.95f));
+    OutMetrics.Add(TEXT("FrameTimeP99Ms"), GetPercentile(Sorted, 0.99f));
+    OutMetrics.Add(TEXT("FrameTimeMaxMs"), Sorted.Num() > 0 ? Sorted.Last() : 0.0f);
+    OutMetrics.Add(TEXT("Hitches"), (float)Hitches);
+}
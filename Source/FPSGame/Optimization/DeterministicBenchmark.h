@@ -0,0 +1,189 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Math/RandomStream.h"
+#include "Templates/SubclassOf.h"
+#include "DeterministicBenchmark.generated.h"
+
+class APawn;
+class AActor;
+class UWorld;
+class UEnvironmentalDestructionSystem;
+class UPooledWeaponEffectsComponent;
+class APerformanceOptimizationSystem;
+
+UENUM(BlueprintType)
+enum class EBenchmarkScenario : uint8
+{
+    AIFirefight         UMETA(DisplayName = "AI Firefight"),
+    DestructionBurst    UMETA(DisplayName = "Destruction Burst"),
+    EffectSpam          UMETA(DisplayName = "Effect Spam")
+};
+
+USTRUCT(BlueprintType)
+struct FBenchmarkRunSettings
+{
+    GENERATED_BODY()
+
+    // Seeds the scenario script and the global random generators
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Benchmark")
+    int32 RandomSeed = 12345;
+
+    // Game time advances by exactly this much per frame while the benchmark runs
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Benchmark")
+    float FixedStepSeconds = 1.0f / 60.0f;
+
+    // Frames run before measuring so pools, streaming and caches settle
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Benchmark")
+    int32 WarmupFrames = 60;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Benchmark")
+    int32 MeasuredFrames = 600;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Benchmark")
+    float HitchThresholdMs = 33.0f;
+
+    // AI firefight
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Benchmark|Scenarios")
+    TSubclassOf<APawn> AIClass;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Benchmark|Scenarios")
+    int32 AICount = 12;
+
+    // Destruction burst
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Benchmark|Scenarios")
+    int32 DestructibleCount = 24;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Benchmark|Scenarios")
+    int32 DestructiblesPerBurst = 8;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Benchmark|Scenarios")
+    int32 DestructionBurstInterval = 60;
+
+    // Effect spam
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Benchmark|Scenarios")
+    int32 EffectsPerFrame = 12;
+
+    // Results are compared against this file in Saved/Performance
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Benchmark|Reporting")
+    FString BaselineFile = TEXT("BenchmarkBaseline.json");
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Benchmark|Reporting")
+    bool bWriteBaselineIfMissing = true;
+
+    // p95 or p99 slower than the baseline by more than this counts as a regression
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Benchmark|Reporting")
+    float RegressionThresholdPercent = 10.0f;
+
+    // Written as <ReportName>.json and <ReportName>.csv
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Benchmark|Reporting")
+    FString ReportName = TEXT("DeterministicBenchmark");
+};
+
+// One scripted action; locations are relative to the scenario origin
+struct FBenchmarkScriptEvent
+{
+    enum class EType : uint8
+    {
+        SpawnAI,
+        AlertAI,
+        SpawnDestructible,
+        DamageDestructible,
+        ResetDestructible,
+        MuzzleFlash,
+        Impact,
+        Tracer
+    };
+
+    int32 Frame = 0;
+    EType Type = EType::SpawnAI;
+    int32 Target = INDEX_NONE;
+    FVector Location = FVector::ZeroVector;
+    FVector Direction = FVector::ForwardVector;
+};
+
+/**
+ * Runs one scripted scenario frame by frame under a fixed seed and fixed time step.
+ * The script is generated up front from the seed, so two runs issue the same actions on the same frames.
+ */
+class FPSGAME_API FDeterministicBenchmark
+{
+public:
+    FDeterministicBenchmark(UWorld* InWorld, EBenchmarkScenario InScenario, const FBenchmarkRunSettings& InSettings);
+    ~FDeterministicBenchmark();
+
+    // Seeds, switches to fixed stepping and spawns the scenario actors
+    void Begin();
+
+    // Runs one frame of the script; returns false once every measured frame is recorded
+    bool Step();
+
+    // Removes everything the scenario spawned and restores the previous time step
+    void End();
+
+    EBenchmarkScenario GetScenario() const { return Scenario; }
+    const FBenchmarkRunSettings& GetSettings() const { return Settings; }
+    const TArray<float>& GetFrameTimesMs() const { return FrameTimesMs; }
+    const TArray<float>& GetGameThreadTimesMs() const { return GameThreadTimesMs; }
+
+    // Average per measured frame of each telemetry scope
+    TMap<FString, float> GetScopeAveragesMs() const;
+
+    static FString GetScenarioName(EBenchmarkScenario Scenario);
+
+    // Same seed and settings always give the same events, ordered by frame
+    static void BuildScript(EBenchmarkScenario Scenario, const FBenchmarkRunSettings& Settings, TArray<FBenchmarkScriptEvent>& OutEvents);
+
+    // Nearest-rank percentile (0..1) of ascending values
+    static float GetPercentile(const TArray<float>& SortedValues, float Percentile);
+
+    // Adds FrameTimeAvgMs, FrameTimeP50Ms/P95Ms/P99Ms, FrameTimeMaxMs and Hitches
+    static void AddFrameTimeStats(const TArray<float>& InFrameTimesMs, float HitchThresholdMs, TMap<FString, float>& OutMetrics);
+
+private:
+    UWorld* World;
+    EBenchmarkScenario Scenario;
+    FBenchmarkRunSettings Settings;
+
+    TArray<FBenchmarkScriptEvent> Script;
+    int32 NextEvent = 0;
+    int32 Frame = 0;
+    FVector Origin = FVector::ZeroVector;
+
+    TArray<TWeakObjectPtr<APawn>> SpawnedAI;
+    TArray<TWeakObjectPtr<AActor>> Destructibles;
+    TArray<TWeakObjectPtr<UEnvironmentalDestructionSystem>> DestructionComponents;
+    TWeakObjectPtr<AActor> EffectHost;
+    TWeakObjectPtr<UPooledWeaponEffectsComponent> EffectComponent;
+
+    TArray<float> FrameTimesMs;
+    TArray<float> GameThreadTimesMs;
+    TMap<FName, double> ScopeTotalsMs;
+    uint64 LastScopeFrame = 0;
+    double LastStepTime = 0.0;
+
+    // Adaptive quality is paused so every run does the same amount of work; End puts back what it had set
+    struct FPausedQualityController
+    {
+        TWeakObjectPtr<APerformanceOptimizationSystem> System;
+        bool bWasEnabled = false;
+        float MaxCullingDistance = 0.0f;
+    };
+
+    struct FPausedEffectQuality
+    {
+        TWeakObjectPtr<UPooledWeaponEffectsComponent> Component;
+        bool bWasExternal = false;
+        float QualityScale = 1.0f;
+    };
+
+    TArray<FPausedQualityController> PausedQualityControllers;
+    TArray<FPausedEffectQuality> PausedEffectQuality;
+
+    bool bSavedFixedTimeStep = false;
+    double SavedFixedDeltaTime = 0.0;
+    bool bRunning = false;
+
+    void RunEvent(const FBenchmarkScriptEvent& Event);
+    void RecordFrame(double Now);
+};
@@ -0,0 +1,47 @@
+#include "EffectRequestBuffer.h"
+#include "Algo/StableSort.h"
+
+bool FEffectRequestBuffer::Add(const FEffectRequest& Request)
+{
+    NumAdded++;
+
+    FMergeKey Key;
+    Key.Type = Request.Type;
+    Key.Asset = Request.Asset.Get();
+    Key.Cell = ToCell(Request.Location);
+
+    // A tracer is only the same tracer if it also ends in the same place
+    if (Request.Type == EEffectRequestType::Tracer)
+    {
+        Key.EndCell = ToCell(Request.Vector);
+    }
+
+    if (const int32* Existing = MergeCells.Find(Key))
+    {
+        Requests[*Existing].MergedCount++;
+        return true;
+    }
+
+    MergeCells.Add(Key, Requests.Add(Request));
+    return false;
+}
+
+void FEffectRequestBuffer::SortByRelevance()
+{
+    Algo::StableSortBy(Requests, [](const FEffectRequest& Request) { return Request.Relevance; }, TGreater<float>());
+}
+
+void FEffectRequestBuffer::Reset()
+{
+    Requests.Reset();
+    MergeCells.Reset();
+    NumAdded = 0;
+}
+
+FIntVector FEffectRequestBuffer::ToCell(const FVector& Location) const
+{
+    return FIntVector(
+        FMath::FloorToInt32(Location.X / MergeRadius),
+        FMath::FloorToInt32(Location.Y / MergeRadius),
+        FMath::FloorToInt32(Location.Z / MergeRadius));
+}
@@ -0,0 +1,91 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Engine/HitResult.h"
+
+enum class EEffectRequestType : uint8
+{
+    MuzzleFlash,
+    Impact,
+    ShellEject,
+    Decal,
+    Tracer
+};
+
+struct FEffectRequest
+{
+    EEffectRequestType Type = EEffectRequestType::Impact;
+    FVector Location = FVector::ZeroVector;
+    FRotator Rotation = FRotator::ZeroRotator;
+
+    // Tracer end, shell eject velocity or decal size
+    FVector Vector = FVector::ZeroVector;
+
+    // Tracer speed
+    float Speed = 0.0f;
+
+    // Particle system or decal material; requests only merge with others using the same one
+    TWeakObjectPtr<UObject> Asset;
+
+    FHitResult Hit;
+
+    // Requests folded into this one, itself included
+    int32 MergedCount = 1;
+
+    // Set by the owner before sorting; zero or less is never spawned
+    float Relevance = 0.0f;
+};
+
+/**
+ * One frame of effect requests.
+ * Requests of the same type and asset that land in the same merge cell are folded into the first one,
+ * so a shotgun blast against a wall becomes one impact and one decal instead of one per pellet.
+ */
+class FPSGAME_API FEffectRequestBuffer
+{
+public:
+    void SetMergeRadius(float InMergeRadius) { MergeRadius = FMath::Max(InMergeRadius, 1.0f); }
+    float GetMergeRadius() const { return MergeRadius; }
+
+    // Returns true when the request was merged into an earlier one
+    bool Add(const FEffectRequest& Request);
+
+    TArray<FEffectRequest>& GetRequests() { return Requests; }
+    const TArray<FEffectRequest>& GetRequests() const { return Requests; }
+    int32 Num() const { return Requests.Num(); }
+
+    // Requests added, including merged ones
+    int32 GetNumAdded() const { return NumAdded; }
+    int32 GetNumCoalesced() const { return NumAdded - Requests.Num(); }
+
+    // Highest relevance first; equal relevance keeps arrival order
+    void SortByRelevance();
+
+    void Reset();
+
+private:
+    struct FMergeKey
+    {
+        EEffectRequestType Type = EEffectRequestType::Impact;
+        const UObject* Asset = nullptr;
+        FIntVector Cell = FIntVector::ZeroValue;
+        FIntVector EndCell = FIntVector::ZeroValue;
+
+        bool operator==(const FMergeKey& Other) const
+        {
+            return Type == Other.Type && Asset == Other.Asset && Cell == Other.Cell && EndCell == Other.EndCell;
+        }
+
+        friend uint32 GetTypeHash(const FMergeKey& Key)
+        {
+            return HashCombine(HashCombine(HashCombine(GetTypeHash((uint8)Key.Type), GetTypeHash(Key.Asset)), GetTypeHash(Key.Cell)), GetTypeHash(Key.EndCell));
+        }
+    };
+
+    float MergeRadius = 50.0f;
+    TArray<FEffectRequest> Requests;
+    TMap<FMergeKey, int32> MergeCells;
+    int32 NumAdded = 0;
+
+    FIntVector ToCell(const FVector& Location) const;
+};
@@ -0,0 +1,30 @@
+#include "FPSGameStats.h"
+
+DEFINE_STAT(STAT_FPSGame_PoolAcquire);
+DEFINE_STAT(STAT_FPSGame_PoolRelease);
+DEFINE_STAT(STAT_FPSGame_BallisticsTick);
+DEFINE_STAT(STAT_FPSGame_AIUpdate);
+DEFINE_STAT(STAT_FPSGame_LOD);
+DEFINE_STAT(STAT_FPSGame_Culling);
+DEFINE_STAT(STAT_FPSGame_HUDDraw);
+DEFINE_STAT(STAT_FPSGame_AudioUpdate);
+DEFINE_STAT(STAT_FPSGame_DestructionChunks);
+
+std::atomic<uint64> FFPSGameCounters::Cycles[FFPSGameCounters::NumCounters] = {};
+
+FName FFPSGameCounters::GetName(EFPSGameCounter Counter)
+{
+    switch (Counter)
+    {
+        case EFPSGameCounter::PoolAcquire:       return TEXT("PoolAcquire");
+        case EFPSGameCounter::PoolRelease:       return TEXT("PoolRelease");
+        case EFPSGameCounter::BallisticsTick:    return TEXT("BallisticsTick");
+        case EFPSGameCounter::AIUpdate:          return TEXT("AIUpdate");
+        case EFPSGameCounter::LOD:               return TEXT("LOD");
+        case EFPSGameCounter::Culling:           return TEXT("Culling");
+        case EFPSGameCounter::HUDDraw:           return TEXT("HUDDraw");
+        case EFPSGameCounter::AudioUpdate:       return TEXT("AudioUpdate");
+        case EFPSGameCounter::DestructionChunks: return TEXT("DestructionChunks");
+        default:                                 return NAME_None;
+    }
+}
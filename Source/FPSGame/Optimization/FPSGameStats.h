@@ -0,0 +1,90 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Stats/Stats.h"
+#include "ProfilingDebugging/CpuProfilerTrace.h"
+#include <atomic>
+
+DECLARE_STATS_GROUP(TEXT("FPSGame"), STATGROUP_FPSGame, STATCAT_Advanced);
+
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Pool Acquire"), STAT_FPSGame_PoolAcquire, STATGROUP_FPSGame, FPSGAME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Pool Release"), STAT_FPSGame_PoolRelease, STATGROUP_FPSGame, FPSGAME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Ballistics Tick"), STAT_FPSGame_BallisticsTick, STATGROUP_FPSGame, FPSGAME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("AI Update"), STAT_FPSGame_AIUpdate, STATGROUP_FPSGame, FPSGAME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("LOD"), STAT_FPSGame_LOD, STATGROUP_FPSGame, FPSGAME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Culling"), STAT_FPSGame_Culling, STATGROUP_FPSGame, FPSGAME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("HUD Draw"), STAT_FPSGame_HUDDraw, STATGROUP_FPSGame, FPSGAME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Audio Update"), STAT_FPSGame_AudioUpdate, STATGROUP_FPSGame, FPSGAME_API);
+DECLARE_CYCLE_STAT_EXTERN(TEXT("Destruction Chunks"), STAT_FPSGame_DestructionChunks, STATGROUP_FPSGame, FPSGAME_API);
+
+// Named hot-path counters; each has a matching STAT_FPSGame_ cycle stat
+enum class EFPSGameCounter : uint8
+{
+    PoolAcquire,
+    PoolRelease,
+    BallisticsTick,
+    AIUpdate,
+    LOD,
+    Culling,
+    HUDDraw,
+    AudioUpdate,
+    DestructionChunks,
+    Count
+};
+
+/**
+ * Process-wide cycle totals for the hot-path counters.
+ * Scopes add from any thread; UFrameTelemetrySubsystem drains them once per frame into its scope timings.
+ */
+class FPSGAME_API FFPSGameCounters
+{
+public:
+    static constexpr int32 NumCounters = (int32)EFPSGameCounter::Count;
+
+    static FName GetName(EFPSGameCounter Counter);
+
+    FORCEINLINE static void AddCycles(EFPSGameCounter Counter, uint64 InCycles)
+    {
+        Cycles[(int32)Counter].fetch_add(InCycles, std::memory_order_relaxed);
+    }
+
+    // Returns the cycles gathered since the last call and starts over
+    FORCEINLINE static uint64 ConsumeCycles(EFPSGameCounter Counter)
+    {
+        return Cycles[(int32)Counter].exchange(0, std::memory_order_relaxed);
+    }
+
+private:
+    static std::atomic<uint64> Cycles[NumCounters];
+};
+
+class FFPSGameCounterScope
+{
+public:
+    FORCEINLINE explicit FFPSGameCounterScope(EFPSGameCounter InCounter)
+        : Counter(InCounter)
+        , StartCycles(FPlatformTime::Cycles64())
+    {
+    }
+
+    FORCEINLINE ~FFPSGameCounterScope()
+    {
+        FFPSGameCounters::AddCycles(Counter, FPlatformTime::Cycles64() - StartCycles);
+    }
+
+private:
+    EFPSGameCounter Counter;
+    uint64 StartCycles;
+};
+
+// Stats builds time through the cycle stat (which also reaches Insights with -statnamedevents); others emit a trace event
+#if STATS
+#define FPSGAME_PROFILER_SCOPE(CounterName) SCOPE_CYCLE_COUNTER(STAT_FPSGame_##CounterName)
+#else
+#define FPSGAME_PROFILER_SCOPE(CounterName) TRACE_CPUPROFILER_EVENT_SCOPE(FPSGame_##CounterName)
+#endif
+
+// Times the enclosing scope into the profiler and the per-frame game counter of the same name
+#define FPSGAME_SCOPE_CYCLE_COUNTER(CounterName) \
+    FPSGAME_PROFILER_SCOPE(CounterName); \
+    FFPSGameCounterScope PREPROCESSOR_JOIN(FPSGameCounterScope_, __LINE__)(EFPSGameCounter::CounterName)
@@ -0,0 +1,273 @@
+#include "FrameBudgetSubsystem.h"
+#include "Engine/World.h"
+#include "Engine/Engine.h"
+#include "RenderCore.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogFrameBudget, Log, All);
+
+namespace
+{
+    // Weight of the newest frame in each consumer's average use
+    const float UsageSmoothing = 0.1f;
+
+    const EFrameBudgetPriority PriorityOrder[] =
+    {
+        EFrameBudgetPriority::Critical,
+        EFrameBudgetPriority::High,
+        EFrameBudgetPriority::Normal,
+        EFrameBudgetPriority::Low
+    };
+
+    const TCHAR* GetPriorityName(EFrameBudgetPriority Priority)
+    {
+        switch (Priority)
+        {
+            case EFrameBudgetPriority::Critical: return TEXT("Critical");
+            case EFrameBudgetPriority::High:     return TEXT("High");
+            case EFrameBudgetPriority::Normal:   return TEXT("Normal");
+            case EFrameBudgetPriority::Low:      return TEXT("Low");
+            default:                             return TEXT("Unknown");
+        }
+    }
+}
+
+// FFrameBudgetAllocator
+
+FFrameBudgetAllocator::FFrameBudgetAllocator()
+{
+    Reset();
+}
+
+int32 FFrameBudgetAllocator::RegisterConsumer(FName Name, EFrameBudgetPriority Priority, float MinBudgetUs, float DesiredBudgetUs)
+{
+    const int32 Existing = FindConsumer(Name);
+    if (Existing != INDEX_NONE)
+    {
+        return Existing;
+    }
+
+    if (NumConsumers >= MaxConsumers)
+    {
+        UE_LOG(LogFrameBudget, Warning, TEXT("No frame budget slot left for %s"), *Name.ToString());
+        return INDEX_NONE;
+    }
+
+    FConsumer& Consumer = Consumers[NumConsumers];
+    Consumer = FConsumer();
+    Consumer.Name = Name;
+    Consumer.Priority = Priority;
+    Consumer.MinBudgetUs = FMath::Max(0.0f, MinBudgetUs);
+    Consumer.DesiredBudgetUs = FMath::Max(Consumer.MinBudgetUs, DesiredBudgetUs);
+
+    // Until the next allocation a new consumer runs on what it asked for
+    Consumer.GrantedUs = Consumer.DesiredBudgetUs;
+
+    return NumConsumers++;
+}
+
+int32 FFrameBudgetAllocator::FindConsumer(FName Name) const
+{
+    for (int32 Index = 0; Index < NumConsumers; ++Index)
+    {
+        if (Consumers[Index].Name == Name)
+        {
+            return Index;
+        }
+    }
+    return INDEX_NONE;
+}
+
+void FFrameBudgetAllocator::SetDesiredBudget(int32 Consumer, float DesiredBudgetUs)
+{
+    if (IsValidConsumer(Consumer))
+    {
+        Consumers[Consumer].DesiredBudgetUs = FMath::Max(Consumers[Consumer].MinBudgetUs, DesiredBudgetUs);
+    }
+}
+
+void FFrameBudgetAllocator::Allocate(float TargetFrameUs, float GameThreadUs)
+{
+    // Close the frame: what the consumers spent and how far past their grants they went
+    float BudgetedUs = 0.0f;
+    float OverrunUs = 0.0f;
+    for (int32 Index = 0; Index < NumConsumers; ++Index)
+    {
+        FConsumer& Consumer = Consumers[Index];
+        if (Consumer.UsedUs > Consumer.GrantedUs)
+        {
+            OverrunUs += Consumer.UsedUs - Consumer.GrantedUs;
+            Consumer.Overruns++;
+        }
+
+        BudgetedUs += Consumer.UsedUs;
+        Consumer.AverageUsedUs = FMath::Lerp(Consumer.AverageUsedUs, Consumer.UsedUs, UsageSmoothing);
+        Consumer.LastUsedUs = Consumer.UsedUs;
+        Consumer.UsedUs = 0.0f;
+    }
+
+    // Everything else the game thread did; rises are trusted immediately, falls only gradually
+    const float FrameUnbudgetedUs = FMath::Max(0.0f, GameThreadUs - BudgetedUs);
+    if (!bHasUnbudgetedEstimate || FrameUnbudgetedUs > UnbudgetedUs)
+    {
+        UnbudgetedUs = FrameUnbudgetedUs;
+        bHasUnbudgetedEstimate = true;
+    }
+    else
+    {
+        UnbudgetedUs = FMath::Lerp(UnbudgetedUs, FrameUnbudgetedUs, FMath::Clamp(Settings.UnbudgetedSmoothing, 0.0f, 1.0f));
+    }
+
+    // Overruns are paid back out of the shared pool over the next few frames
+    OverrunDebtUs += OverrunUs;
+    const float RepayUs = OverrunDebtUs * FMath::Clamp(Settings.OverrunRepayRate, 0.0f, 1.0f);
+    OverrunDebtUs -= RepayUs;
+
+    PoolUs = FMath::Max(0.0f, TargetFrameUs * Settings.GameThreadShare - UnbudgetedUs - RepayUs);
+
+    // Minimums first so every consumer keeps making progress, even when the frame is already over
+    float RemainingUs = PoolUs;
+    for (int32 Index = 0; Index < NumConsumers; ++Index)
+    {
+        Consumers[Index].GrantedUs = Consumers[Index].MinBudgetUs;
+        RemainingUs -= Consumers[Index].MinBudgetUs;
+    }
+    RemainingUs = FMath::Max(0.0f, RemainingUs);
+
+    // Then each priority in turn up to the desired budgets; a priority that doesn't fit is scaled evenly
+    for (EFrameBudgetPriority Priority : PriorityOrder)
+    {
+        float WantedUs = 0.0f;
+        for (int32 Index = 0; Index < NumConsumers; ++Index)
+        {
+            if (Consumers[Index].Priority == Priority)
+            {
+                WantedUs += Consumers[Index].DesiredBudgetUs - Consumers[Index].GrantedUs;
+            }
+        }
+
+        if (WantedUs <= 0.0f)
+        {
+            continue;
+        }
+
+        const float Share = FMath::Min(1.0f, RemainingUs / WantedUs);
+        for (int32 Index = 0; Index < NumConsumers; ++Index)
+        {
+            FConsumer& Consumer = Consumers[Index];
+            if (Consumer.Priority == Priority)
+            {
+                Consumer.GrantedUs += (Consumer.DesiredBudgetUs - Consumer.GrantedUs) * Share;
+            }
+        }
+        RemainingUs = FMath::Max(0.0f, RemainingUs - WantedUs * Share);
+    }
+}
+
+FFrameBudgetConsumerStats FFrameBudgetAllocator::GetConsumerStats(int32 Consumer) const
+{
+    FFrameBudgetConsumerStats Stats;
+    if (IsValidConsumer(Consumer))
+    {
+        const FConsumer& Source = Consumers[Consumer];
+        Stats.Name = Source.Name;
+        Stats.Priority = Source.Priority;
+        Stats.DesiredUs = Source.DesiredBudgetUs;
+        Stats.GrantedUs = Source.GrantedUs;
+        Stats.UsedUs = Source.LastUsedUs;
+        Stats.AverageUsedUs = Source.AverageUsedUs;
+        Stats.Overruns = Source.Overruns;
+    }
+    return Stats;
+}
+
+void FFrameBudgetAllocator::Reset()
+{
+    for (int32 Index = 0; Index < NumConsumers; ++Index)
+    {
+        FConsumer& Consumer = Consumers[Index];
+        Consumer.GrantedUs = Consumer.DesiredBudgetUs;
+        Consumer.UsedUs = 0.0f;
+        Consumer.LastUsedUs = 0.0f;
+        Consumer.AverageUsedUs = 0.0f;
+        Consumer.Overruns = 0;
+    }
+
+    PoolUs = 0.0f;
+    UnbudgetedUs = 0.0f;
+    OverrunDebtUs = 0.0f;
+    bHasUnbudgetedEstimate = false;
+}
+
+// UFrameBudgetSubsystem
+
+void UFrameBudgetSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    Allocator.Reset();
+    LastAllocatedTime = -1.0;
+
+    UE_LOG(LogFrameBudget, Log, TEXT("Frame budget arbiter initialized (%.2fms target)"), TargetFrameTimeMs);
+}
+
+void UFrameBudgetSubsystem::Deinitialize()
+{
+    Allocator.Reset();
+
+    Super::Deinitialize();
+}
+
+bool UFrameBudgetSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UFrameBudgetSubsystem::Tick(float DeltaTime)
+{
+    const double Now = GetWorld()->GetTimeSeconds();
+    if (Now == LastAllocatedTime)
+    {
+        return;
+    }
+    LastAllocatedTime = Now;
+
+    // Usage reported since the last tick is charged against the grants made then, whatever order the consumers tick in
+    Allocator.Allocate(TargetFrameTimeMs * 1000.0f, (float)(FPlatformTime::ToMilliseconds(GGameThreadTime) * 1000.0));
+}
+
+TStatId UFrameBudgetSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UFrameBudgetSubsystem, STATGROUP_Tickables);
+}
+
+UFrameBudgetSubsystem* UFrameBudgetSubsystem::Get(const UObject* WorldContextObject)
+{
+    UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
+    return World ? World->GetSubsystem<UFrameBudgetSubsystem>() : nullptr;
+}
+
+TArray<FFrameBudgetConsumerStats> UFrameBudgetSubsystem::GetConsumerStats() const
+{
+    TArray<FFrameBudgetConsumerStats> Stats;
+    Stats.Reserve(Allocator.GetNumConsumers());
+    for (int32 Consumer = 0; Consumer < Allocator.GetNumConsumers(); ++Consumer)
+    {
+        Stats.Add(Allocator.GetConsumerStats(Consumer));
+    }
+    return Stats;
+}
+
+FString UFrameBudgetSubsystem::GenerateBudgetReport() const
+{
+    FString Report = TEXT("=== Frame Budget ===\n");
+    Report += FString::Printf(TEXT("Target: %.2fms, Pool: %.0fus, Unbudgeted: %.0fus, Overrun Debt: %.0fus\n"),
+        TargetFrameTimeMs, Allocator.GetPoolUs(), Allocator.GetUnbudgetedUs(), Allocator.GetOverrunDebtUs());
+
+    for (const FFrameBudgetConsumerStats& Stats : GetConsumerStats())
+    {
+        Report += FString::Printf(TEXT("  %s (%s): granted %.0fus of %.0fus, used %.0fus (avg %.0fus), %d overruns\n"),
+            *Stats.Name.ToString(), GetPriorityName(Stats.Priority), Stats.GrantedUs, Stats.DesiredUs,
+            Stats.UsedUs, Stats.AverageUsedUs, Stats.Overruns);
+    }
+    return Report;
+}
@@ -0,0 +1,229 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "FrameBudgetSubsystem.generated.h"
+
+// Higher priorities are served first; everything below is shrunk before they are
+UENUM(BlueprintType)
+enum class EFrameBudgetPriority : uint8
+{
+    Critical    UMETA(DisplayName = "Critical"),
+    High        UMETA(DisplayName = "High"),
+    Normal      UMETA(DisplayName = "Normal"),
+    Low         UMETA(DisplayName = "Low")
+};
+
+USTRUCT(BlueprintType)
+struct FFrameBudgetSettings
+{
+    GENERATED_BODY()
+
+    // Share of the target frame the game thread may use; the rest is headroom for the frame's sync points
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Frame Budget")
+    float GameThreadShare = 0.8f;
+
+    // Weight of the newest frame in the smoothed cost of unbudgeted game-thread work; increases are taken at once
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Frame Budget")
+    float UnbudgetedSmoothing = 0.1f;
+
+    // Fraction of the outstanding overrun taken back from the pool each frame
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Frame Budget")
+    float OverrunRepayRate = 0.5f;
+};
+
+USTRUCT(BlueprintType)
+struct FFrameBudgetConsumerStats
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Frame Budget")
+    FName Name;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Frame Budget")
+    EFrameBudgetPriority Priority = EFrameBudgetPriority::Normal;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Frame Budget")
+    float DesiredUs = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Frame Budget")
+    float GrantedUs = 0.0f;
+
+    // Last closed frame
+    UPROPERTY(BlueprintReadOnly, Category = "Frame Budget")
+    float UsedUs = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Frame Budget")
+    float AverageUsedUs = 0.0f;
+
+    // Frames that used more than they were granted
+    UPROPERTY(BlueprintReadOnly, Category = "Frame Budget")
+    int32 Overruns = 0;
+};
+
+/**
+ * Hands out per-frame microsecond budgets by priority from the game-thread time left over by unbudgeted work.
+ * Every consumer is granted its minimum, then priorities are filled in order up to each consumer's desired budget.
+ * Usage reported above a grant is owed and taken back from the next frames' pool, so the lower priorities shrink first.
+ */
+class FPSGAME_API FFrameBudgetAllocator
+{
+public:
+    static constexpr int32 MaxConsumers = 16;
+
+    FFrameBudgetAllocator();
+
+    void SetSettings(const FFrameBudgetSettings& InSettings) { Settings = InSettings; }
+    const FFrameBudgetSettings& GetSettings() const { return Settings; }
+
+    // Returns the existing consumer for a known name; INDEX_NONE once every slot is taken
+    int32 RegisterConsumer(FName Name, EFrameBudgetPriority Priority, float MinBudgetUs, float DesiredBudgetUs);
+    int32 FindConsumer(FName Name) const;
+    int32 GetNumConsumers() const { return NumConsumers; }
+
+    // Takes effect at the next allocation
+    void SetDesiredBudget(int32 Consumer, float DesiredBudgetUs);
+
+    float GetGrantedUs(int32 Consumer) const { return IsValidConsumer(Consumer) ? Consumers[Consumer].GrantedUs : 0.0f; }
+
+    // Granted minus what was reported since the last allocation; negative once overrun
+    float GetRemainingUs(int32 Consumer) const { return IsValidConsumer(Consumer) ? Consumers[Consumer].GrantedUs - Consumers[Consumer].UsedUs : 0.0f; }
+
+    // Adds to the consumer's use since the last allocation
+    void ReportUsage(int32 Consumer, float UsedUs)
+    {
+        if (IsValidConsumer(Consumer))
+        {
+            Consumers[Consumer].UsedUs += FMath::Max(0.0f, UsedUs);
+        }
+    }
+
+    // Closes the frame whose game thread took GameThreadUs and grants the budgets for the next one
+    void Allocate(float TargetFrameUs, float GameThreadUs);
+
+    float GetPoolUs() const { return PoolUs; }
+    float GetUnbudgetedUs() const { return UnbudgetedUs; }
+    float GetOverrunDebtUs() const { return OverrunDebtUs; }
+
+    FFrameBudgetConsumerStats GetConsumerStats(int32 Consumer) const;
+
+    // Clears grants, usage and debt; registered consumers are kept
+    void Reset();
+
+private:
+    struct FConsumer
+    {
+        FName Name;
+        EFrameBudgetPriority Priority = EFrameBudgetPriority::Normal;
+        float MinBudgetUs = 0.0f;
+        float DesiredBudgetUs = 0.0f;
+        float GrantedUs = 0.0f;
+        float UsedUs = 0.0f;
+        float LastUsedUs = 0.0f;
+        float AverageUsedUs = 0.0f;
+        int32 Overruns = 0;
+    };
+
+    FFrameBudgetSettings Settings;
+    FConsumer Consumers[MaxConsumers];
+    int32 NumConsumers = 0;
+
+    float PoolUs = 0.0f;
+    float UnbudgetedUs = 0.0f;
+    float OverrunDebtUs = 0.0f;
+    bool bHasUnbudgetedEstimate = false;
+
+    bool IsValidConsumer(int32 Consumer) const { return Consumer >= 0 && Consumer < NumConsumers; }
+};
+
+/**
+ * Per-world frame budget arbiter.
+ * AI, HUD, weapon effects and pool maintenance register as consumers, read their grant for the frame
+ * and report what they actually spent. Game thread only.
+ */
+UCLASS()
+class FPSGAME_API UFrameBudgetSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // USubsystem interface
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    // FTickableGameObject interface
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    static UFrameBudgetSubsystem* Get(const UObject* WorldContextObject);
+
+    UFUNCTION(BlueprintCallable, Category = "Frame Budget")
+    int32 RegisterConsumer(FName Name, EFrameBudgetPriority Priority, float MinBudgetUs, float DesiredBudgetUs)
+    {
+        return Allocator.RegisterConsumer(Name, Priority, MinBudgetUs, DesiredBudgetUs);
+    }
+
+    UFUNCTION(BlueprintCallable, Category = "Frame Budget")
+    void SetDesiredBudget(int32 Consumer, float DesiredBudgetUs) { Allocator.SetDesiredBudget(Consumer, DesiredBudgetUs); }
+
+    UFUNCTION(BlueprintCallable, Category = "Frame Budget")
+    float GetBudgetUs(int32 Consumer) const { return Allocator.GetGrantedUs(Consumer); }
+
+    UFUNCTION(BlueprintCallable, Category = "Frame Budget")
+    float GetRemainingBudgetUs(int32 Consumer) const { return Allocator.GetRemainingUs(Consumer); }
+
+    UFUNCTION(BlueprintCallable, Category = "Frame Budget")
+    void ReportUsage(int32 Consumer, float UsedUs) { Allocator.ReportUsage(Consumer, UsedUs); }
+
+    UFUNCTION(BlueprintCallable, Category = "Frame Budget")
+    void SetTargetFrameTime(float InTargetFrameTimeMs) { TargetFrameTimeMs = FMath::Max(1.0f, InTargetFrameTimeMs); }
+
+    UFUNCTION(BlueprintCallable, Category = "Frame Budget")
+    float GetTargetFrameTime() const { return TargetFrameTimeMs; }
+
+    UFUNCTION(BlueprintCallable, Category = "Frame Budget")
+    void SetBudgetSettings(const FFrameBudgetSettings& InSettings) { Allocator.SetSettings(InSettings); }
+
+    UFUNCTION(BlueprintCallable, Category = "Frame Budget")
+    TArray<FFrameBudgetConsumerStats> GetConsumerStats() const;
+
+    UFUNCTION(BlueprintCallable, Category = "Frame Budget")
+    FString GenerateBudgetReport() const;
+
+    FFrameBudgetAllocator& GetAllocator() { return Allocator; }
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    FFrameBudgetAllocator Allocator;
+    float TargetFrameTimeMs = 1000.0f / 60.0f;
+
+    // Grants are made once per world tick, matching how consumers are driven
+    double LastAllocatedTime = -1.0;
+};
+
+// Reports the time spent in its lifetime against a consumer; does nothing without a subsystem or consumer
+class FFrameBudgetScope
+{
+public:
+    FORCEINLINE FFrameBudgetScope(UFrameBudgetSubsystem* InBudget, int32 InConsumer)
+        : Budget(InConsumer != INDEX_NONE ? InBudget : nullptr)
+        , Consumer(InConsumer)
+        , StartCycles(Budget ? FPlatformTime::Cycles64() : 0)
+    {
+    }
+
+    FORCEINLINE ~FFrameBudgetScope()
+    {
+        if (Budget)
+        {
+            Budget->ReportUsage(Consumer, (float)(FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - StartCycles) * 1000.0));
+        }
+    }
+
+private:
+    UFrameBudgetSubsystem* Budget;
+    int32 Consumer;
+    uint64 StartCycles;
+};
@@ -0,0 +1,331 @@
+#include "FrameTelemetrySubsystem.h"
+#include "Engine/World.h"
+#include "Engine/Engine.h"
+#include "Misc/App.h"
+#include "RenderCore.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogFrameTelemetry, Log, All);
+
+// FFrameTelemetryBuffer
+
+FFrameTelemetryBuffer::FFrameTelemetryBuffer()
+{
+    static_assert((Capacity & (Capacity - 1)) == 0, "Telemetry capacity must be a power of two");
+}
+
+int32 FFrameTelemetryBuffer::RegisterScope(FName ScopeName)
+{
+    const int32 Existing = FindScope(ScopeName);
+    if (Existing != INDEX_NONE)
+    {
+        return Existing;
+    }
+
+    if (NumScopes >= MaxScopes)
+    {
+        UE_LOG(LogFrameTelemetry, Warning, TEXT("No telemetry scope left for %s"), *ScopeName.ToString());
+        return INDEX_NONE;
+    }
+
+    ScopeNames[NumScopes] = ScopeName;
+    return NumScopes++;
+}
+
+int32 FFrameTelemetryBuffer::FindScope(FName ScopeName) const
+{
+    for (int32 Index = 0; Index < NumScopes; ++Index)
+    {
+        if (ScopeNames[Index] == ScopeName)
+        {
+            return Index;
+        }
+    }
+    return INDEX_NONE;
+}
+
+void FFrameTelemetryBuffer::RecordFrame(uint64 FrameNumber, float FrameTimeMs, float GameThreadMs)
+{
+    const uint64 WriteIndex = WriteCount.load(std::memory_order_relaxed);
+    FSlot& Slot = Slots[WriteIndex & (Capacity - 1)];
+
+    // The slot still holds the frame leaving the window
+    if (WriteIndex >= (uint64)Capacity)
+    {
+        AddToWindow(Slot.Sample, -1);
+    }
+
+    // Judge the hitch against the window before this frame joins it
+    const bool bHitch = FrameTimeMs > HitchFloorMs && (NumSamples == 0 || FrameTimeMs > P50Ms * HitchMedianMultiplier);
+
+    const uint32 Sequence = Slot.Sequence.load(std::memory_order_relaxed);
+    Slot.Sequence.store(Sequence + 1, std::memory_order_relaxed);
+    std::atomic_thread_fence(std::memory_order_release);
+
+    Slot.Sample.FrameNumber = FrameNumber;
+    Slot.Sample.FrameTimeMs = FrameTimeMs;
+    Slot.Sample.GameThreadMs = GameThreadMs;
+    Slot.Sample.bHitch = bHitch;
+    for (int32 Scope = 0; Scope < MaxScopes; ++Scope)
+    {
+        Slot.Sample.ScopeMs[Scope] = (float)FPlatformTime::ToMilliseconds64(ScopeCycles[Scope].exchange(0, std::memory_order_relaxed));
+    }
+
+    Slot.Sequence.store(Sequence + 2, std::memory_order_release);
+    WriteCount.store(WriteIndex + 1, std::memory_order_release);
+
+    AddToWindow(Slot.Sample, 1);
+    if (bHitch)
+    {
+        TotalHitches++;
+    }
+
+    UpdatePercentiles();
+}
+
+bool FFrameTelemetryBuffer::ReadSample(int32 Age, FFrameTelemetrySample& OutSample) const
+{
+    const uint64 Count = WriteCount.load(std::memory_order_acquire);
+    if (Age < 0 || (uint64)Age >= FMath::Min<uint64>(Count, Capacity))
+    {
+        return false;
+    }
+
+    const uint64 SampleIndex = Count - 1 - Age;
+    const FSlot& Slot = Slots[SampleIndex & (Capacity - 1)];
+
+    // Each lap around the ring advances a slot's sequence by two, so this also rejects newer frames
+    const uint32 Expected = (uint32)(2 * (SampleIndex / Capacity + 1));
+    if (Slot.Sequence.load(std::memory_order_acquire) != Expected)
+    {
+        return false;
+    }
+
+    OutSample = Slot.Sample;
+    std::atomic_thread_fence(std::memory_order_acquire);
+
+    return Slot.Sequence.load(std::memory_order_relaxed) == Expected;
+}
+
+void FFrameTelemetryBuffer::SetHitchThresholds(float InHitchFloorMs, float InHitchMedianMultiplier)
+{
+    HitchFloorMs = FMath::Max(0.0f, InHitchFloorMs);
+    HitchMedianMultiplier = FMath::Max(1.0f, InHitchMedianMultiplier);
+}
+
+float FFrameTelemetryBuffer::GetAverageFrameTimeMs(int32 NumFrames, int32 SkipFrames) const
+{
+    float Total = 0.0f;
+    int32 Count = 0;
+
+    FFrameTelemetrySample Sample;
+    for (int32 Age = SkipFrames; Age < SkipFrames + NumFrames; ++Age)
+    {
+        if (!ReadSample(Age, Sample))
+        {
+            break;
+        }
+        Total += Sample.FrameTimeMs;
+        Count++;
+    }
+
+    return Count > 0 ? Total / Count : 0.0f;
+}
+
+float FFrameTelemetryBuffer::GetPercentileMs(float Percentile) const
+{
+    if (NumSamples == 0)
+    {
+        return 0.0f;
+    }
+
+    const int32 Rank = FMath::Clamp(FMath::CeilToInt(FMath::Clamp(Percentile, 0.0f, 1.0f) * NumSamples), 1, NumSamples);
+    int32 Cumulative = 0;
+    for (int32 Bucket = 0; Bucket < NumHistogramBuckets; ++Bucket)
+    {
+        Cumulative += Histogram[Bucket];
+        if (Cumulative >= Rank)
+        {
+            return (Bucket + 1) * HistogramBucketMs;
+        }
+    }
+    return NumHistogramBuckets * HistogramBucketMs;
+}
+
+float FFrameTelemetryBuffer::GetScopeAverageMs(int32 ScopeIndex) const
+{
+    if (ScopeIndex < 0 || ScopeIndex >= MaxScopes || NumSamples == 0)
+    {
+        return 0.0f;
+    }
+    return (float)(ScopeSumMs[ScopeIndex] / NumSamples);
+}
+
+FFrameTelemetryStats FFrameTelemetryBuffer::GetStats() const
+{
+    FFrameTelemetryStats Stats;
+    Stats.NumSamples = NumSamples;
+    Stats.AverageFrameTimeMs = GetAverageFrameTimeMs();
+    Stats.FrameTimeP50Ms = P50Ms;
+    Stats.FrameTimeP95Ms = P95Ms;
+    Stats.FrameTimeP99Ms = P99Ms;
+    Stats.HitchesInWindow = HitchesInWindow;
+    Stats.TotalHitches = TotalHitches;
+
+    FFrameTelemetrySample Newest;
+    if (ReadSample(0, Newest))
+    {
+        Stats.FrameTimeMs = Newest.FrameTimeMs;
+        Stats.GameThreadMs = Newest.GameThreadMs;
+    }
+
+    Stats.ScopeNames.Reserve(NumScopes);
+    Stats.ScopeAverageMs.Reserve(NumScopes);
+    for (int32 Scope = 0; Scope < NumScopes; ++Scope)
+    {
+        Stats.ScopeNames.Add(ScopeNames[Scope]);
+        Stats.ScopeAverageMs.Add(GetScopeAverageMs(Scope));
+    }
+
+    return Stats;
+}
+
+void FFrameTelemetryBuffer::Reset()
+{
+    for (FSlot& Slot : Slots)
+    {
+        Slot.Sequence.store(0, std::memory_order_relaxed);
+        Slot.Sample = FFrameTelemetrySample();
+    }
+    WriteCount.store(0, std::memory_order_release);
+
+    for (std::atomic<uint64>& Cycles : ScopeCycles)
+    {
+        Cycles.store(0, std::memory_order_relaxed);
+    }
+
+    FMemory::Memzero(Histogram, sizeof(Histogram));
+    FMemory::Memzero(ScopeSumMs, sizeof(ScopeSumMs));
+    NumSamples = 0;
+    FrameTimeSumMs = 0.0;
+    HitchesInWindow = 0;
+    TotalHitches = 0;
+    P50Ms = 0.0f;
+    P95Ms = 0.0f;
+    P99Ms = 0.0f;
+}
+
+int32 FFrameTelemetryBuffer::ToHistogramBucket(float FrameTimeMs)
+{
+    return FMath::Clamp(FMath::FloorToInt(FrameTimeMs / HistogramBucketMs), 0, NumHistogramBuckets - 1);
+}
+
+void FFrameTelemetryBuffer::AddToWindow(const FFrameTelemetrySample& Sample, int32 Direction)
+{
+    Histogram[ToHistogramBucket(Sample.FrameTimeMs)] += Direction;
+    NumSamples += Direction;
+    FrameTimeSumMs += Direction * (double)Sample.FrameTimeMs;
+    HitchesInWindow += Sample.bHitch ? Direction : 0;
+
+    for (int32 Scope = 0; Scope < NumScopes; ++Scope)
+    {
+        ScopeSumMs[Scope] += Direction * (double)Sample.ScopeMs[Scope];
+    }
+}
+
+void FFrameTelemetryBuffer::UpdatePercentiles()
+{
+    // One walk over the histogram serves all three ranks; cost does not depend on the window size
+    const int32 RankP50 = FMath::Max(1, FMath::CeilToInt(0.50f * NumSamples));
+    const int32 RankP95 = FMath::Max(1, FMath::CeilToInt(0.95f * NumSamples));
+    const int32 RankP99 = FMath::Max(1, FMath::CeilToInt(0.99f * NumSamples));
+
+    P50Ms = P95Ms = P99Ms = 0.0f;
+    int32 Cumulative = 0;
+    for (int32 Bucket = 0; Bucket < NumHistogramBuckets && Cumulative < RankP99; ++Bucket)
+    {
+        if (Histogram[Bucket] == 0)
+        {
+            continue;
+        }
+
+        Cumulative += Histogram[Bucket];
+        const float UpperBound = (Bucket + 1) * HistogramBucketMs;
+        if (P50Ms == 0.0f && Cumulative >= RankP50) P50Ms = UpperBound;
+        if (P95Ms == 0.0f && Cumulative >= RankP95) P95Ms = UpperBound;
+        if (Cumulative >= RankP99) P99Ms = UpperBound;
+    }
+}
+
+// UFrameTelemetrySubsystem
+
+void UFrameTelemetrySubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    Buffer.Reset();
+    LastRecordedFrame = 0;
+
+    for (int32 Counter = 0; Counter < FFPSGameCounters::NumCounters; ++Counter)
+    {
+        CounterScopes[Counter] = Buffer.RegisterScope(FFPSGameCounters::GetName((EFPSGameCounter)Counter));
+    }
+
+    UE_LOG(LogFrameTelemetry, Log, TEXT("Frame telemetry initialized (%d frame window)"), FFrameTelemetryBuffer::Capacity);
+}
+
+void UFrameTelemetrySubsystem::Deinitialize()
+{
+    Buffer.Reset();
+
+    Super::Deinitialize();
+}
+
+bool UFrameTelemetrySubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UFrameTelemetrySubsystem::Tick(float DeltaTime)
+{
+    // Guard against a second tick in the same engine frame
+    if (GFrameCounter == LastRecordedFrame)
+    {
+        return;
+    }
+    LastRecordedFrame = GFrameCounter;
+
+    // Counters are process-wide; with several game worlds the first to tick claims the frame's totals
+    for (int32 Counter = 0; Counter < FFPSGameCounters::NumCounters; ++Counter)
+    {
+        Buffer.AddScopeCycles(CounterScopes[Counter], FFPSGameCounters::ConsumeCycles((EFPSGameCounter)Counter));
+    }
+
+    // Real time rather than the dilated world delta; game-thread time is the engine's figure for the previous frame
+    Buffer.RecordFrame(GFrameCounter, (float)(FApp::GetDeltaTime() * 1000.0), (float)FPlatformTime::ToMilliseconds(GGameThreadTime));
+}
+
+TStatId UFrameTelemetrySubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UFrameTelemetrySubsystem, STATGROUP_Tickables);
+}
+
+UFrameTelemetrySubsystem* UFrameTelemetrySubsystem::Get(const UObject* WorldContextObject)
+{
+    UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
+    return World ? World->GetSubsystem<UFrameTelemetrySubsystem>() : nullptr;
+}
+
+FString UFrameTelemetrySubsystem::GenerateTelemetryReport() const
+{
+    const FFrameTelemetryStats Stats = Buffer.GetStats();
+
+    FString Report = TEXT("=== Frame Telemetry ===\n");
+    Report += FString::Printf(TEXT("Frames: %d, Average: %.2fms, Game Thread: %.2fms\n"), Stats.NumSamples, Stats.AverageFrameTimeMs, Stats.GameThreadMs);
+    Report += FString::Printf(TEXT("p50: %.2fms, p95: %.2fms, p99: %.2fms\n"), Stats.FrameTimeP50Ms, Stats.FrameTimeP95Ms, Stats.FrameTimeP99Ms);
+    Report += FString::Printf(TEXT("Hitches: %d in window, %d total\n"), Stats.HitchesInWindow, Stats.TotalHitches);
+    for (int32 Scope = 0; Scope < Stats.ScopeNames.Num(); ++Scope)
+    {
+        Report += FString::Printf(TEXT("  %s: %.3fms\n"), *Stats.ScopeNames[Scope].ToString(), Stats.ScopeAverageMs[Scope]);
+    }
+    return Report;
+}
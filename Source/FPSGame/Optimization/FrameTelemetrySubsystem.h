@@ -0,0 +1,233 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "FPSGameStats.h"
+#include <atomic>
+#include "FrameTelemetrySubsystem.generated.h"
+
+// Snapshot of the telemetry window; percentiles are histogram bucket upper bounds
+USTRUCT(BlueprintType)
+struct FFrameTelemetryStats
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Telemetry")
+    int32 NumSamples = 0;
+
+    // Newest frame
+    UPROPERTY(BlueprintReadOnly, Category = "Telemetry")
+    float FrameTimeMs = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Telemetry")
+    float GameThreadMs = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Telemetry")
+    float AverageFrameTimeMs = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Telemetry")
+    float FrameTimeP50Ms = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Telemetry")
+    float FrameTimeP95Ms = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Telemetry")
+    float FrameTimeP99Ms = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Telemetry")
+    int32 HitchesInWindow = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Telemetry")
+    int32 TotalHitches = 0;
+
+    // Registered scopes and their average cost per frame over the window
+    UPROPERTY(BlueprintReadOnly, Category = "Telemetry")
+    TArray<FName> ScopeNames;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Telemetry")
+    TArray<float> ScopeAverageMs;
+};
+
+// One frame of telemetry; scope times are summed over every thread that reported into the scope
+struct FFrameTelemetrySample
+{
+    static constexpr int32 MaxScopes = 16;
+
+    uint64 FrameNumber = 0;
+    float FrameTimeMs = 0.0f;
+    float GameThreadMs = 0.0f;
+    float ScopeMs[MaxScopes] = {};
+    bool bHitch = false;
+};
+
+/**
+ * Fixed window of per-frame samples with incrementally maintained statistics.
+ * One writer closes frames; samples can be read from any thread without locks (per-slot sequence counters),
+ * and scope timings can be reported from any thread. Window statistics belong to the writer's thread.
+ */
+class FPSGAME_API FFrameTelemetryBuffer
+{
+public:
+    static constexpr int32 Capacity = 256;
+    static constexpr int32 MaxScopes = FFrameTelemetrySample::MaxScopes;
+    static constexpr float HistogramBucketMs = 0.25f;
+    static constexpr int32 NumHistogramBuckets = 512;
+
+    FFrameTelemetryBuffer();
+
+    // Returns the existing slot for a known name; INDEX_NONE once every slot is taken. Writer thread only
+    int32 RegisterScope(FName ScopeName);
+    int32 FindScope(FName ScopeName) const;
+    FName GetScopeName(int32 ScopeIndex) const { return ScopeIndex >= 0 && ScopeIndex < NumScopes ? ScopeNames[ScopeIndex] : NAME_None; }
+    int32 GetNumScopes() const { return NumScopes; }
+
+    // Any thread; the time lands in whichever frame is open when RecordFrame runs next
+    FORCEINLINE void AddScopeCycles(int32 ScopeIndex, uint64 Cycles)
+    {
+        if (ScopeIndex >= 0 && ScopeIndex < MaxScopes)
+        {
+            ScopeCycles[ScopeIndex].fetch_add(Cycles, std::memory_order_relaxed);
+        }
+    }
+
+    // Closes the open frame, evicting the oldest sample from the window statistics once full
+    void RecordFrame(uint64 FrameNumber, float FrameTimeMs, float GameThreadMs);
+
+    // Any thread. Age 0 is the newest frame; false if that frame is not in the window or was overwritten mid-read
+    bool ReadSample(int32 Age, FFrameTelemetrySample& OutSample) const;
+
+    // Frames hitch when slower than both the floor and a multiple of the window median
+    void SetHitchThresholds(float InHitchFloorMs, float InHitchMedianMultiplier);
+
+    int32 GetNumSamples() const { return NumSamples; }
+    float GetAverageFrameTimeMs() const { return NumSamples > 0 ? (float)(FrameTimeSumMs / NumSamples) : 0.0f; }
+
+    // Average of NumFrames frames, skipping the newest SkipFrames
+    float GetAverageFrameTimeMs(int32 NumFrames, int32 SkipFrames = 0) const;
+
+    // Percentile in 0..1
+    float GetPercentileMs(float Percentile) const;
+    float GetP50Ms() const { return P50Ms; }
+    float GetP95Ms() const { return P95Ms; }
+    float GetP99Ms() const { return P99Ms; }
+
+    float GetScopeAverageMs(int32 ScopeIndex) const;
+    int32 GetHitchesInWindow() const { return HitchesInWindow; }
+    int32 GetTotalHitches() const { return TotalHitches; }
+
+    FFrameTelemetryStats GetStats() const;
+
+    // Clears samples and statistics; registered scopes are kept
+    void Reset();
+
+private:
+    struct FSlot
+    {
+        // Odd while the slot is being written; advances by two per write
+        std::atomic<uint32> Sequence{0};
+        FFrameTelemetrySample Sample;
+    };
+
+    FSlot Slots[Capacity];
+    std::atomic<uint64> WriteCount{0};
+
+    FName ScopeNames[MaxScopes];
+    int32 NumScopes = 0;
+    std::atomic<uint64> ScopeCycles[MaxScopes] = {};
+
+    // Window statistics, updated per recorded and evicted frame
+    int32 Histogram[NumHistogramBuckets] = {};
+    int32 NumSamples = 0;
+    double FrameTimeSumMs = 0.0;
+    double ScopeSumMs[MaxScopes] = {};
+    int32 HitchesInWindow = 0;
+    int32 TotalHitches = 0;
+    float P50Ms = 0.0f;
+    float P95Ms = 0.0f;
+    float P99Ms = 0.0f;
+
+    float HitchFloorMs = 33.0f;
+    float HitchMedianMultiplier = 2.0f;
+
+    static int32 ToHistogramBucket(float FrameTimeMs);
+    void AddToWindow(const FFrameTelemetrySample& Sample, int32 Direction);
+    void UpdatePercentiles();
+};
+
+/**
+ * Shared per-world frame telemetry.
+ * Owns the single frame history the HUD and optimization systems read, and collects scoped timings
+ * reported by other subsystems so game-thread time can be attributed. The FPSGAME_SCOPE_CYCLE_COUNTER
+ * counters are drained into scopes of the same name each frame.
+ */
+UCLASS()
+class FPSGAME_API UFrameTelemetrySubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // USubsystem interface
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    // FTickableGameObject interface
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    static UFrameTelemetrySubsystem* Get(const UObject* WorldContextObject);
+
+    int32 RegisterScope(FName ScopeName) { return Buffer.RegisterScope(ScopeName); }
+
+    FFrameTelemetryBuffer& GetBuffer() { return Buffer; }
+    const FFrameTelemetryBuffer& GetBuffer() const { return Buffer; }
+
+    UFUNCTION(BlueprintCallable, Category = "Telemetry")
+    FFrameTelemetryStats GetStats() const { return Buffer.GetStats(); }
+
+    UFUNCTION(BlueprintCallable, Category = "Telemetry")
+    float GetScopeAverageMs(FName ScopeName) const { return Buffer.GetScopeAverageMs(Buffer.FindScope(ScopeName)); }
+
+    UFUNCTION(BlueprintCallable, Category = "Telemetry")
+    void SetHitchThresholds(float HitchFloorMs, float HitchMedianMultiplier) { Buffer.SetHitchThresholds(HitchFloorMs, HitchMedianMultiplier); }
+
+    UFUNCTION(BlueprintCallable, Category = "Telemetry")
+    FString GenerateTelemetryReport() const;
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    FFrameTelemetryBuffer Buffer;
+    uint64 LastRecordedFrame = 0;
+    int32 CounterScopes[FFPSGameCounters::NumCounters];
+};
+
+// Adds the time spent in its lifetime to a telemetry scope; does nothing without a buffer or slot
+class FFrameTelemetryScope
+{
+public:
+    FORCEINLINE FFrameTelemetryScope(FFrameTelemetryBuffer* InBuffer, int32 InScopeIndex)
+        : Buffer(InScopeIndex != INDEX_NONE ? InBuffer : nullptr)
+        , ScopeIndex(InScopeIndex)
+        , StartCycles(Buffer ? FPlatformTime::Cycles64() : 0)
+    {
+    }
+
+    FORCEINLINE FFrameTelemetryScope(UFrameTelemetrySubsystem* Telemetry, int32 InScopeIndex)
+        : FFrameTelemetryScope(Telemetry ? &Telemetry->GetBuffer() : nullptr, InScopeIndex)
+    {
+    }
+
+    FORCEINLINE ~FFrameTelemetryScope()
+    {
+        if (Buffer)
+        {
+            Buffer->AddScopeCycles(ScopeIndex, FPlatformTime::Cycles64() - StartCycles);
+        }
+    }
+
+private:
+    FFrameTelemetryBuffer* Buffer;
+    int32 ScopeIndex;
+    uint64 StartCycles;
+};
@@ -0,0 +1,323 @@
+#include "MemoryPressureSubsystem.h"
+#include "AdvancedObjectPoolManager.h"
+#include "AI/AIPathCache.h"
+#include "Engine/World.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "HAL/PlatformMemory.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogMemoryPressure, Log, All);
+
+namespace
+{
+    const float BytesPerMB = 1024.0f * 1024.0f;
+
+    const TCHAR* GetTierName(EMemoryPressureTier Tier)
+    {
+        switch (Tier)
+        {
+            case EMemoryPressureTier::None:             return TEXT("None");
+            case EMemoryPressureTier::TrimPools:        return TEXT("TrimPools");
+            case EMemoryPressureTier::DropCaches:       return TEXT("DropCaches");
+            case EMemoryPressureTier::FlushEffectPools: return TEXT("FlushEffectPools");
+            default:                                    return TEXT("Unknown");
+        }
+    }
+}
+
+// FMemoryPressureResponder
+
+int32 FMemoryPressureResponder::AddReclaimer(EMemoryPressureTier Tier, FName Name, FMemoryReclaimDelegate Reclaimer)
+{
+    if (Tier == EMemoryPressureTier::None || !Reclaimer.IsBound())
+    {
+        return INDEX_NONE;
+    }
+
+    FReclaimer& Entry = Reclaimers.AddDefaulted_GetRef();
+    Entry.Handle = NextHandle++;
+    Entry.Tier = Tier;
+    Entry.Name = Name;
+    Entry.Delegate = MoveTemp(Reclaimer);
+    return Entry.Handle;
+}
+
+void FMemoryPressureResponder::RemoveReclaimer(int32 Handle)
+{
+    Reclaimers.RemoveAll([Handle](const FReclaimer& Entry) { return Entry.Handle == Handle; });
+}
+
+int32 FMemoryPressureResponder::GetNumReclaimers(EMemoryPressureTier Tier) const
+{
+    int32 Count = 0;
+    for (const FReclaimer& Entry : Reclaimers)
+    {
+        Count += Entry.Tier == Tier ? 1 : 0;
+    }
+    return Count;
+}
+
+EMemoryPressureTier FMemoryPressureResponder::GetTierForPressure(float UsedFraction) const
+{
+    if (UsedFraction >= Settings.FlushEffectPoolsThreshold)
+    {
+        return EMemoryPressureTier::FlushEffectPools;
+    }
+    if (UsedFraction >= Settings.DropCachesThreshold)
+    {
+        return EMemoryPressureTier::DropCaches;
+    }
+    if (UsedFraction >= Settings.TrimPoolsThreshold)
+    {
+        return EMemoryPressureTier::TrimPools;
+    }
+    return EMemoryPressureTier::None;
+}
+
+int64 FMemoryPressureResponder::GetExcessBytes(uint64 UsedBytes, uint64 BudgetBytes) const
+{
+    const double TargetBytes = (double)BudgetBytes * Settings.TrimPoolsThreshold;
+    return FMath::Max<int64>(0, (int64)((double)UsedBytes - TargetBytes));
+}
+
+EMemoryPressureTier FMemoryPressureResponder::Reclaim(EMemoryPressureTier MaxTier, int64 BytesToReclaim, TArray<FMemoryReclaimReport>& OutReports)
+{
+    // Reclaimers may unregister while running, so work from a copy
+    const TArray<FReclaimer> Snapshot = Reclaimers;
+
+    EMemoryPressureTier LastTier = EMemoryPressureTier::None;
+    int64 ReclaimedBytes = 0;
+    for (uint8 Tier = (uint8)EMemoryPressureTier::TrimPools; Tier <= (uint8)MaxTier; ++Tier)
+    {
+        for (const FReclaimer& Entry : Snapshot)
+        {
+            if (Entry.Tier != (EMemoryPressureTier)Tier)
+            {
+                continue;
+            }
+
+            const double StartTime = FPlatformTime::Seconds();
+            const int64 Bytes = Entry.Delegate.IsBound() ? FMath::Max<int64>(0, Entry.Delegate.Execute()) : 0;
+
+            FMemoryReclaimReport& Report = OutReports.AddDefaulted_GetRef();
+            Report.Tier = Entry.Tier;
+            Report.Reclaimer = Entry.Name;
+            Report.EstimatedBytes = Bytes;
+            Report.CostMs = (float)((FPlatformTime::Seconds() - StartTime) * 1000.0);
+
+            ReclaimedBytes += Bytes;
+        }
+
+        LastTier = (EMemoryPressureTier)Tier;
+        if (ReclaimedBytes >= BytesToReclaim)
+        {
+            break;
+        }
+    }
+    return LastTier;
+}
+
+EMemoryPressureTier FMemoryPressureResponder::Update(uint64 UsedBytes, uint64 BudgetBytes, double Now, TArray<FMemoryReclaimReport>& OutReports)
+{
+    if (BudgetBytes == 0)
+    {
+        return EMemoryPressureTier::None;
+    }
+
+    const EMemoryPressureTier MaxTier = GetTierForPressure((float)((double)UsedBytes / (double)BudgetBytes));
+    if (MaxTier == EMemoryPressureTier::None || (bHasResponded && Now - LastResponseTime < Settings.ResponseCooldown))
+    {
+        return EMemoryPressureTier::None;
+    }
+
+    StartCooldown(Now);
+    return Reclaim(MaxTier, GetExcessBytes(UsedBytes, BudgetBytes), OutReports);
+}
+
+// UMemoryPressureSubsystem
+
+void UMemoryPressureSubsystem::Initialize(FSubsystemCollectionBase& Collection)
+{
+    Super::Initialize(Collection);
+
+    Responder.AddReclaimer(EMemoryPressureTier::TrimPools, TEXT("ObjectPools"), FMemoryReclaimDelegate::CreateUObject(this, &UMemoryPressureSubsystem::TrimObjectPools));
+    Responder.AddReclaimer(EMemoryPressureTier::DropCaches, TEXT("AIPathCache"), FMemoryReclaimDelegate::CreateUObject(this, &UMemoryPressureSubsystem::DropAICaches));
+
+    UE_LOG(LogMemoryPressure, Log, TEXT("Memory pressure responder initialized"));
+}
+
+void UMemoryPressureSubsystem::Deinitialize()
+{
+    RecentReports.Empty();
+
+    Super::Deinitialize();
+}
+
+bool UMemoryPressureSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UMemoryPressureSubsystem::Tick(float DeltaTime)
+{
+    const double Now = FPlatformTime::Seconds();
+    if (Now - LastPollTime < Responder.GetSettings().PollInterval)
+    {
+        return;
+    }
+
+    EvaluatePressure();
+}
+
+TStatId UMemoryPressureSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UMemoryPressureSubsystem, STATGROUP_Tickables);
+}
+
+UMemoryPressureSubsystem* UMemoryPressureSubsystem::Get(const UObject* WorldContextObject)
+{
+    UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
+    return World ? World->GetSubsystem<UMemoryPressureSubsystem>() : nullptr;
+}
+
+void UMemoryPressureSubsystem::SampleMemory(uint64& OutUsedBytes, uint64& OutBudgetBytes)
+{
+    const FPlatformMemoryStats Stats = FPlatformMemory::GetStats();
+    const float BudgetMB = Responder.GetSettings().MemoryBudgetMB;
+    if (BudgetMB > 0.0f)
+    {
+        OutUsedBytes = Stats.UsedPhysical;
+        OutBudgetBytes = (uint64)(BudgetMB * BytesPerMB);
+    }
+    else
+    {
+        OutUsedBytes = Stats.TotalPhysical > Stats.AvailablePhysical ? Stats.TotalPhysical - Stats.AvailablePhysical : 0;
+        OutBudgetBytes = Stats.TotalPhysical;
+    }
+
+    LastPollTime = FPlatformTime::Seconds();
+    LastPressure = OutBudgetBytes > 0 ? (float)((double)OutUsedBytes / (double)OutBudgetBytes) : 0.0f;
+}
+
+EMemoryPressureTier UMemoryPressureSubsystem::EvaluatePressure()
+{
+    uint64 UsedBytes = 0;
+    uint64 BudgetBytes = 0;
+    SampleMemory(UsedBytes, BudgetBytes);
+
+    TArray<FMemoryReclaimReport> Reports;
+    const EMemoryPressureTier LastTier = Responder.Update(UsedBytes, BudgetBytes, LastPollTime, Reports);
+    FinishResponse(LastTier, Reports, UsedBytes);
+    return LastTier;
+}
+
+EMemoryPressureTier UMemoryPressureSubsystem::ReclaimMemory(EMemoryPressureTier MaxTier)
+{
+    if (MaxTier == EMemoryPressureTier::None)
+    {
+        return EMemoryPressureTier::None;
+    }
+
+    uint64 UsedBytes = 0;
+    uint64 BudgetBytes = 0;
+    SampleMemory(UsedBytes, BudgetBytes);
+
+    // The automatic poll would otherwise respond again to stats that don't show this yet
+    Responder.StartCooldown(LastPollTime);
+
+    TArray<FMemoryReclaimReport> Reports;
+    const EMemoryPressureTier LastTier = Responder.Reclaim(MaxTier, Responder.GetExcessBytes(UsedBytes, BudgetBytes), Reports);
+    FinishResponse(LastTier, Reports, UsedBytes);
+    return LastTier;
+}
+
+void UMemoryPressureSubsystem::FinishResponse(EMemoryPressureTier LastTier, TArray<FMemoryReclaimReport>& Reports, uint64 UsedBytesBefore)
+{
+    if (LastTier == EMemoryPressureTier::None)
+    {
+        return;
+    }
+
+    // Only the last tier collects; incremental purge spreads the cost over the following frames instead of one full-purge hitch
+    if (LastTier == EMemoryPressureTier::FlushEffectPools && GEngine)
+    {
+        const double StartTime = FPlatformTime::Seconds();
+        GEngine->ForceGarbageCollection(false);
+
+        FMemoryReclaimReport& Report = Reports.AddDefaulted_GetRef();
+        Report.Tier = EMemoryPressureTier::FlushEffectPools;
+        Report.Reclaimer = TEXT("IncrementalGC");
+        Report.CostMs = (float)((FPlatformTime::Seconds() - StartTime) * 1000.0);
+    }
+
+    int64 ResponseBytes[NumTiers] = {};
+    float ResponseCostMs[NumTiers] = {};
+    for (const FMemoryReclaimReport& Report : Reports)
+    {
+        const int32 Tier = (int32)Report.Tier;
+        ResponseBytes[Tier] += Report.EstimatedBytes;
+        ResponseCostMs[Tier] += Report.CostMs;
+
+        UE_LOG(LogMemoryPressure, Log, TEXT("  %s/%s: ~%.2f MB in %.2fms"),
+            GetTierName(Report.Tier), *Report.Reclaimer.ToString(), Report.EstimatedBytes / BytesPerMB, Report.CostMs);
+    }
+
+    for (int32 Tier = (int32)EMemoryPressureTier::TrimPools; Tier <= (int32)LastTier; ++Tier)
+    {
+        TierBytes[Tier] += ResponseBytes[Tier];
+        TierCostMs[Tier] += ResponseCostMs[Tier];
+        TierResponses[Tier]++;
+        OnTierReclaimed.Broadcast((EMemoryPressureTier)Tier, ResponseBytes[Tier], ResponseCostMs[Tier]);
+    }
+
+    // Destroyed objects are only freed by the next GC, so this is a lower bound
+    const FPlatformMemoryStats Stats = FPlatformMemory::GetStats();
+    const uint64 UsedBytesAfter = Responder.GetSettings().MemoryBudgetMB > 0.0f ? Stats.UsedPhysical : Stats.TotalPhysical - FMath::Min(Stats.TotalPhysical, Stats.AvailablePhysical);
+    const float MeasuredMB = UsedBytesBefore > UsedBytesAfter ? (UsedBytesBefore - UsedBytesAfter) / BytesPerMB : 0.0f;
+
+    UE_LOG(LogMemoryPressure, Warning, TEXT("Memory pressure %.0f%%: escalated to %s, %.2f MB freed so far"),
+        LastPressure * 100.0f, GetTierName(LastTier), MeasuredMB);
+
+    RecentReports.Append(Reports);
+    if (RecentReports.Num() > MaxRecentReports)
+    {
+        RecentReports.RemoveAt(0, RecentReports.Num() - MaxRecentReports);
+    }
+}
+
+int64 UMemoryPressureSubsystem::TrimObjectPools()
+{
+    UGameInstance* GameInstance = GetWorld() ? GetWorld()->GetGameInstance() : nullptr;
+    UAdvancedObjectPoolManager* PoolManager = GameInstance ? GameInstance->GetSubsystem<UAdvancedObjectPoolManager>() : nullptr;
+    return PoolManager ? PoolManager->TrimAllIdleObjects() : 0;
+}
+
+int64 UMemoryPressureSubsystem::DropAICaches()
+{
+    UAIPathCache* PathCache = UAIPathCache::Get(this);
+    if (!PathCache)
+    {
+        return 0;
+    }
+
+    const int64 Bytes = PathCache->GetAllocatedBytes();
+    PathCache->Invalidate();
+    return Bytes;
+}
+
+FString UMemoryPressureSubsystem::GenerateMemoryReport() const
+{
+    const FMemoryPressureSettings& Settings = Responder.GetSettings();
+
+    FString Report = TEXT("=== Memory Pressure ===\n");
+    Report += FString::Printf(TEXT("Pressure: %.1f%% (thresholds %.0f%% / %.0f%% / %.0f%%)\n"), LastPressure * 100.0f,
+        Settings.TrimPoolsThreshold * 100.0f, Settings.DropCachesThreshold * 100.0f, Settings.FlushEffectPoolsThreshold * 100.0f);
+
+    for (int32 Tier = (int32)EMemoryPressureTier::TrimPools; Tier < NumTiers; ++Tier)
+    {
+        Report += FString::Printf(TEXT("  %s (%d reclaimers): %d responses, ~%.2f MB, %.2fms total\n"),
+            GetTierName((EMemoryPressureTier)Tier), Responder.GetNumReclaimers((EMemoryPressureTier)Tier),
+            TierResponses[Tier], TierBytes[Tier] / BytesPerMB, TierCostMs[Tier]);
+    }
+    return Report;
+}
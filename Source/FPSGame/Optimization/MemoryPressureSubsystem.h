@@ -0,0 +1,188 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "MemoryPressureSubsystem.generated.h"
+
+// Escalating responses; a tier only runs when the cheaper ones before it didn't free enough
+UENUM(BlueprintType)
+enum class EMemoryPressureTier : uint8
+{
+    None                UMETA(DisplayName = "None"),
+    TrimPools           UMETA(DisplayName = "Trim Idle Pools"),
+    DropCaches          UMETA(DisplayName = "Drop Caches"),
+    FlushEffectPools    UMETA(DisplayName = "Flush Effect Pools")
+};
+
+USTRUCT(BlueprintType)
+struct FMemoryPressureSettings
+{
+    GENERATED_BODY()
+
+    // Process budget; 0 measures the whole system against physical memory instead
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Memory Pressure")
+    float MemoryBudgetMB = 0.0f;
+
+    // Fractions of the budget at which each tier becomes allowed
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Memory Pressure")
+    float TrimPoolsThreshold = 0.75f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Memory Pressure")
+    float DropCachesThreshold = 0.85f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Memory Pressure")
+    float FlushEffectPoolsThreshold = 0.92f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Memory Pressure")
+    float PollInterval = 1.0f;
+
+    // Seconds between responses, so freed memory has time to show up in the platform stats
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Memory Pressure")
+    float ResponseCooldown = 10.0f;
+};
+
+USTRUCT(BlueprintType)
+struct FMemoryReclaimReport
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Memory Pressure")
+    EMemoryPressureTier Tier = EMemoryPressureTier::None;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Memory Pressure")
+    FName Reclaimer;
+
+    // As reported by the reclaimer; the allocator may hold on to some of it
+    UPROPERTY(BlueprintReadOnly, Category = "Memory Pressure")
+    int64 EstimatedBytes = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Memory Pressure")
+    float CostMs = 0.0f;
+};
+
+// Frees what it can and returns the estimated bytes
+DECLARE_DELEGATE_RetVal(int64, FMemoryReclaimDelegate);
+
+DECLARE_DYNAMIC_MULTICAST_DELEGATE_ThreeParams(FOnMemoryTierReclaimed, EMemoryPressureTier, Tier, int64, EstimatedBytes, float, CostMs);
+
+/**
+ * Picks how far to escalate from used versus budgeted memory and runs the registered reclaimers tier by tier,
+ * stopping as soon as their estimates bring usage back under the first threshold.
+ */
+class FPSGAME_API FMemoryPressureResponder
+{
+public:
+    void SetSettings(const FMemoryPressureSettings& InSettings) { Settings = InSettings; }
+    const FMemoryPressureSettings& GetSettings() const { return Settings; }
+
+    // Reclaimers of a tier run in registration order; returns a handle for RemoveReclaimer
+    int32 AddReclaimer(EMemoryPressureTier Tier, FName Name, FMemoryReclaimDelegate Reclaimer);
+    void RemoveReclaimer(int32 Handle);
+    int32 GetNumReclaimers(EMemoryPressureTier Tier) const;
+
+    // Highest tier whose threshold UsedFraction has reached
+    EMemoryPressureTier GetTierForPressure(float UsedFraction) const;
+
+    // Bytes above the first tier's threshold
+    int64 GetExcessBytes(uint64 UsedBytes, uint64 BudgetBytes) const;
+
+    // Runs tiers up to MaxTier until the estimates cover BytesToReclaim; the first tier always runs. Returns the last tier run
+    EMemoryPressureTier Reclaim(EMemoryPressureTier MaxTier, int64 BytesToReclaim, TArray<FMemoryReclaimReport>& OutReports);
+
+    // One poll; responds once usage crosses a threshold and the cooldown has passed
+    EMemoryPressureTier Update(uint64 UsedBytes, uint64 BudgetBytes, double Now, TArray<FMemoryReclaimReport>& OutReports);
+
+    void StartCooldown(double Now) { LastResponseTime = Now; bHasResponded = true; }
+    void ResetCooldown() { bHasResponded = false; }
+
+private:
+    struct FReclaimer
+    {
+        int32 Handle = INDEX_NONE;
+        EMemoryPressureTier Tier = EMemoryPressureTier::None;
+        FName Name;
+        FMemoryReclaimDelegate Delegate;
+    };
+
+    FMemoryPressureSettings Settings;
+    TArray<FReclaimer> Reclaimers;
+    int32 NextHandle = 0;
+
+    double LastResponseTime = 0.0;
+    bool bHasResponded = false;
+};
+
+/**
+ * Per-world memory pressure responder.
+ * Polls the platform memory stats and escalates from trimming idle pools, through dropping AI caches,
+ * to flushing effect pools; only that last tier asks for an incremental GC. Game thread only.
+ */
+UCLASS()
+class FPSGAME_API UMemoryPressureSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // USubsystem interface
+    virtual void Initialize(FSubsystemCollectionBase& Collection) override;
+    virtual void Deinitialize() override;
+
+    // FTickableGameObject interface
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    static UMemoryPressureSubsystem* Get(const UObject* WorldContextObject);
+
+    int32 RegisterReclaimer(EMemoryPressureTier Tier, FName Name, FMemoryReclaimDelegate Reclaimer) { return Responder.AddReclaimer(Tier, Name, MoveTemp(Reclaimer)); }
+    void UnregisterReclaimer(int32 Handle) { Responder.RemoveReclaimer(Handle); }
+
+    // Samples memory now and responds if it is over a threshold and not cooling down
+    UFUNCTION(BlueprintCallable, Category = "Memory Pressure")
+    EMemoryPressureTier EvaluatePressure();
+
+    // Escalates up to MaxTier regardless of the thresholds, stopping once usage would be back under the first one
+    UFUNCTION(BlueprintCallable, Category = "Memory Pressure")
+    EMemoryPressureTier ReclaimMemory(EMemoryPressureTier MaxTier);
+
+    // Used fraction of the budget at the last sample
+    UFUNCTION(BlueprintCallable, Category = "Memory Pressure")
+    float GetMemoryPressure() const { return LastPressure; }
+
+    UFUNCTION(BlueprintCallable, Category = "Memory Pressure")
+    void SetPressureSettings(const FMemoryPressureSettings& InSettings) { Responder.SetSettings(InSettings); }
+
+    UFUNCTION(BlueprintCallable, Category = "Memory Pressure")
+    TArray<FMemoryReclaimReport> GetRecentReports() const { return RecentReports; }
+
+    UFUNCTION(BlueprintCallable, Category = "Memory Pressure")
+    FString GenerateMemoryReport() const;
+
+    // Once per tier that ran, with that tier's totals
+    UPROPERTY(BlueprintAssignable, Category = "Memory Pressure")
+    FOnMemoryTierReclaimed OnTierReclaimed;
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    static constexpr int32 MaxRecentReports = 64;
+    static constexpr int32 NumTiers = (int32)EMemoryPressureTier::FlushEffectPools + 1;
+
+    FMemoryPressureResponder Responder;
+    TArray<FMemoryReclaimReport> RecentReports;
+
+    float LastPressure = 0.0f;
+    double LastPollTime = 0.0;
+
+    // Totals since initialization, indexed by tier
+    int64 TierBytes[NumTiers] = {};
+    float TierCostMs[NumTiers] = {};
+    int32 TierResponses[NumTiers] = {};
+
+    void SampleMemory(uint64& OutUsedBytes, uint64& OutBudgetBytes);
+    void FinishResponse(EMemoryPressureTier LastTier, TArray<FMemoryReclaimReport>& Reports, uint64 UsedBytesBefore);
+
+    // Built-in reclaimers
+    int64 TrimObjectPools();
+    int64 DropAICaches();
+};
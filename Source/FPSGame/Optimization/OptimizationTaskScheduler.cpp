@@ -0,0 +1,306 @@
+#include "OptimizationTaskScheduler.h"
+#include "Async/Async.h"
+#include "HAL/PlatformProcess.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogOptimizationTasks, Log, All);
+
+namespace
+{
+    // Bound on linear probing in the coalesce set; past it a task simply isn't coalesced
+    constexpr int32 MaxCoalesceProbes = 8;
+
+    uint64 CyclesToMicroseconds(uint64 Cycles)
+    {
+        return (uint64)(FPlatformTime::ToSeconds64(Cycles) * 1000000.0);
+    }
+}
+
+uint64 FSchedulerHistogram::GetPercentile(float Percentile) const
+{
+    uint64 Total = 0;
+    for (int32 Bucket = 0; Bucket < NumBuckets; ++Bucket)
+    {
+        Total += Buckets[Bucket].load(std::memory_order_relaxed);
+    }
+
+    if (Total == 0)
+    {
+        return 0;
+    }
+
+    const uint64 Target = FMath::Max<uint64>(1, (uint64)FMath::CeilToDouble(Total * (double)Percentile));
+    uint64 Cumulative = 0;
+    for (int32 Bucket = 0; Bucket < NumBuckets; ++Bucket)
+    {
+        Cumulative += Buckets[Bucket].load(std::memory_order_relaxed);
+        if (Cumulative >= Target)
+        {
+            return (1ull << (Bucket + 1)) - 1;
+        }
+    }
+    return (1ull << NumBuckets) - 1;
+}
+
+void FSchedulerHistogram::CopyTo(TArray<int32>& OutBuckets) const
+{
+    OutBuckets.SetNum(NumBuckets);
+    for (int32 Bucket = 0; Bucket < NumBuckets; ++Bucket)
+    {
+        OutBuckets[Bucket] = (int32)Buckets[Bucket].load(std::memory_order_relaxed);
+    }
+}
+
+void FSchedulerHistogram::Reset()
+{
+    for (int32 Bucket = 0; Bucket < NumBuckets; ++Bucket)
+    {
+        Buckets[Bucket].store(0, std::memory_order_relaxed);
+    }
+}
+
+FOptimizationTaskScheduler::FOptimizationTaskScheduler(int32 InCapacityPerPriority, int32 InMaxConcurrency)
+    : MaxConcurrency(FMath::Max(1, InMaxConcurrency))
+{
+    for (int32 Priority = 0; Priority < NumPriorities; ++Priority)
+    {
+        Queues[Priority] = MakeUnique<TBoundedMPMCQueue<FScheduledTask>>((uint32)FMath::Max(2, InCapacityPerPriority));
+    }
+}
+
+FOptimizationTaskScheduler::~FOptimizationTaskScheduler()
+{
+    Shutdown();
+}
+
+bool FOptimizationTaskScheduler::Submit(TFunction<void()> Work, EOptimizationTaskPriority Priority, uint64 CoalesceKey, TFunction<void()> OnComplete)
+{
+    if (bShuttingDown.load() || !Work)
+    {
+        return false;
+    }
+
+    SubmittedCount.fetch_add(1, std::memory_order_relaxed);
+
+    // The queued task will run after this point, so it already covers this request
+    if (!TryClaimCoalesceKey(CoalesceKey))
+    {
+        CoalescedCount.fetch_add(1, std::memory_order_relaxed);
+        return false;
+    }
+
+    QueueDepthHistogram.Record(GetQueueDepth());
+
+    FScheduledTask Task;
+    Task.Work = MoveTemp(Work);
+    Task.OnComplete = MoveTemp(OnComplete);
+    Task.CoalesceKey = CoalesceKey;
+    Task.SubmitCycles = FPlatformTime::Cycles64();
+
+    // Saturated: shed the work rather than stall the caller
+    if (!Queues[(int32)Priority]->TryEnqueue(MoveTemp(Task)))
+    {
+        ReleaseCoalesceKey(CoalesceKey);
+        DroppedCount.fetch_add(1, std::memory_order_relaxed);
+        UE_LOG(LogOptimizationTasks, Verbose, TEXT("Task queue %d full, dropping task"), (int32)Priority);
+        return false;
+    }
+
+    WakeWorker();
+    return true;
+}
+
+void FOptimizationTaskScheduler::ProcessCompletions()
+{
+    check(IsInGameThread());
+
+    TFunction<void()> Completion;
+    while (Completions.Dequeue(Completion))
+    {
+        Completion();
+    }
+}
+
+void FOptimizationTaskScheduler::Shutdown()
+{
+    bShuttingDown.store(true);
+
+    // Running tasks may reference their owner, and a worker that gave up its slot may still be checking the
+    // queues, so every worker has to be gone before the scheduler is
+    while (LiveWorkers.load() > 0)
+    {
+        FPlatformProcess::SleepNoStats(0.0f);
+    }
+
+    FScheduledTask Discarded;
+    while (TryDequeue(Discarded))
+    {
+    }
+
+    for (int32 Slot = 0; Slot < NumCoalesceSlots; ++Slot)
+    {
+        PendingCoalesceKeys[Slot].store(0);
+    }
+
+    Completions.Empty();
+}
+
+FAsyncTaskSchedulerStats FOptimizationTaskScheduler::GetStats() const
+{
+    FAsyncTaskSchedulerStats Stats;
+    Stats.QueueDepth = GetQueueDepth();
+    Stats.RunningWorkers = RunningWorkers.load(std::memory_order_relaxed);
+    Stats.Submitted = SubmittedCount.load(std::memory_order_relaxed);
+    Stats.Completed = CompletedCount.load(std::memory_order_relaxed);
+    Stats.Dropped = DroppedCount.load(std::memory_order_relaxed);
+    Stats.Coalesced = CoalescedCount.load(std::memory_order_relaxed);
+    Stats.QueueDepthP95 = (int32)QueueDepthHistogram.GetPercentile(0.95f);
+    Stats.WaitTimeP50Ms = WaitTimeHistogram.GetPercentile(0.5f) / 1000.0f;
+    Stats.WaitTimeP99Ms = WaitTimeHistogram.GetPercentile(0.99f) / 1000.0f;
+    Stats.RunTimeP50Ms = RunTimeHistogram.GetPercentile(0.5f) / 1000.0f;
+    Stats.RunTimeP99Ms = RunTimeHistogram.GetPercentile(0.99f) / 1000.0f;
+    QueueDepthHistogram.CopyTo(Stats.QueueDepthHistogram);
+    WaitTimeHistogram.CopyTo(Stats.WaitTimeHistogram);
+    RunTimeHistogram.CopyTo(Stats.RunTimeHistogram);
+    return Stats;
+}
+
+void FOptimizationTaskScheduler::ResetStats()
+{
+    SubmittedCount.store(0);
+    CompletedCount.store(0);
+    DroppedCount.store(0);
+    CoalescedCount.store(0);
+    QueueDepthHistogram.Reset();
+    WaitTimeHistogram.Reset();
+    RunTimeHistogram.Reset();
+}
+
+bool FOptimizationTaskScheduler::TryClaimCoalesceKey(uint64 Key)
+{
+    if (Key == 0)
+    {
+        return true;
+    }
+
+    const uint32 Hash = GetTypeHash(Key);
+    for (int32 Probe = 0; Probe < MaxCoalesceProbes; ++Probe)
+    {
+        std::atomic<uint64>& Slot = PendingCoalesceKeys[(Hash + Probe) & (NumCoalesceSlots - 1)];
+
+        uint64 Expected = 0;
+        if (Slot.compare_exchange_strong(Expected, Key))
+        {
+            return true;
+        }
+        if (Expected == Key)
+        {
+            return false;
+        }
+    }
+
+    // Too crowded to track; run it uncoalesced
+    return true;
+}
+
+void FOptimizationTaskScheduler::ReleaseCoalesceKey(uint64 Key)
+{
+    if (Key == 0)
+    {
+        return;
+    }
+
+    const uint32 Hash = GetTypeHash(Key);
+    for (int32 Probe = 0; Probe < MaxCoalesceProbes; ++Probe)
+    {
+        uint64 Expected = Key;
+        if (PendingCoalesceKeys[(Hash + Probe) & (NumCoalesceSlots - 1)].compare_exchange_strong(Expected, 0))
+        {
+            return;
+        }
+    }
+}
+
+int32 FOptimizationTaskScheduler::GetQueueDepth() const
+{
+    int32 Depth = 0;
+    for (int32 Priority = 0; Priority < NumPriorities; ++Priority)
+    {
+        Depth += FMath::Max(0, Queues[Priority]->ApproximateNum());
+    }
+    return Depth;
+}
+
+void FOptimizationTaskScheduler::WakeWorker()
+{
+    // Counted before the slot is claimed, so Shutdown never sees a claimed slot without a live worker
+    LiveWorkers.fetch_add(1);
+
+    int32 Running = RunningWorkers.load();
+    while (Running < MaxConcurrency.load())
+    {
+        if (RunningWorkers.compare_exchange_weak(Running, Running + 1))
+        {
+            AsyncTask(ENamedThreads::AnyBackgroundThreadNormalTask, [this]() { RunWorker(); });
+            return;
+        }
+    }
+
+    LiveWorkers.fetch_sub(1);
+}
+
+void FOptimizationTaskScheduler::RunWorker()
+{
+    for (;;)
+    {
+        FScheduledTask Task;
+        while (!bShuttingDown.load() && TryDequeue(Task))
+        {
+            const uint64 StartCycles = FPlatformTime::Cycles64();
+            WaitTimeHistogram.Record(CyclesToMicroseconds(StartCycles - Task.SubmitCycles));
+
+            // Release first so a request made while this runs queues a fresh pass
+            ReleaseCoalesceKey(Task.CoalesceKey);
+
+            Task.Work();
+
+            RunTimeHistogram.Record(CyclesToMicroseconds(FPlatformTime::Cycles64() - StartCycles));
+
+            // Queue the callback before counting, so a completed task always has its callback visible
+            if (Task.OnComplete)
+            {
+                Completions.Enqueue(MoveTemp(Task.OnComplete));
+            }
+            CompletedCount.fetch_add(1, std::memory_order_relaxed);
+            Task = FScheduledTask();
+        }
+
+        RunningWorkers.fetch_sub(1);
+
+        // Work submitted between our last dequeue and the decrement may not have woken anyone
+        if (bShuttingDown.load() || GetQueueDepth() == 0)
+        {
+            break;
+        }
+
+        int32 Running = RunningWorkers.load();
+        if (Running >= MaxConcurrency.load() || !RunningWorkers.compare_exchange_strong(Running, Running + 1))
+        {
+            break;
+        }
+    }
+
+    // Last access to this; Shutdown may destroy the scheduler as soon as it lands
+    LiveWorkers.fetch_sub(1);
+}
+
+bool FOptimizationTaskScheduler::TryDequeue(FScheduledTask& OutTask)
+{
+    for (int32 Priority = 0; Priority < NumPriorities; ++Priority)
+    {
+        if (Queues[Priority]->TryDequeue(OutTask))
+        {
+            return true;
+        }
+    }
+    return false;
+}
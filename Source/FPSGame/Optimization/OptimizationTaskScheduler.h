@@ -0,0 +1,266 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "HAL/PlatformTime.h"
+#include "Containers/Queue.h"
+#include <atomic>
+#include "OptimizationTaskScheduler.generated.h"
+
+// Snapshot of scheduler counters and histograms; percentiles are bucket upper bounds
+USTRUCT(BlueprintType)
+struct FAsyncTaskSchedulerStats
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Threading")
+    int32 QueueDepth = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Threading")
+    int32 RunningWorkers = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Threading")
+    int32 Submitted = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Threading")
+    int32 Completed = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Threading")
+    int32 Dropped = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Threading")
+    int32 Coalesced = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Threading")
+    int32 QueueDepthP95 = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Threading")
+    float WaitTimeP50Ms = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Threading")
+    float WaitTimeP99Ms = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Threading")
+    float RunTimeP50Ms = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Threading")
+    float RunTimeP99Ms = 0.0f;
+
+    // Power-of-two buckets: depth in tasks, times in microseconds
+    UPROPERTY(BlueprintReadOnly, Category = "Threading")
+    TArray<int32> QueueDepthHistogram;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Threading")
+    TArray<int32> WaitTimeHistogram;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Threading")
+    TArray<int32> RunTimeHistogram;
+};
+
+enum class EOptimizationTaskPriority : uint8
+{
+    High,
+    Normal,
+    Low,
+    Count
+};
+
+// Fixed-capacity multi-producer multi-consumer queue; never allocates or locks after construction
+template<typename ElementType>
+class TBoundedMPMCQueue
+{
+public:
+    explicit TBoundedMPMCQueue(uint32 InCapacity);
+
+    FORCEINLINE bool TryEnqueue(ElementType&& Element);
+    FORCEINLINE bool TryDequeue(ElementType& OutElement);
+
+    // Racy by nature; good enough for stats and heuristics
+    FORCEINLINE int32 ApproximateNum() const
+    {
+        return (int32)(EnqueuePos.load(std::memory_order_relaxed) - DequeuePos.load(std::memory_order_relaxed));
+    }
+
+    FORCEINLINE int32 GetCapacity() const { return (int32)(Mask + 1); }
+
+private:
+    struct FCell
+    {
+        std::atomic<uint32> Sequence;
+        ElementType Element;
+    };
+
+    TUniquePtr<FCell[]> Cells;
+    uint32 Mask;
+
+    alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint32> EnqueuePos;
+    alignas(PLATFORM_CACHE_LINE_SIZE) std::atomic<uint32> DequeuePos;
+};
+
+// Lock-free power-of-two histogram
+class FSchedulerHistogram
+{
+public:
+    static constexpr int32 NumBuckets = 20;
+
+    FORCEINLINE void Record(uint64 Value)
+    {
+        const int32 Bucket = FMath::Min((int32)FPlatformMath::FloorLog2_64(Value + 1), NumBuckets - 1);
+        Buckets[Bucket].fetch_add(1, std::memory_order_relaxed);
+    }
+
+    // Upper bound of the bucket holding the given percentile (0..1)
+    uint64 GetPercentile(float Percentile) const;
+    void CopyTo(TArray<int32>& OutBuckets) const;
+    void Reset();
+
+private:
+    std::atomic<uint32> Buckets[NumBuckets] = {};
+};
+
+/**
+ * Bounded async scheduler for optimization work.
+ * Submission never blocks: a full queue drops the task, and a task whose coalesce key is already
+ * queued is folded into it. Completion callbacks are deferred to ProcessCompletions on the game thread.
+ */
+class FPSGAME_API FOptimizationTaskScheduler
+{
+public:
+    FOptimizationTaskScheduler(int32 InCapacityPerPriority = 256, int32 InMaxConcurrency = 4);
+    ~FOptimizationTaskScheduler();
+
+    // Returns false if the task was dropped or coalesced. A coalesce key of 0 never coalesces
+    bool Submit(TFunction<void()> Work, EOptimizationTaskPriority Priority = EOptimizationTaskPriority::Normal,
+        uint64 CoalesceKey = 0, TFunction<void()> OnComplete = nullptr);
+
+    // Runs completion callbacks of finished tasks; game thread only
+    void ProcessCompletions();
+
+    // Stops accepting work, discards queued tasks and waits for running ones
+    void Shutdown();
+
+    void SetMaxConcurrency(int32 InMaxConcurrency) { MaxConcurrency.store(FMath::Max(1, InMaxConcurrency)); }
+
+    FAsyncTaskSchedulerStats GetStats() const;
+    void ResetStats();
+
+private:
+    struct FScheduledTask
+    {
+        TFunction<void()> Work;
+        TFunction<void()> OnComplete;
+        uint64 CoalesceKey = 0;
+        uint64 SubmitCycles = 0;
+    };
+
+    static constexpr int32 NumPriorities = (int32)EOptimizationTaskPriority::Count;
+    static constexpr int32 NumCoalesceSlots = 64;
+
+    TUniquePtr<TBoundedMPMCQueue<FScheduledTask>> Queues[NumPriorities];
+    TQueue<TFunction<void()>, EQueueMode::Mpsc> Completions;
+
+    // Open-addressed set of coalesce keys that are queued but not yet started
+    std::atomic<uint64> PendingCoalesceKeys[NumCoalesceSlots] = {};
+
+    std::atomic<int32> MaxConcurrency;
+    std::atomic<int32> RunningWorkers{0};
+    std::atomic<bool> bShuttingDown{false};
+
+    // Worker tasks that may still touch this scheduler; leaving RunWorker is their last access
+    std::atomic<int32> LiveWorkers{0};
+
+    std::atomic<int32> SubmittedCount{0};
+    std::atomic<int32> CompletedCount{0};
+    std::atomic<int32> DroppedCount{0};
+    std::atomic<int32> CoalescedCount{0};
+
+    FSchedulerHistogram QueueDepthHistogram;
+    FSchedulerHistogram WaitTimeHistogram;
+    FSchedulerHistogram RunTimeHistogram;
+
+    bool TryClaimCoalesceKey(uint64 Key);
+    void ReleaseCoalesceKey(uint64 Key);
+    int32 GetQueueDepth() const;
+    void WakeWorker();
+    void RunWorker();
+    bool TryDequeue(FScheduledTask& OutTask);
+};
+
+// TBoundedMPMCQueue implementation
+
+template<typename ElementType>
+TBoundedMPMCQueue<ElementType>::TBoundedMPMCQueue(uint32 InCapacity)
+{
+    const uint32 Capacity = FMath::RoundUpToPowerOfTwo(FMath::Max(InCapacity, 2u));
+    Cells = MakeUnique<FCell[]>(Capacity);
+    Mask = Capacity - 1;
+
+    for (uint32 Index = 0; Index < Capacity; ++Index)
+    {
+        Cells[Index].Sequence.store(Index, std::memory_order_relaxed);
+    }
+
+    EnqueuePos.store(0, std::memory_order_relaxed);
+    DequeuePos.store(0, std::memory_order_relaxed);
+}
+
+template<typename ElementType>
+FORCEINLINE bool TBoundedMPMCQueue<ElementType>::TryEnqueue(ElementType&& Element)
+{
+    uint32 Pos = EnqueuePos.load(std::memory_order_relaxed);
+    for (;;)
+    {
+        FCell& Cell = Cells[Pos & Mask];
+        const uint32 Sequence = Cell.Sequence.load(std::memory_order_acquire);
+        const int32 Diff = (int32)(Sequence - Pos);
+
+        if (Diff == 0)
+        {
+            if (EnqueuePos.compare_exchange_weak(Pos, Pos + 1, std::memory_order_relaxed))
+            {
+                Cell.Element = MoveTemp(Element);
+                Cell.Sequence.store(Pos + 1, std::memory_order_release);
+                return true;
+            }
+        }
+        else if (Diff < 0)
+        {
+            // Full
+            return false;
+        }
+        else
+        {
+            Pos = EnqueuePos.load(std::memory_order_relaxed);
+        }
+    }
+}
+
+template<typename ElementType>
+FORCEINLINE bool TBoundedMPMCQueue<ElementType>::TryDequeue(ElementType& OutElement)
+{
+    uint32 Pos = DequeuePos.load(std::memory_order_relaxed);
+    for (;;)
+    {
+        FCell& Cell = Cells[Pos & Mask];
+        const uint32 Sequence = Cell.Sequence.load(std::memory_order_acquire);
+        const int32 Diff = (int32)(Sequence - (Pos + 1));
+
+        if (Diff == 0)
+        {
+            if (DequeuePos.compare_exchange_weak(Pos, Pos + 1, std::memory_order_relaxed))
+            {
+                OutElement = MoveTemp(Cell.Element);
+                Cell.Sequence.store(Pos + Mask + 1, std::memory_order_release);
+                return true;
+            }
+        }
+        else if (Diff < 0)
+        {
+            // Empty
+            return false;
+        }
+        else
+        {
+            Pos = DequeuePos.load(std::memory_order_relaxed);
+        }
+    }
+}
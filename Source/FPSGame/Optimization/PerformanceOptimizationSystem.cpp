@@ -6,11 +6,26 @@
 #include "Components/StaticMeshComponent.h"
 #include "Components/SkeletalMeshComponent.h"
 #include "Engine/StaticMeshActor.h"
+#include "Engine/StaticMesh.h"
 #include "HAL/PlatformMemory.h"
+#include "Misc/App.h"
 #include "Stats/Stats.h"
 #include "Async/ParallelFor.h"
 #include "Engine/GameViewportClient.h"
-#include "Kismet/GameplayStatics.h"
+#include "EngineUtils.h"
+#include "ConvexVolume.h"
+#include "Camera/PlayerCameraManager.h"
+#include "FrameTelemetrySubsystem.h"
+#include "FrameBudgetSubsystem.h"
+#include "MemoryPressureSubsystem.h"
+#include "FPSGameStats.h"
+#include "PooledWeaponEffectsComponent.h"
+#include "AdvancedObjectPoolManager.h"
+#include "Engine/GameInstance.h"
+#include "AI/AILODScheduler.h"
+#include "Misc/FileHelper.h"
+#include "HAL/FileManager.h"
+#include "Misc/Paths.h"
 #include "TimerManager.h"
 
 APerformanceOptimizationSystem::APerformanceOptimizationSystem()
@@ -30,13 +45,6 @@ APerformanceOptimizationSystem::APerformanceOptimizationSystem()
     OptimizationSettings.bEnablePredictiveOptimization = true;
     OptimizationSettings.bEnableGPUProfiling = true;
     
-    // Initialize frame time history
-    FrameTimeHistory.SetNum(FrameTimeHistorySize);
-    for (int32 i = 0; i < FrameTimeHistorySize; ++i)
-    {
-        FrameTimeHistory[i] = 0.016f; // Default to 60 FPS
-    }
-
     // Initialize thermal history
     CPUTemperatureHistory.SetNum(ThermalHistorySize);
     GPUTemperatureHistory.SetNum(ThermalHistorySize);
@@ -47,22 +55,47 @@ APerformanceOptimizationSystem::APerformanceOptimizationSystem()
     }
 
     // Initialize GPU tracking
-    GPUUsageHistory.SetNum(FrameTimeHistorySize);
-    GPUMemoryHistory.SetNum(FrameTimeHistorySize);
+    GPUUsageHistory.SetNum(GPUHistorySize);
+    GPUMemoryHistory.SetNum(GPUHistorySize);
 }
 
 void APerformanceOptimizationSystem::BeginPlay()
 {
     Super::BeginPlay();
     InitializeSystem();
+
+    // Seed the culling set once; spawn and destroy hooks keep it current from here on
+    if (UWorld* World = GetWorld())
+    {
+        for (TActorIterator<AActor> It(World); It; ++It)
+        {
+            if (OptimizationSettings.bAutoRegisterCullingActors && ShouldAutoRegisterForCulling(*It))
+            {
+                RegisterActorForCulling(*It);
+            }
+            
+            if (It->ActorHasTag(OptimizationSettings.OccluderTag))
+            {
+                RegisterOccluder(*It);
+            }
+            
+            // Components that began play before us; later ones register themselves
+            TInlineComponentArray<UPooledWeaponEffectsComponent*> EffectComponentsOnActor(*It);
+            for (UPooledWeaponEffectsComponent* Component : EffectComponentsOnActor)
+            {
+                RegisterEffectComponent(Component);
+            }
+        }
+
+        ActorSpawnedHandle = World->AddOnActorSpawnedHandler(FOnActorSpawned::FDelegate::CreateUObject(this, &APerformanceOptimizationSystem::OnActorSpawned));
+        ActorDestroyedHandle = World->AddOnActorDestroyedHandler(FOnActorDestroyed::FDelegate::CreateUObject(this, &APerformanceOptimizationSystem::OnActorDestroyed));
+    }
 }
 
 void APerformanceOptimizationSystem::Tick(float DeltaTime)
 {
     Super::Tick(DeltaTime);
     
-    ProcessFrameTimeHistory(DeltaTime);
-    
     // Update LOD system
     if (OptimizationSettings.bEnableLODSystem)
     {
@@ -143,36 +176,56 @@ void APerformanceOptimizationSystem::Tick(float DeltaTime)
         ProcessAsyncTasks();
     }
     
-    // Auto-optimize based on performance
-    if (!IsPerformanceTargetMet())
+    // Adaptive quality toward the target frame rate
+    if (OptimizationSettings.bEnablePredictiveOptimization)
     {
-        OptimizeBasedOnPerformance();
-        
-        // Apply thermal throttling if needed
-        if (OptimizationSettings.bEnableThermalMonitoring && IsThermalThrottlingNeeded())
+        if (!bQualityControlActive)
         {
-            ApplyThermalThrottling();
+            bQualityControlActive = true;
+            ApplyQualityLevels(true);
         }
         
-        // Apply predictive optimizations
-        if (OptimizationSettings.bEnablePredictiveOptimization)
+        QualityControllerTimer += DeltaTime;
+        if (QualityControllerTimer >= OptimizationSettings.QualityControllerInterval)
         {
             ApplyPredictiveOptimizations();
+            QualityControllerTimer = 0.0f;
         }
     }
+    else if (bQualityControlActive)
+    {
+        ReleaseQualityControl();
+    }
 }
 
 void APerformanceOptimizationSystem::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
-    // Clean up async tasks
-    for (auto& Task : AsyncTasks)
+    // Queued work is discarded; running tasks reference us, so they finish first
+    if (TaskScheduler)
     {
-        if (Task.IsValid())
-        {
-            Task.Wait();
-        }
+        TaskScheduler->Shutdown();
+        TaskScheduler.Reset();
+    }
+
+    if (UWorld* World = GetWorld())
+    {
+        World->RemoveOnActorSpawnedHandler(ActorSpawnedHandle);
+        World->RemoveOnActorDestroyededHandler(ActorDestroyedHandle);
+    }
+
+    // Don't leave anything hidden once we stop managing it
+    for (int32 Index = CullingActors.Num() - 1; Index >= 0; --Index)
+    {
+        UnregisterActorFromCulling(CullingActors[Index].Get());
     }
-    AsyncTasks.Empty();
+    CullingActors.Empty();
+    CullingCells.Empty();
+    CullingIndices.Empty();
+    CulledBits.Empty();
+    CullingDirtyBits.Empty();
+    NumCulledActors = 0;
+    
+    FlushQualityLog();
     
     Super::EndPlay(EndPlayReason);
 }
@@ -181,64 +234,196 @@ void APerformanceOptimizationSystem::InitializeSystem()
 {
     UE_LOG(LogTemp, Warning, TEXT("Initializing Performance Optimization System"));
     
+    TaskScheduler = MakeUnique<FOptimizationTaskScheduler>(AsyncTaskQueueCapacity, OptimizationSettings.MaxAsyncTasks);
+    
+    UGameInstance* GameInstance = GetGameInstance();
+    PoolManager = GameInstance ? GameInstance->GetSubsystem<UAdvancedObjectPoolManager>() : nullptr;
+    
     // Initialize object pools for common objects
     InitializePool(AStaticMeshActor::StaticClass(), OptimizationSettings.DefaultPoolSize);
     
     // Load optimization settings from config
     LoadOptimizationSettings();
+    
+    BaseMaxCullingDistance = OptimizationSettings.MaxCullingDistance;
+    
+    // Every subsystem's frame budget is carved out of the same target
+    if (UFrameBudgetSubsystem* FrameBudget = UFrameBudgetSubsystem::Get(this))
+    {
+        FrameBudget->SetTargetFrameTime(1000.0f / FMath::Max(OptimizationSettings.TargetFrameRate, 1.0f));
+    }
+    
+    // Memory thresholds are fractions of the same budget the metrics are checked against
+    if (UMemoryPressureSubsystem* MemoryPressure = UMemoryPressureSubsystem::Get(this))
+    {
+        FMemoryPressureSettings PressureSettings;
+        PressureSettings.MemoryBudgetMB = OptimizationSettings.MaxMemoryUsageMB;
+        MemoryPressure->SetPressureSettings(PressureSettings);
+    }
 }
 
 void APerformanceOptimizationSystem::UpdateLODSystem()
 {
+    FPSGAME_SCOPE_CYCLE_COUNTER(LOD);
+    
     if (!OptimizationSettings.bEnableLODSystem) return;
     
-    // Process LOD updates asynchronously
-    if (OptimizationSettings.bEnableAsyncProcessing)
+    APlayerController* PC = GetPlayerController();
+    if (!PC || !PC->GetPawn()) return;
+    
+    const FVector ViewLocation = PC->GetPawn()->GetActorLocation();
+    LODUpdateCount++;
+    LODEvaluationsLastUpdate = 0;
+    
+    // Slot changes are deferred so the containers are not modified while being walked
+    TArray<int32, TInlineAllocator<16>> DeadSlots;
+    TArray<int32, TInlineAllocator<16>> MovedSlots;
+    
+    float UnusedBandLow = 0.0f;
+    float UnusedBandHigh = 0.0f;
+    for (int32 Slot : MovableLODSlots)
     {
-        AddAsyncTask([this]()
+        if (!EvaluateLODEntry(Slot, ViewLocation, UnusedBandLow, UnusedBandHigh))
         {
-            for (auto& LODPair : RegisteredLODActors)
-            {
-                if (IsValid(LODPair.Key))
-                {
-                    UpdateLODForActor(LODPair.Key, LODPair.Value);
-                }
-            }
-        });
+            DeadSlots.Add(Slot);
+        }
     }
-    else
+    
+    const float CellSize = FMath::Max(OptimizationSettings.LODCellSize, 1.0f);
+    const int32 Stagger = FMath::Max(1, OptimizationSettings.LODFarCellStagger);
+    
+    for (auto& CellPair : LODCells)
     {
-        // Process synchronously
-        for (auto& LODPair : RegisteredLODActors)
+        FLODCell& Cell = CellPair.Value;
+        
+        const FVector CellMin = FVector(CellPair.Key) * CellSize;
+        const FBox CellBounds(CellMin, CellMin + FVector(CellSize));
+        const float MinDistance = FMath::Sqrt(CellBounds.ComputeSquaredDistanceToPoint(ViewLocation));
+        const FVector FarthestOffset(
+            FMath::Max(FMath::Abs(ViewLocation.X - CellBounds.Min.X), FMath::Abs(ViewLocation.X - CellBounds.Max.X)),
+            FMath::Max(FMath::Abs(ViewLocation.Y - CellBounds.Min.Y), FMath::Abs(ViewLocation.Y - CellBounds.Max.Y)),
+            FMath::Max(FMath::Abs(ViewLocation.Z - CellBounds.Min.Z), FMath::Abs(ViewLocation.Z - CellBounds.Max.Z)));
+        const float MaxDistance = FarthestOffset.Size();
+        
+        // Every member is still inside its current band wherever it sits in the cell
+        if (!Cell.bNeedsEvaluation && MinDistance / LODDistanceScale > Cell.MaxBandLow && MaxDistance / LODDistanceScale <= Cell.MinBandHigh)
         {
-            if (IsValid(LODPair.Key))
+            continue;
+        }
+        
+        // Far cells take turns so a large view change does not land on one update
+        if (MinDistance > OptimizationSettings.LODStaggerDistance && (GetTypeHash(CellPair.Key) + LODUpdateCount) % Stagger != 0)
+        {
+            continue;
+        }
+        
+        Cell.MaxBandLow = -1.0f;
+        Cell.MinBandHigh = TNumericLimits<float>::Max();
+        
+        for (int32 Slot : Cell.Slots)
+        {
+            if (!EvaluateLODEntry(Slot, ViewLocation, Cell.MaxBandLow, Cell.MinBandHigh))
             {
-                UpdateLODForActor(LODPair.Key, LODPair.Value);
+                DeadSlots.Add(Slot);
+                continue;
+            }
+            
+            // Static actors can still be teleported
+            if (ToLODCell(LODEntries[Slot].Actor->GetActorLocation()) != CellPair.Key)
+            {
+                MovedSlots.Add(Slot);
             }
         }
+        
+        Cell.bNeedsEvaluation = false;
+    }
+    
+    for (int32 Slot : MovedSlots)
+    {
+        RemoveFromLODCell(Slot);
+        AddToLODCell(Slot, ToLODCell(LODEntries[Slot].Actor->GetActorLocation()));
+    }
+    
+    for (int32 Slot : DeadSlots)
+    {
+        FreeLODSlot(Slot);
     }
 }
 
-void APerformanceOptimizationSystem::RegisterActorForLOD(AActor* Actor, const FLODSettings& LODSettings)
+FLODHandle APerformanceOptimizationSystem::RegisterActorForLOD(AActor* Actor, const FLODSettings& LODSettings)
 {
-    if (!IsValid(Actor)) return;
+    FLODHandle Handle;
+    if (!IsValid(Actor)) return Handle;
+    
+    if (const int32* ExistingSlot = LODSlotByActor.Find(Actor))
+    {
+        FLODEntry& Entry = LODEntries[*ExistingSlot];
+        Entry.Settings = LODSettings;
+        Entry.bLODKnown = false;
+        if (FLODCell* Cell = Entry.bMovable ? nullptr : LODCells.Find(Entry.Cell))
+        {
+            Cell->bNeedsEvaluation = true;
+        }
+        
+        Handle.Index = *ExistingSlot;
+        Handle.Generation = Entry.Generation;
+        return Handle;
+    }
+    
+    const int32 Slot = FreeLODSlots.Num() > 0 ? FreeLODSlots.Pop(false) : LODEntries.AddDefaulted();
+    FLODEntry& Entry = LODEntries[Slot];
+    Entry.Actor = Actor;
+    Entry.Settings = LODSettings;
+    Entry.bLODKnown = false;
+    Entry.bInUse = true;
+    
+    USceneComponent* Root = Actor->GetRootComponent();
+    Entry.bMovable = !Root || Root->Mobility == EComponentMobility::Movable;
+    
+    LODSlotByActor.Add(Actor, Slot);
     
-    RegisteredLODActors.Add(Actor, LODSettings);
+    if (Entry.bMovable)
+    {
+        MovableLODSlots.Add(Slot);
+    }
+    else
+    {
+        AddToLODCell(Slot, ToLODCell(Actor->GetActorLocation()));
+    }
+    
+    Handle.Index = Slot;
+    Handle.Generation = Entry.Generation;
+    return Handle;
 }
 
 void APerformanceOptimizationSystem::UnregisterActorFromLOD(AActor* Actor)
 {
-    if (!IsValid(Actor)) return;
+    if (!Actor) return;
     
-    RegisteredLODActors.Remove(Actor);
+    if (const int32* Slot = LODSlotByActor.Find(Actor))
+    {
+        FreeLODSlot(*Slot);
+    }
+}
+
+void APerformanceOptimizationSystem::UnregisterLODHandle(FLODHandle Handle)
+{
+    // A stale handle must not free whoever reused the slot
+    if (LODEntries.IsValidIndex(Handle.Index) && LODEntries[Handle.Index].bInUse && LODEntries[Handle.Index].Generation == Handle.Generation)
+    {
+        FreeLODSlot(Handle.Index);
+    }
 }
 
 int32 APerformanceOptimizationSystem::CalculateLODLevel(AActor* Actor, const FLODSettings& LODSettings)
 {
     if (!IsValid(Actor)) return 0;
     
-    float Distance = CalculateDistanceToPlayer(Actor);
-    
+    return GetLODLevelForDistance(CalculateDistanceToPlayer(Actor), LODSettings);
+}
+
+int32 APerformanceOptimizationSystem::GetLODLevelForDistance(float Distance, const FLODSettings& LODSettings)
+{
     if (Distance > LODSettings.CullDistance)
     {
         return -1; // Cull the actor
@@ -261,12 +446,64 @@ int32 APerformanceOptimizationSystem::CalculateLODLevel(AActor* Actor, const FLO
     }
 }
 
-void APerformanceOptimizationSystem::UpdateLODForActor(AActor* Actor, const FLODSettings& LODSettings)
+void APerformanceOptimizationSystem::GetLODBand(int32 LODLevel, const FLODSettings& LODSettings, float& OutLow, float& OutHigh)
 {
-    if (!IsValid(Actor)) return;
+    // A distance d keeps this level while OutLow < d <= OutHigh
+    switch (LODLevel)
+    {
+        case 0:
+            OutLow = -1.0f;
+            OutHigh = LODSettings.LOD1Distance;
+            break;
+        case 1:
+            OutLow = LODSettings.LOD1Distance;
+            OutHigh = LODSettings.LOD2Distance;
+            break;
+        case 2:
+            OutLow = LODSettings.LOD2Distance;
+            OutHigh = LODSettings.LOD3Distance;
+            break;
+        case 3:
+            OutLow = LODSettings.LOD3Distance;
+            OutHigh = LODSettings.CullDistance;
+            break;
+        default:
+            OutLow = LODSettings.CullDistance;
+            OutHigh = TNumericLimits<float>::Max();
+            break;
+    }
+}
+
+bool APerformanceOptimizationSystem::EvaluateLODEntry(int32 Slot, const FVector& ViewLocation, float& InOutMaxBandLow, float& InOutMinBandHigh)
+{
+    FLODEntry& Entry = LODEntries[Slot];
+    AActor* Actor = Entry.Actor.Get();
+    if (!IsValid(Actor)) return false;
+    
+    LODEvaluationsLastUpdate++;
+    
+    const float Distance = FVector::Dist(Actor->GetActorLocation(), ViewLocation) / LODDistanceScale;
+    const int32 LODLevel = GetLODLevelForDistance(Distance, Entry.Settings);
     
-    int32 LODLevel = CalculateLODLevel(Actor, LODSettings);
+    // Components are only touched when the level actually changes
+    if (!Entry.bLODKnown || LODLevel != Entry.LODLevel)
+    {
+        Entry.LODLevel = LODLevel;
+        Entry.bLODKnown = true;
+        ApplyLODLevel(Actor, LODLevel);
+    }
     
+    float BandLow = 0.0f;
+    float BandHigh = 0.0f;
+    GetLODBand(LODLevel, Entry.Settings, BandLow, BandHigh);
+    InOutMaxBandLow = FMath::Max(InOutMaxBandLow, BandLow);
+    InOutMinBandHigh = FMath::Min(InOutMinBandHigh, BandHigh);
+    
+    return true;
+}
+
+void APerformanceOptimizationSystem::ApplyLODLevel(AActor* Actor, int32 LODLevel)
+{
     if (LODLevel == -1)
     {
         CullActor(Actor);
@@ -278,6 +515,65 @@ void APerformanceOptimizationSystem::UpdateLODForActor(AActor* Actor, const FLOD
     }
 }
 
+FIntVector APerformanceOptimizationSystem::ToLODCell(const FVector& Location) const
+{
+    const float CellSize = FMath::Max(OptimizationSettings.LODCellSize, 1.0f);
+    return FIntVector(
+        FMath::FloorToInt(Location.X / CellSize),
+        FMath::FloorToInt(Location.Y / CellSize),
+        FMath::FloorToInt(Location.Z / CellSize));
+}
+
+void APerformanceOptimizationSystem::AddToLODCell(int32 Slot, const FIntVector& Cell)
+{
+    LODEntries[Slot].Cell = Cell;
+    
+    FLODCell& LODCell = LODCells.FindOrAdd(Cell);
+    LODCell.Slots.Add(Slot);
+    LODCell.bNeedsEvaluation = true;
+}
+
+void APerformanceOptimizationSystem::RemoveFromLODCell(int32 Slot)
+{
+    const FLODEntry& Entry = LODEntries[Slot];
+    if (Entry.bMovable)
+    {
+        MovableLODSlots.RemoveSingleSwap(Slot, false);
+        return;
+    }
+    
+    if (FLODCell* LODCell = LODCells.Find(Entry.Cell))
+    {
+        LODCell->Slots.RemoveSingleSwap(Slot, false);
+        if (LODCell->Slots.Num() == 0)
+        {
+            LODCells.Remove(Entry.Cell);
+        }
+    }
+}
+
+void APerformanceOptimizationSystem::FreeLODSlot(int32 Slot)
+{
+    FLODEntry& Entry = LODEntries[Slot];
+    if (!Entry.bInUse) return;
+    
+    RemoveFromLODCell(Slot);
+    LODSlotByActor.Remove(Entry.Actor);
+    
+    Entry.Actor.Reset();
+    Entry.bInUse = false;
+    Entry.Generation++;
+    FreeLODSlots.Add(Slot);
+}
+
+void APerformanceOptimizationSystem::MarkLODBandsDirty()
+{
+    for (auto& CellPair : LODCells)
+    {
+        CellPair.Value.bNeedsEvaluation = true;
+    }
+}
+
 void APerformanceOptimizationSystem::SetActorLODLevel(AActor* Actor, int32 LODLevel)
 {
     if (!IsValid(Actor)) return;
@@ -309,226 +605,387 @@ void APerformanceOptimizationSystem::SetActorLODLevel(AActor* Actor, int32 LODLe
 
 AActor* APerformanceOptimizationSystem::GetPooledObject(UClass* ObjectClass)
 {
-    if (!ObjectClass) return nullptr;
+    if (!ObjectClass || !ObjectClass->IsChildOf<AActor>() || !PoolManager) return nullptr;
     
-    TArray<FPooledObject>* Pool = ObjectPools.Find(ObjectClass);
-    if (!Pool) return nullptr;
+    return PoolManager->AcquireActor(ObjectClass);
+}
+
+void APerformanceOptimizationSystem::ReturnPooledObject(AActor* Object)
+{
+    if (!IsValid(Object) || !PoolManager) return;
     
-    // Find an unused object
-    for (FPooledObject& PooledObj : *Pool)
+    PoolManager->ReleaseActor(Object);
+}
+
+void APerformanceOptimizationSystem::InitializePool(UClass* ObjectClass, int32 PoolSize)
+{
+    if (!ObjectClass || !ObjectClass->IsChildOf<AActor>() || !PoolManager) return;
+    
+    // Same growth limit the system has always allowed: twice the initial size
+    FObjectPoolConfig Config = PoolManager->GetGlobalConfig();
+    Config.InitialSize = PoolSize;
+    Config.MaxSize = PoolSize * 2;
+    PoolManager->CreatePool(ObjectClass, Config);
+    
+    UE_LOG(LogTemp, Warning, TEXT("Initialized object pool for %s with %d objects"), 
+           *ObjectClass->GetName(), PoolSize);
+}
+
+void APerformanceOptimizationSystem::CleanupPools()
+{
+    if (PoolManager)
     {
-        if (!PooledObj.bInUse && IsValid(PooledObj.Actor))
+        PoolManager->CleanupAllPools();
+    }
+}
+
+void APerformanceOptimizationSystem::UpdateCullingSystem()
+{
+    FPSGAME_SCOPE_CYCLE_COUNTER(Culling);
+    
+    if (!OptimizationSettings.bEnableFrustumCulling && !OptimizationSettings.bEnableOcclusionCulling) 
+        return;
+    
+    // A moved view or changed settings affects every actor; otherwise only actors that changed cell
+    const bool bReevaluateAll = HaveCullingInputsChanged();
+    
+    APlayerController* PC = GetPlayerController();
+    APawn* ViewPawn = PC ? PC->GetPawn() : nullptr;
+    
+    // Snapshot everything the job needs; the workers only ever read this array
+    CullingJobItems.Reset();
+    
+    // Stale entries are removed after the results are applied so job indices stay valid
+    TArray<int32, TInlineAllocator<16>> StaleIndices;
+    
+    for (int32 Index = 0; Index < CullingActors.Num(); ++Index)
+    {
+        AActor* Actor = CullingActors[Index].Get();
+        if (!IsValid(Actor))
         {
-            PooledObj.bInUse = true;
-            PooledObj.LastUsedTime = GetWorld()->GetTimeSeconds();
-            PooledObj.Actor->SetActorHiddenInGame(false);
-            PooledObj.Actor->SetActorEnableCollision(true);
-            return PooledObj.Actor;
+            StaleIndices.Add(Index);
+            continue;
         }
+        
+        const FVector Location = Actor->GetActorLocation();
+        const FIntVector Cell = ToCullingCell(Location);
+        if (!bReevaluateAll && !CullingDirtyBits[Index] && Cell == CullingCells[Index])
+        {
+            continue;
+        }
+        
+        CullingCells[Index] = Cell;
+        CullingDirtyBits[Index] = false;
+        
+        // Never cull the pawn we are looking from
+        if (Actor == ViewPawn)
+        {
+            UncullActor(Actor);
+            continue;
+        }
+        
+        FCullingJobItem& Item = CullingJobItems.AddDefaulted_GetRef();
+        Actor->GetActorBounds(false, Item.BoundsOrigin, Item.BoundsExtent);
+        Item.Location = Location;
+        Item.BoundsRadius = Item.BoundsExtent.Size();
+        Item.Index = Index;
+        Item.bCull = false;
+        Item.bOccluded = false;
     }
     
-    // No available object, create new one if pool isn't full
-    if (Pool->Num() < OptimizationSettings.DefaultPoolSize * 2) // Allow pool growth
+    // Without a player everything stays visible
+    FMatrix ViewProjection;
+    if (CullingJobItems.Num() > 0 && ViewPawn && BuildCullingViewProjection(PC, ViewProjection))
     {
-        if (AActor* NewActor = GetWorld()->SpawnActor<AActor>(ObjectClass))
+        FConvexVolume Frustum;
+        GetViewFrustumBounds(Frustum, ViewProjection, false);
+        
+        // The occlusion buffer is rebuilt from the occluders every pass and only read by the job
+        bool bTestOcclusion = false;
+        if (OptimizationSettings.bEnableOcclusionCulling)
         {
-            FPooledObject NewPooledObj;
-            NewPooledObj.Actor = NewActor;
-            NewPooledObj.bInUse = true;
-            NewPooledObj.LastUsedTime = GetWorld()->GetTimeSeconds();
-            Pool->Add(NewPooledObj);
-            return NewActor;
+            BuildOcclusionBuffer(ViewProjection);
+            bTestOcclusion = OcclusionBuffer.HasOccluders();
         }
+        
+        RunCullingJob(Frustum, ViewPawn->GetActorLocation(), bTestOcclusion);
     }
     
-    return nullptr;
+    // Apply on the game thread
+    CurrentMetrics.OccludedActors = 0;
+    for (const FCullingJobItem& Item : CullingJobItems)
+    {
+        AActor* Actor = CullingActors[Item.Index].Get();
+        
+        if (Item.bOccluded)
+        {
+            CurrentMetrics.OccludedActors++;
+        }
+        
+        if (Item.bCull)
+        {
+            CullActor(Actor);
+        }
+        else
+        {
+            UncullActor(Actor);
+        }
+    }
+    
+    // Highest first, so each swap-removal pulls in an entry that is still live
+    for (int32 StaleIndex = StaleIndices.Num() - 1; StaleIndex >= 0; --StaleIndex)
+    {
+        RemoveCullingEntry(StaleIndices[StaleIndex]);
+    }
 }
 
-void APerformanceOptimizationSystem::ReturnPooledObject(AActor* Object)
+bool APerformanceOptimizationSystem::BuildCullingViewProjection(APlayerController* PC, FMatrix& OutViewProjection) const
 {
-    if (!IsValid(Object)) return;
+    FVector ViewLocation;
+    FRotator ViewRotation;
+    PC->GetPlayerViewPoint(ViewLocation, ViewRotation);
     
-    UClass* ObjectClass = Object->GetClass();
-    TArray<FPooledObject>* Pool = ObjectPools.Find(ObjectClass);
-    if (!Pool) return;
+    const float FOV = PC->PlayerCameraManager ? PC->PlayerCameraManager->GetFOVAngle() : 90.0f;
     
-    // Find the object in the pool
-    for (FPooledObject& PooledObj : *Pool)
+    FVector2D ViewportSize(16.0f, 9.0f);
+    if (GEngine && GEngine->GameViewport)
     {
-        if (PooledObj.Actor == Object)
-        {
-            PooledObj.bInUse = false;
-            PooledObj.LastUsedTime = GetWorld()->GetTimeSeconds();
-            
-            // Reset object state
-            Object->SetActorHiddenInGame(true);
-            Object->SetActorEnableCollision(false);
-            Object->SetActorLocation(FVector::ZeroVector);
-            Object->SetActorRotation(FRotator::ZeroRotator);
-            break;
-        }
+        GEngine->GameViewport->GetViewportSize(ViewportSize);
+    }
+    if (ViewportSize.X <= 0.0f || ViewportSize.Y <= 0.0f)
+    {
+        return false;
     }
+    
+    // Same view and projection setup the renderer uses
+    const FMatrix ViewMatrix = FTranslationMatrix(-ViewLocation) * FInverseRotationMatrix(ViewRotation) * FMatrix(
+        FPlane(0, 0, 1, 0),
+        FPlane(1, 0, 0, 0),
+        FPlane(0, 1, 0, 0),
+        FPlane(0, 0, 0, 1));
+    const FMatrix ProjectionMatrix = FReversedZPerspectiveMatrix(
+        FMath::DegreesToRadians(FOV * 0.5f),
+        ViewportSize.X,
+        ViewportSize.Y,
+        GNearClippingPlane);
+    
+    OutViewProjection = ViewMatrix * ProjectionMatrix;
+    return true;
 }
 
-void APerformanceOptimizationSystem::InitializePool(UClass* ObjectClass, int32 PoolSize)
+void APerformanceOptimizationSystem::BuildOcclusionBuffer(const FMatrix& ViewProjection)
 {
-    if (!ObjectClass || !GetWorld()) return;
+    const double StartTime = FPlatformTime::Seconds();
+    
+    if (OcclusionBuffer.GetWidth() != Align(OptimizationSettings.OcclusionBufferWidth, 4) || OcclusionBuffer.GetHeight() != OptimizationSettings.OcclusionBufferHeight)
+    {
+        OcclusionBuffer.Resize(OptimizationSettings.OcclusionBufferWidth, OptimizationSettings.OcclusionBufferHeight);
+    }
     
-    TArray<FPooledObject>& Pool = ObjectPools.FindOrAdd(ObjectClass);
-    Pool.Empty();
+    OcclusionBuffer.BeginFrame(ViewProjection);
     
-    for (int32 i = 0; i < PoolSize; ++i)
+    for (int32 Index = Occluders.Num() - 1; Index >= 0; --Index)
     {
-        if (AActor* NewActor = GetWorld()->SpawnActor<AActor>(ObjectClass))
+        AActor* Occluder = Occluders[Index].Get();
+        if (!IsValid(Occluder))
         {
-            FPooledObject PooledObj;
-            PooledObj.Actor = NewActor;
-            PooledObj.bInUse = false;
-            PooledObj.LastUsedTime = 0.0f;
-            
-            // Hide the object initially
-            NewActor->SetActorHiddenInGame(true);
-            NewActor->SetActorEnableCollision(false);
-            
-            Pool.Add(PooledObj);
+            Occluders.RemoveAtSwap(Index, 1, false);
+            continue;
         }
+        
+        // A hidden occluder must not hide what is behind it
+        if (Occluder->IsHidden()) continue;
+        
+        Occluder->ForEachComponent<UStaticMeshComponent>(false, [this](const UStaticMeshComponent* MeshComp)
+        {
+            if (!MeshComp->IsVisible() || !MeshComp->GetStaticMesh()) return;
+            
+            const FBox MeshBox = MeshComp->GetStaticMesh()->GetBoundingBox();
+            const FBox ShrunkBox = FBox::BuildAABB(MeshBox.GetCenter(), MeshBox.GetExtent() * OptimizationSettings.OccluderBoundsScale);
+            OcclusionBuffer.RasterizeBox(ShrunkBox, MeshComp->GetComponentTransform());
+        });
     }
     
-    UE_LOG(LogTemp, Warning, TEXT("Initialized object pool for %s with %d objects"), 
-           *ObjectClass->GetName(), Pool.Num());
+    CurrentMetrics.OcclusionBuildTimeMs = (float)((FPlatformTime::Seconds() - StartTime) * 1000.0);
 }
 
-void APerformanceOptimizationSystem::CleanupPools()
+void APerformanceOptimizationSystem::RunCullingJob(const FConvexVolume& Frustum, const FVector& DistanceOrigin, bool bTestOcclusion)
 {
-    float CurrentTime = GetWorld()->GetTimeSeconds();
-    float CleanupThreshold = 300.0f; // 5 minutes
+    const float MaxDistanceSquared = FMath::Square(OptimizationSettings.MaxCullingDistance);
+    const bool bFrustumCulling = OptimizationSettings.bEnableFrustumCulling;
+    FCullingJobItem* Items = CullingJobItems.GetData();
+    const int32 NumItems = CullingJobItems.Num();
+    const int32 NumChunks = FMath::DivideAndRoundUp(NumItems, CullingJobChunkSize);
     
-    for (auto& PoolPair : ObjectPools)
+    const FSoftwareOcclusionBuffer& Occlusion = OcclusionBuffer;
+    std::atomic<uint64> OcclusionTestCycles{0};
+    
+    // Each chunk writes only its own items; the frustum test uses the volume's SIMD plane path
+    auto ProcessChunk = [=, &Frustum, &Occlusion, &OcclusionTestCycles](int32 ChunkIndex)
     {
-        TArray<FPooledObject>& Pool = PoolPair.Value;
+        const int32 First = ChunkIndex * CullingJobChunkSize;
+        const int32 Last = FMath::Min(First + CullingJobChunkSize, NumItems);
+        uint64 ChunkOcclusionCycles = 0;
         
-        // Remove unused objects that haven't been used for a while
-        for (int32 i = Pool.Num() - 1; i >= 0; --i)
+        for (int32 ItemIndex = First; ItemIndex < Last; ++ItemIndex)
         {
-            FPooledObject& PooledObj = Pool[i];
+            FCullingJobItem& Item = Items[ItemIndex];
+            Item.bCull = FVector::DistSquared(Item.Location, DistanceOrigin) > MaxDistanceSquared ||
+                (bFrustumCulling && !Frustum.IntersectSphere(Item.BoundsOrigin, Item.BoundsRadius));
             
-            if (!PooledObj.bInUse && 
-                (CurrentTime - PooledObj.LastUsedTime) > CleanupThreshold)
+            // Only survivors pay for the occlusion test
+            if (!Item.bCull && bTestOcclusion)
             {
-                if (IsValid(PooledObj.Actor))
-                {
-                    PooledObj.Actor->Destroy();
-                }
-                Pool.RemoveAt(i);
+                const uint64 StartCycles = FPlatformTime::Cycles64();
+                Item.bOccluded = Occlusion.IsBoxOccluded(FBox::BuildAABB(Item.BoundsOrigin, Item.BoundsExtent));
+                Item.bCull = Item.bOccluded;
+                ChunkOcclusionCycles += FPlatformTime::Cycles64() - StartCycles;
             }
         }
-    }
+        
+        OcclusionTestCycles.fetch_add(ChunkOcclusionCycles, std::memory_order_relaxed);
+    };
+    
+    ParallelFor(NumChunks, ProcessChunk, !OptimizationSettings.bEnableAsyncProcessing || NumChunks == 1);
+    
+    CurrentMetrics.OcclusionTestTimeMs = (float)FPlatformTime::ToMilliseconds64(OcclusionTestCycles.load());
 }
 
-void APerformanceOptimizationSystem::UpdateCullingSystem()
+void APerformanceOptimizationSystem::RegisterActorForCulling(AActor* Actor)
 {
-    if (!OptimizationSettings.bEnableFrustumCulling && !OptimizationSettings.bEnableOcclusionCulling) 
-        return;
+    if (!IsValid(Actor) || Actor == this || CullingIndices.Contains(Actor)) return;
     
-    // Clear previous frame data
-    VisibleActors.Empty();
+    const int32 Index = CullingActors.Add(Actor);
+    CullingCells.Add(ToCullingCell(Actor->GetActorLocation()));
+    CulledBits.Add(false);
+    CullingDirtyBits.Add(true);
+    CullingIndices.Add(Actor, Index);
+}
+
+void APerformanceOptimizationSystem::UnregisterActorFromCulling(AActor* Actor)
+{
+    if (!Actor) return;
     
-    // Get all relevant actors
-    TArray<AActor*> AllActors;
-    UGameplayStatics::GetAllActorsOfClass(GetWorld(), AActor::StaticClass(), AllActors);
+    const int32* Index = CullingIndices.Find(Actor);
+    if (!Index) return;
     
-    // Process culling asynchronously
-    if (OptimizationSettings.bEnableAsyncProcessing && AllActors.Num() > 100)
+    const int32 RemovedIndex = *Index;
+    if (CulledBits[RemovedIndex] && IsValid(Actor))
     {
-        AddAsyncTask([this, AllActors]()
-        {
-            for (AActor* Actor : AllActors)
-            {
-                if (IsValid(Actor) && Actor != this)
-                {
-                    bool bShouldCull = false;
-                    
-                    // Distance culling
-                    float Distance = CalculateDistanceToPlayer(Actor);
-                    if (Distance > OptimizationSettings.MaxCullingDistance)
-                    {
-                        bShouldCull = true;
-                    }
-                    
-                    // Frustum culling
-                    if (!bShouldCull && OptimizationSettings.bEnableFrustumCulling)
-                    {
-                        if (!IsActorInViewFrustum(Actor))
-                        {
-                            bShouldCull = true;
-                        }
-                    }
-                    
-                    // Occlusion culling
-                    if (!bShouldCull && OptimizationSettings.bEnableOcclusionCulling)
-                    {
-                        if (IsActorOccluded(Actor))
-                        {
-                            bShouldCull = true;
-                        }
-                    }
-                    
-                    if (bShouldCull)
-                    {
-                        CullActor(Actor);
-                    }
-                    else
-                    {
-                        UncullActor(Actor);
-                        VisibleActors.Add(Actor);
-                    }
-                }
-            }
-        });
+        UncullActor(Actor);
     }
-    else
+    RemoveCullingEntry(RemovedIndex);
+}
+
+void APerformanceOptimizationSystem::RemoveCullingEntry(int32 Index)
+{
+    if (CulledBits[Index])
+    {
+        NumCulledActors--;
+    }
+    
+    const int32 LastIndex = CullingActors.Num() - 1;
+    CullingIndices.Remove(CullingActors[Index]);
+    if (Index != LastIndex)
+    {
+        CullingIndices.Add(CullingActors[LastIndex], Index);
+    }
+    
+    CullingActors.RemoveAtSwap(Index, 1, false);
+    CullingCells.RemoveAtSwap(Index, 1, false);
+    CulledBits.RemoveAtSwap(Index);
+    CullingDirtyBits.RemoveAtSwap(Index);
+}
+
+bool APerformanceOptimizationSystem::ShouldAutoRegisterForCulling(const AActor* Actor) const
+{
+    if (!IsValid(Actor) || Actor == this || Actor->IsHidden() || !Actor->GetRootComponent())
+    {
+        return false;
+    }
+    
+    // Only actors that actually render something are worth culling
+    bool bHasVisiblePrimitive = false;
+    Actor->ForEachComponent<UPrimitiveComponent>(false, [&bHasVisiblePrimitive](const UPrimitiveComponent* Primitive)
     {
-        // Process synchronously
-        for (AActor* Actor : AllActors)
+        bHasVisiblePrimitive |= Primitive->IsVisible();
+    });
+    return bHasVisiblePrimitive;
+}
+
+bool APerformanceOptimizationSystem::HaveCullingInputsChanged()
+{
+    bool bChanged = false;
+    
+    APlayerController* PC = GetPlayerController();
+    if (PC && PC->GetPawn())
+    {
+        const FVector ViewLocation = PC->GetPawn()->GetActorLocation();
+        const FRotator ViewRotation = PC->GetControlRotation();
+        
+        // Small view changes are absorbed; the cell test still catches actors crossing the boundary
+        if (FVector::DistSquared(ViewLocation, LastCullingViewLocation) > FMath::Square(OptimizationSettings.CullingCellSize * 0.25f) ||
+            !ViewRotation.Equals(LastCullingViewRotation, 2.0f))
         {
-            if (IsValid(Actor) && Actor != this)
-            {
-                bool bShouldCull = false;
-                
-                float Distance = CalculateDistanceToPlayer(Actor);
-                if (Distance > OptimizationSettings.MaxCullingDistance)
-                {
-                    bShouldCull = true;
-                }
-                
-                if (!bShouldCull && OptimizationSettings.bEnableFrustumCulling)
-                {
-                    if (!IsActorInViewFrustum(Actor))
-                    {
-                        bShouldCull = true;
-                    }
-                }
-                
-                if (!bShouldCull && OptimizationSettings.bEnableOcclusionCulling)
-                {
-                    if (IsActorOccluded(Actor))
-                    {
-                        bShouldCull = true;
-                    }
-                }
-                
-                if (bShouldCull)
-                {
-                    CullActor(Actor);
-                }
-                else
-                {
-                    UncullActor(Actor);
-                    VisibleActors.Add(Actor);
-                }
-            }
+            LastCullingViewLocation = ViewLocation;
+            LastCullingViewRotation = ViewRotation;
+            bChanged = true;
         }
     }
+    
+    uint32 SettingsHash = GetTypeHash(OptimizationSettings.MaxCullingDistance);
+    SettingsHash = HashCombine(SettingsHash, GetTypeHash(OptimizationSettings.CullingCellSize));
+    SettingsHash = HashCombine(SettingsHash, GetTypeHash(OptimizationSettings.bEnableFrustumCulling));
+    SettingsHash = HashCombine(SettingsHash, GetTypeHash(OptimizationSettings.bEnableOcclusionCulling));
+    if (SettingsHash != LastCullingSettingsHash)
+    {
+        LastCullingSettingsHash = SettingsHash;
+        bChanged = true;
+    }
+    
+    const float CurrentTime = GetWorld()->GetTimeSeconds();
+    if (LastCullingFullRefreshTime < 0.0f || CurrentTime - LastCullingFullRefreshTime >= OptimizationSettings.CullingFullRefreshInterval)
+    {
+        bChanged = true;
+    }
+    
+    if (bChanged)
+    {
+        LastCullingFullRefreshTime = CurrentTime;
+    }
+    
+    return bChanged;
+}
+
+FIntVector APerformanceOptimizationSystem::ToCullingCell(const FVector& Location) const
+{
+    const float CellSize = FMath::Max(OptimizationSettings.CullingCellSize, 1.0f);
+    return FIntVector(
+        FMath::FloorToInt(Location.X / CellSize),
+        FMath::FloorToInt(Location.Y / CellSize),
+        FMath::FloorToInt(Location.Z / CellSize));
+}
+
+void APerformanceOptimizationSystem::OnActorSpawned(AActor* Actor)
+{
+    if (OptimizationSettings.bAutoRegisterCullingActors && ShouldAutoRegisterForCulling(Actor))
+    {
+        RegisterActorForCulling(Actor);
+    }
+    
+    if (IsValid(Actor) && Actor->ActorHasTag(OptimizationSettings.OccluderTag))
+    {
+        RegisterOccluder(Actor);
+    }
+}
+
+void APerformanceOptimizationSystem::OnActorDestroyed(AActor* Actor)
+{
+    // The actor is going away, so there is no point restoring its visibility
+    if (const int32* Index = CullingIndices.Find(Actor))
+    {
+        RemoveCullingEntry(*Index);
+    }
 }
 
 bool APerformanceOptimizationSystem::IsActorInViewFrustum(AActor* Actor)
@@ -554,63 +1011,75 @@ bool APerformanceOptimizationSystem::IsActorOccluded(AActor* Actor)
 {
     if (!IsValid(Actor)) return false;
     
-    APlayerController* PC = GetPlayerController();
-    if (!PC || !PC->GetPawn()) return false;
-    
-    FVector PlayerLocation = PC->GetPawn()->GetActorLocation();
-    FVector ActorLocation = Actor->GetActorLocation();
-    
-    // Perform line trace to check for occlusion
-    FHitResult HitResult;
-    FCollisionQueryParams QueryParams;
-    QueryParams.AddIgnoredActor(PC->GetPawn());
-    QueryParams.AddIgnoredActor(Actor);
-    
-    bool bHit = GetWorld()->LineTraceSingleByChannel(
-        HitResult,
-        PlayerLocation,
-        ActorLocation,
-        ECC_Visibility,
-        QueryParams
-    );
+    // Tested against the buffer from the last culling pass
+    FVector Origin;
+    FVector Extent;
+    Actor->GetActorBounds(false, Origin, Extent);
+    return OcclusionBuffer.IsBoxOccluded(FBox::BuildAABB(Origin, Extent));
+}
+
+void APerformanceOptimizationSystem::RegisterOccluder(AActor* Actor)
+{
+    if (!IsValid(Actor)) return;
     
-    return bHit; // If we hit something, the actor is occluded
+    Occluders.AddUnique(Actor);
+}
+
+void APerformanceOptimizationSystem::UnregisterOccluder(AActor* Actor)
+{
+    Occluders.RemoveSingleSwap(Actor, false);
 }
 
 void APerformanceOptimizationSystem::CullActor(AActor* Actor)
 {
     if (!IsValid(Actor)) return;
     
-    Actor->SetActorHiddenInGame(true);
-    Actor->SetActorTickEnabled(false);
-    
-    if (!CulledActors.Contains(Actor))
+    // Registered actors skip the component updates when their state is unchanged
+    if (const int32* Index = CullingIndices.Find(Actor))
     {
-        CulledActors.Add(Actor);
+        if (CulledBits[*Index]) return;
+        CulledBits[*Index] = true;
+        NumCulledActors++;
     }
+    
+    Actor->SetActorHiddenInGame(true);
+    Actor->SetActorTickEnabled(false);
 }
 
 void APerformanceOptimizationSystem::UncullActor(AActor* Actor)
 {
     if (!IsValid(Actor)) return;
     
+    if (const int32* Index = CullingIndices.Find(Actor))
+    {
+        if (!CulledBits[*Index]) return;
+        CulledBits[*Index] = false;
+        NumCulledActors--;
+    }
+    
     Actor->SetActorHiddenInGame(false);
     Actor->SetActorTickEnabled(true);
-    
-    CulledActors.Remove(Actor);
 }
 
 void APerformanceOptimizationSystem::UpdatePerformanceMetrics()
 {
     // Update frame rate and timing
     CurrentMetrics.FrameTime = GetAverageFrameTime();
-    CurrentMetrics.FrameRate = 1.0f / CurrentMetrics.FrameTime;
+    CurrentMetrics.FrameRate = CurrentMetrics.FrameTime > 0.0f ? 1.0f / CurrentMetrics.FrameTime : 0.0f;
+    
+    if (const UFrameTelemetrySubsystem* Telemetry = UFrameTelemetrySubsystem::Get(this))
+    {
+        const FFrameTelemetryBuffer& Frames = Telemetry->GetBuffer();
+        CurrentMetrics.FrameTimeP95Ms = Frames.GetP95Ms();
+        CurrentMetrics.FrameTimeP99Ms = Frames.GetP99Ms();
+        CurrentMetrics.HitchCount = Frames.GetHitchesInWindow();
+    }
     
     // Update memory usage
     CurrentMetrics.MemoryUsageMB = GetMemoryUsageMB();
     
     // Update actor counts
-    CurrentMetrics.VisibleActors = VisibleActors.Num();
+    CurrentMetrics.VisibleActors = CullingActors.Num() - NumCulledActors;
     
     // Get rendering stats
     CurrentMetrics.DrawCalls = 0; // Would need access to rendering stats
@@ -660,8 +1129,7 @@ void APerformanceOptimizationSystem::ApplyLowPerformanceOptimizations()
     // Reduce pool sizes
     OptimizePoolSizes();
     
-    // Force garbage collection
-    ForceGarbageCollection();
+    // No GC here: a slow frame is not a memory problem, and a full purge would only add a hitch
     
     OnOptimizationApplied.Broadcast(1); // Low performance optimization level
 }
@@ -669,47 +1137,44 @@ void APerformanceOptimizationSystem::ApplyLowPerformanceOptimizations()
 void APerformanceOptimizationSystem::ApplyHighPerformanceOptimizations()
 {
     // Increase LOD distances for better quality
-    for (auto& LODPair : RegisteredLODActors)
+    for (FLODEntry& Entry : LODEntries)
     {
-        LODPair.Value.LOD1Distance *= 1.1f;
-        LODPair.Value.LOD2Distance *= 1.1f;
-        LODPair.Value.LOD3Distance *= 1.1f;
+        if (!Entry.bInUse) continue;
+        
+        Entry.Settings.LOD1Distance *= 1.1f;
+        Entry.Settings.LOD2Distance *= 1.1f;
+        Entry.Settings.LOD3Distance *= 1.1f;
     }
+    MarkLODBandsDirty();
     
     OnOptimizationApplied.Broadcast(3); // High performance optimization level
 }
 
 void APerformanceOptimizationSystem::OptimizeLODSettings()
 {
-    for (auto& LODPair : RegisteredLODActors)
+    for (FLODEntry& Entry : LODEntries)
     {
-        LODPair.Value.LOD1Distance *= 0.9f;
-        LODPair.Value.LOD2Distance *= 0.9f;
-        LODPair.Value.LOD3Distance *= 0.9f;
-        LODPair.Value.CullDistance *= 0.9f;
+        if (!Entry.bInUse) continue;
+        
+        Entry.Settings.LOD1Distance *= 0.9f;
+        Entry.Settings.LOD2Distance *= 0.9f;
+        Entry.Settings.LOD3Distance *= 0.9f;
+        Entry.Settings.CullDistance *= 0.9f;
     }
+    MarkLODBandsDirty();
 }
 
 void APerformanceOptimizationSystem::OptimizeCullingSettings()
 {
-    OptimizationSettings.MaxCullingDistance *= 0.9f;
+    CullingDistanceScale *= 0.9f;
+    UpdateMaxCullingDistance();
 }
 
 void APerformanceOptimizationSystem::OptimizePoolSizes()
 {
-    for (auto& PoolPair : ObjectPools)
+    if (PoolManager)
     {
-        TArray<FPooledObject>& Pool = PoolPair.Value;
-        
-        // Remove excess unused objects
-        for (int32 i = Pool.Num() - 1; i >= OptimizationSettings.DefaultPoolSize; --i)
-        {
-            if (!Pool[i].bInUse && IsValid(Pool[i].Actor))
-            {
-                Pool[i].Actor->Destroy();
-                Pool.RemoveAt(i);
-            }
-        }
+        PoolManager->OptimizePoolSizes();
     }
 }
 
@@ -726,58 +1191,54 @@ float APerformanceOptimizationSystem::GetMemoryUsageMB() const
 
 void APerformanceOptimizationSystem::OptimizeMemoryUsage()
 {
-    // Force garbage collection
-    ForceGarbageCollection();
+    // Escalate only as far as needed; the incremental GC is the last resort
+    if (UMemoryPressureSubsystem* MemoryPressure = UMemoryPressureSubsystem::Get(this))
+    {
+        MemoryPressure->ReclaimMemory(EMemoryPressureTier::FlushEffectPools);
+    }
     
     // Clean up object pools
     CleanupPools();
     
     // Remove invalid actors from tracking
-    for (auto It = RegisteredLODActors.CreateIterator(); It; ++It)
+    for (int32 Slot = 0; Slot < LODEntries.Num(); ++Slot)
     {
-        if (!IsValid(It.Key()))
+        if (LODEntries[Slot].bInUse && !LODEntries[Slot].Actor.IsValid())
         {
-            It.RemoveCurrent();
+            FreeLODSlot(Slot);
         }
     }
     
-    CulledActors.RemoveAll([](AActor* Actor) { return !IsValid(Actor); });
-    VisibleActors.RemoveAll([](AActor* Actor) { return !IsValid(Actor); });
+    for (int32 Index = CullingActors.Num() - 1; Index >= 0; --Index)
+    {
+        if (!CullingActors[Index].IsValid())
+        {
+            RemoveCullingEntry(Index);
+        }
+    }
 }
 
 void APerformanceOptimizationSystem::ProcessAsyncTasks()
 {
-    FScopeLock Lock(&TaskCriticalSection);
+    if (!TaskScheduler) return;
     
-    // Remove completed tasks
-    for (int32 i = AsyncTasks.Num() - 1; i >= 0; --i)
-    {
-        if (AsyncTasks[i].IsReady())
-        {
-            AsyncTasks.RemoveAt(i);
-        }
-    }
+    // Settings may have changed at runtime
+    TaskScheduler->SetMaxConcurrency(OptimizationSettings.MaxAsyncTasks);
     
-    // Limit number of concurrent tasks
-    if (AsyncTasks.Num() > OptimizationSettings.MaxAsyncTasks)
-    {
-        // Wait for oldest task to complete
-        if (AsyncTasks[0].IsValid())
-        {
-            AsyncTasks[0].Wait();
-        }
-        AsyncTasks.RemoveAt(0);
-    }
+    // Completion callbacks run here, once per frame, on the game thread
+    TaskScheduler->ProcessCompletions();
 }
 
-void APerformanceOptimizationSystem::AddAsyncTask(TFunction<void()> Task)
+bool APerformanceOptimizationSystem::AddAsyncTask(TFunction<void()> Task, EOptimizationTaskPriority Priority, uint64 CoalesceKey, TFunction<void()> OnComplete)
 {
-    if (!OptimizationSettings.bEnableAsyncProcessing) return;
+    if (!OptimizationSettings.bEnableAsyncProcessing || !TaskScheduler) return false;
     
-    FScopeLock Lock(&TaskCriticalSection);
-    
-    TFuture<void> Future = Async(EAsyncExecution::ThreadPool, Task);
-    AsyncTasks.Add(MoveTemp(Future));
+    return TaskScheduler->Submit(MoveTemp(Task), Priority, CoalesceKey, MoveTemp(OnComplete));
+}
+
+FAsyncTaskSchedulerStats APerformanceOptimizationSystem::GetAsyncTaskStats() const
+{
+    return TaskScheduler ? TaskScheduler->GetStats() : FAsyncTaskSchedulerStats();
 }
 
 void APerformanceOptimizationSystem::SetOptimizationLevel(int32 Level)
@@ -804,6 +1265,9 @@ void APerformanceOptimizationSystem::ResetToDefaultSettings()
     // Reset to default optimization settings
     OptimizationSettings = FOptimizationSettings();
     LoadOptimizationSettings();
+    BaseMaxCullingDistance = OptimizationSettings.MaxCullingDistance;
+    CullingDistanceScale = 1.0f;
+    ResetAdaptiveQuality();
 }
 
 void APerformanceOptimizationSystem::SaveOptimizationSettings()
@@ -837,26 +1301,22 @@ APlayerController* APerformanceOptimizationSystem::GetPlayerController()
 
 void APerformanceOptimizationSystem::CollectGarbageIfNeeded()
 {
-    if (CurrentMetrics.MemoryUsageMB > OptimizationSettings.MaxMemoryUsageMB * 0.8f)
+    // The responder applies its own thresholds and cooldown
+    if (UMemoryPressureSubsystem* MemoryPressure = UMemoryPressureSubsystem::Get(this))
     {
-        ForceGarbageCollection();
+        MemoryPressure->EvaluatePressure();
     }
 }
 
-void APerformanceOptimizationSystem::ProcessFrameTimeHistory(float DeltaTime)
-{
-    FrameTimeHistory[FrameTimeHistoryIndex] = DeltaTime;
-    FrameTimeHistoryIndex = (FrameTimeHistoryIndex + 1) % FrameTimeHistorySize;
-}
-
 float APerformanceOptimizationSystem::GetAverageFrameTime() const
 {
-    float Total = 0.0f;
-    for (float FrameTime : FrameTimeHistory)
+    // Seconds over the last FrameTimeAverageWindow frames; without telemetry (e.g. editor worlds) fall back to the last frame
+    const UFrameTelemetrySubsystem* Telemetry = UFrameTelemetrySubsystem::Get(this);
+    if (!Telemetry || Telemetry->GetBuffer().GetNumSamples() == 0)
     {
-        Total += FrameTime;
+        return (float)FApp::GetDeltaTime();
     }
-    return Total / FrameTimeHistorySize;
+    return Telemetry->GetBuffer().GetAverageFrameTimeMs(FrameTimeAverageWindow) / 1000.0f;
 }
 
 void APerformanceOptimizationSystem::LogPerformanceMetrics() const
@@ -864,6 +1324,15 @@ void APerformanceOptimizationSystem::LogPerformanceMetrics() const
     UE_LOG(LogTemp, Warning, TEXT("Performance Metrics - FPS: %.1f, Memory: %.1fMB, Visible Actors: %d"), 
            CurrentMetrics.FrameRate, CurrentMetrics.MemoryUsageMB, CurrentMetrics.VisibleActors);
     
+    UE_LOG(LogTemp, Warning, TEXT("Frame Times - p95: %.2fms, p99: %.2fms, Hitches: %d"), 
+           CurrentMetrics.FrameTimeP95Ms, CurrentMetrics.FrameTimeP99Ms, CurrentMetrics.HitchCount);
+    
+    if (OptimizationSettings.bEnableOcclusionCulling)
+    {
+        UE_LOG(LogTemp, Warning, TEXT("Occlusion - Occluders: %d, Rejected: %d, Build: %.3fms, Test: %.3fms"), 
+               Occluders.Num(), CurrentMetrics.OccludedActors, CurrentMetrics.OcclusionBuildTimeMs, CurrentMetrics.OcclusionTestTimeMs);
+    }
+    
     if (OptimizationSettings.bEnableThermalMonitoring)
     {
         UE_LOG(LogTemp, Warning, TEXT("Thermal Metrics - CPU: %.1f°C, GPU: %.1f°C"), 
@@ -875,6 +1344,13 @@ void APerformanceOptimizationSystem::LogPerformanceMetrics() const
         UE_LOG(LogTemp, Warning, TEXT("GPU Metrics - Utilization: %.1f%%, Memory: %.1fMB"), 
                CurrentMetrics.GPUUtilization, CurrentMetrics.GPUMemoryUsageMB);
     }
+    
+    if (TaskScheduler)
+    {
+        const FAsyncTaskSchedulerStats TaskStats = TaskScheduler->GetStats();
+        UE_LOG(LogTemp, Warning, TEXT("Async Tasks - Queued: %d, Dropped: %d, Coalesced: %d, Wait p99: %.2fms, Run p99: %.2fms"), 
+               TaskStats.QueueDepth, TaskStats.Dropped, TaskStats.Coalesced, TaskStats.WaitTimeP99Ms, TaskStats.RunTimeP99Ms);
+    }
 }
 
 // Thermal monitoring implementation
@@ -930,8 +1406,9 @@ void APerformanceOptimizationSystem::UpdateGPUMetrics()
     float GPUMemory = GetGPUMemoryUsage();
     
     // Update GPU history
-    GPUUsageHistory[FrameTimeHistoryIndex] = GPUUsage;
-    GPUMemoryHistory[FrameTimeHistoryIndex] = GPUMemory;
+    GPUUsageHistory[GPUHistoryIndex] = GPUUsage;
+    GPUMemoryHistory[GPUHistoryIndex] = GPUMemory;
+    GPUHistoryIndex = (GPUHistoryIndex + 1) % GPUHistorySize;
     
     // Update current metrics
     CurrentMetrics.GPUUtilization = GPUUsage;
@@ -976,29 +1453,15 @@ void APerformanceOptimizationSystem::UpdatePredictiveMetrics()
 
 float APerformanceOptimizationSystem::PredictFrameDropRisk() const
 {
-    if (FrameTimeHistory.Num() < 10) return 0.0f;
+    const UFrameTelemetrySubsystem* Telemetry = UFrameTelemetrySubsystem::Get(this);
+    if (!Telemetry || Telemetry->GetBuffer().GetNumSamples() < FrameDropRecentWindow + FrameDropBaselineWindow) return 0.0f;
     
-    // Analyze frame time trend
-    float RecentAverage = 0.0f;
-    float OlderAverage = 0.0f;
-    int32 RecentSamples = FMath::Min(10, FrameTimeHistory.Num());
-    int32 OlderSamples = FMath::Min(20, FrameTimeHistory.Num() - RecentSamples);
+    const FFrameTelemetryBuffer& Frames = Telemetry->GetBuffer();
     
-    // Calculate recent average (last 10 frames)
-    for (int32 i = 0; i < RecentSamples; ++i)
-    {
-        int32 Index = (FrameTimeHistoryIndex - 1 - i + FrameTimeHistorySize) % FrameTimeHistorySize;
-        RecentAverage += FrameTimeHistory[Index];
-    }
-    RecentAverage /= RecentSamples;
-    
-    // Calculate older average (frames 10-30)
-    for (int32 i = RecentSamples; i < RecentSamples + OlderSamples; ++i)
-    {
-        int32 Index = (FrameTimeHistoryIndex - 1 - i + FrameTimeHistorySize) % FrameTimeHistorySize;
-        OlderAverage += FrameTimeHistory[Index];
-    }
-    OlderAverage /= OlderSamples;
+    // Analyze frame time trend: the newest frames against the ones before them
+    float RecentAverage = Frames.GetAverageFrameTimeMs(FrameDropRecentWindow) / 1000.0f;
+    float OlderAverage = Frames.GetAverageFrameTimeMs(FrameDropBaselineWindow, FrameDropRecentWindow) / 1000.0f;
+    if (OlderAverage <= 0.0f) return 0.0f;
     
     // Calculate trend and risk
     float Trend = (RecentAverage - OlderAverage) / OlderAverage;
@@ -1010,36 +1473,195 @@ float APerformanceOptimizationSystem::PredictFrameDropRisk() const
 
 void APerformanceOptimizationSystem::ApplyPredictiveOptimizations()
 {
-    if (CurrentMetrics.PredictedFrameDropRisk > 0.7f)
+    const UFrameTelemetrySubsystem* Telemetry = UFrameTelemetrySubsystem::Get(this);
+    if (!Telemetry) return;
+    
+    // Measure over the most recent frames; anything older is history the integrator already holds
+    const FFrameTelemetryBuffer& Frames = Telemetry->GetBuffer();
+    const int32 FrameWindow = FMath::Clamp(OptimizationSettings.QualityControllerFrameWindow, 1, FFrameTelemetryBuffer::Capacity);
+    if (Frames.GetNumSamples() < FrameWindow) return;
+    
+    FAdaptiveQualityInput Input;
+    int32 NumFrames = 0;
+    FFrameTelemetrySample Sample;
+    for (int32 Age = 0; Age < FrameWindow; ++Age)
     {
-        // High risk - apply aggressive optimizations
-        ApplyLowPerformanceOptimizations();
+        if (Frames.ReadSample(Age, Sample))
+        {
+            Input.FrameTimeMs += Sample.FrameTimeMs;
+            Input.GameThreadMs += Sample.GameThreadMs;
+            NumFrames++;
+        }
+    }
+    if (NumFrames == 0) return;
+    
+    Input.FrameTimeMs /= NumFrames;
+    Input.GameThreadMs /= NumFrames;
+    Input.TargetFrameTimeMs = 1000.0f / FMath::Max(OptimizationSettings.TargetFrameRate, 1.0f);
+    
+    const float CurrentTime = GetWorld()->GetTimeSeconds();
+    Input.DeltaSeconds = LastQualityUpdateTime >= 0.0f ? CurrentTime - LastQualityUpdateTime : OptimizationSettings.QualityControllerInterval;
+    LastQualityUpdateTime = CurrentTime;
+    
+    // What each knob currently costs per frame decides how the reduction is shared out
+    Input.KnobCostMs[(int32)EQualityKnob::AIUpdates] = Telemetry->GetScopeAverageMs(FFPSGameCounters::GetName(EFPSGameCounter::AIUpdate));
+    Input.KnobCostMs[(int32)EQualityKnob::EffectBudget] = Telemetry->GetScopeAverageMs(FFPSGameCounters::GetName(EFPSGameCounter::PoolAcquire))
+        + Telemetry->GetScopeAverageMs(FFPSGameCounters::GetName(EFPSGameCounter::PoolRelease));
+    Input.KnobCostMs[(int32)EQualityKnob::LODDistance] = Telemetry->GetScopeAverageMs(FFPSGameCounters::GetName(EFPSGameCounter::LOD));
+    Input.KnobCostMs[(int32)EQualityKnob::CullingDistance] = Telemetry->GetScopeAverageMs(FFPSGameCounters::GetName(EFPSGameCounter::Culling));
+    
+    // Thermal pressure caps quality rather than lowering the target
+    if (OptimizationSettings.bEnableThermalMonitoring)
+    {
+        Input.MaxLevel = 1.0f - 0.5f * CurrentMetrics.ThermalThrottlingRisk;
+    }
+    
+    QualityController.SetSettings(OptimizationSettings.AdaptiveQuality);
+    const FAdaptiveQualityDecision Decision = QualityController.Update(Input);
+    ApplyQualityLevels(Decision.bChanged);
+    LogQualityDecision(Input, Decision);
+    
+    if (Decision.bChanged)
+    {
+        OnOptimizationApplied.Broadcast(Decision.QualityLevel < 1.0f ? 1 : 3);
+    }
+}
+
+void APerformanceOptimizationSystem::ResetAdaptiveQuality()
+{
+    QualityController.SetSettings(OptimizationSettings.AdaptiveQuality);
+    QualityController.Reset();
+    QualityControllerTimer = 0.0f;
+    LastQualityUpdateTime = -1.0f;
+    ApplyQualityLevels(true);
+}
+
+void APerformanceOptimizationSystem::ReleaseQualityControl()
+{
+    // Knobs go back to their authored values and the effect components to their own adaptation
+    bQualityControlActive = false;
+    ResetAdaptiveQuality();
+    
+    for (int32 Index = EffectComponents.Num() - 1; Index >= 0; --Index)
+    {
+        if (UPooledWeaponEffectsComponent* Component = EffectComponents[Index].Get())
+        {
+            Component->ReleaseEffectQualityScale();
+        }
+        else
+        {
+            EffectComponents.RemoveAtSwap(Index);
+        }
+    }
+}
+
+void APerformanceOptimizationSystem::RegisterEffectComponent(UPooledWeaponEffectsComponent* Component)
+{
+    if (!IsValid(Component) || EffectComponents.Contains(Component))
+    {
+        return;
+    }
+    
+    EffectComponents.Add(Component);
+    if (bQualityControlActive)
+    {
+        Component->SetEffectQualityScale(QualityController.GetLevel(EQualityKnob::EffectBudget));
+    }
+}
+
+void APerformanceOptimizationSystem::UnregisterEffectComponent(UPooledWeaponEffectsComponent* Component)
+{
+    EffectComponents.RemoveSwap(Component);
+}
+
+void APerformanceOptimizationSystem::UpdateMaxCullingDistance()
+{
+    OptimizationSettings.MaxCullingDistance = BaseMaxCullingDistance * CullingDistanceScale * QualityController.GetLevel(EQualityKnob::CullingDistance);
+}
+
+void APerformanceOptimizationSystem::ApplyQualityLevels(bool bLevelsChanged)
+{
+    // The scheduler takes its budget from the first agent that registers, so scale from that once it exists
+    if (UAILODScheduler* Scheduler = UAILODScheduler::Get(this))
+    {
+        if (!bAIQualityBaseCaptured && Scheduler->GetRegisteredAgentCount() > 0)
+        {
+            BaseAIFrameBudgetMS = Scheduler->GetFrameBudgetMS();
+            BaseAIMaxUpdatesPerFrame = Scheduler->GetMaxUpdatesPerFrame();
+            bAIQualityBaseCaptured = true;
+            bLevelsChanged = true;
+        }
         
-        UE_LOG(LogTemp, Warning, TEXT("Applying predictive optimizations due to high frame drop risk: %.2f"), 
-               CurrentMetrics.PredictedFrameDropRisk);
+        if (bAIQualityBaseCaptured && bLevelsChanged)
+        {
+            const float AILevel = QualityController.GetLevel(EQualityKnob::AIUpdates);
+            Scheduler->SetFrameBudget(BaseAIFrameBudgetMS * AILevel, FMath::Max(1, FMath::RoundToInt(BaseAIMaxUpdatesPerFrame * AILevel)));
+        }
     }
-    else if (CurrentMetrics.PredictedFrameDropRisk > 0.4f)
+    
+    // Components registered since the last change were given the level on registration
+    if (bQualityControlActive && bLevelsChanged)
     {
-        // Medium risk - apply moderate optimizations
-        OptimizeLODSettings();
-        OptimizeCullingSettings();
+        const float EffectLevel = QualityController.GetLevel(EQualityKnob::EffectBudget);
+        for (int32 Index = EffectComponents.Num() - 1; Index >= 0; --Index)
+        {
+            if (UPooledWeaponEffectsComponent* Component = EffectComponents[Index].Get())
+            {
+                Component->SetEffectQualityScale(EffectLevel);
+            }
+            else
+            {
+                EffectComponents.RemoveAtSwap(Index);
+            }
+        }
     }
+    
+    // Cells test scaled distances against their bands, so a new scale is picked up without dirtying them
+    LODDistanceScale = FMath::Max(QualityController.GetLevel(EQualityKnob::LODDistance), KINDA_SMALL_NUMBER);
+    
+    UpdateMaxCullingDistance();
 }
 
-void APerformanceOptimizationSystem::ApplyThermalThrottling()
+void APerformanceOptimizationSystem::LogQualityDecision(const FAdaptiveQualityInput& Input, const FAdaptiveQualityDecision& Decision)
 {
-    UE_LOG(LogTemp, Warning, TEXT("Applying thermal throttling - CPU: %.1f°C, GPU: %.1f°C"), 
-           CurrentMetrics.CPUTemperature, CurrentMetrics.GPUTemperature);
+    if (Decision.bChanged)
+    {
+        UE_LOG(LogTemp, Log, TEXT("Adaptive quality - Frame: %.2fms (target %.2fms), Level: %.2f, AI: %.2f, Effects: %.2f, LOD: %.2f, Culling: %.2f%s"), 
+               Input.FrameTimeMs, Input.TargetFrameTimeMs, Decision.QualityLevel,
+               Decision.Levels[(int32)EQualityKnob::AIUpdates], Decision.Levels[(int32)EQualityKnob::EffectBudget],
+               Decision.Levels[(int32)EQualityKnob::LODDistance], Decision.Levels[(int32)EQualityKnob::CullingDistance],
+               Decision.bRenderBound ? TEXT(" (render bound)") : TEXT(""));
+    }
     
-    // Reduce performance to manage thermals
-    ApplyLowPerformanceOptimizations();
+    if (!OptimizationSettings.bLogQualityDecisions) return;
     
-    // Additional thermal-specific optimizations
-    OptimizationSettings.TargetFrameRate = FMath::Max(30.0f, OptimizationSettings.TargetFrameRate * 0.8f);
+    if (QualityLogPath.IsEmpty())
+    {
+        QualityLogPath = FPaths::ProjectSavedDir() / TEXT("Profiling") / FString::Printf(TEXT("AdaptiveQuality-%s.csv"), *FDateTime::Now().ToString());
+        QualityLogLines.Add(TEXT("Time,FrameTimeMs,TargetMs,GameThreadMs,Error,P,I,D,QualityLevel,AILevel,EffectLevel,LODLevel,CullingLevel,AICostMs,EffectCostMs,LODCostMs,CullingCostMs,MaxLevel,RenderBound,Changed"));
+    }
     
-    // Force more aggressive culling
-    OptimizationSettings.MaxCullingDistance *= 0.7f;
+    QualityLogLines.Add(FString::Printf(TEXT("%.3f,%.3f,%.3f,%.3f,%.4f,%.4f,%.4f,%.4f,%.3f,%.3f,%.3f,%.3f,%.3f,%.4f,%.4f,%.4f,%.4f,%.3f,%d,%d"),
+        GetWorld()->GetTimeSeconds(), Input.FrameTimeMs, Input.TargetFrameTimeMs, Input.GameThreadMs,
+        Decision.Error, Decision.Proportional, Decision.Integral, Decision.Derivative, Decision.QualityLevel,
+        Decision.Levels[(int32)EQualityKnob::AIUpdates], Decision.Levels[(int32)EQualityKnob::EffectBudget],
+        Decision.Levels[(int32)EQualityKnob::LODDistance], Decision.Levels[(int32)EQualityKnob::CullingDistance],
+        Input.KnobCostMs[(int32)EQualityKnob::AIUpdates], Input.KnobCostMs[(int32)EQualityKnob::EffectBudget],
+        Input.KnobCostMs[(int32)EQualityKnob::LODDistance], Input.KnobCostMs[(int32)EQualityKnob::CullingDistance],
+        Input.MaxLevel, Decision.bRenderBound ? 1 : 0, Decision.bChanged ? 1 : 0));
     
-    // Reduce pool sizes to lower memory pressure
-    OptimizePoolSizes();
+    if (QualityLogLines.Num() >= QualityLogFlushThreshold)
+    {
+        FlushQualityLog();
+    }
+}
+
+void APerformanceOptimizationSystem::FlushQualityLog()
+{
+    if (QualityLogLines.Num() == 0 || QualityLogPath.IsEmpty()) return;
+    
+    FString Contents = FString::Join(QualityLogLines, TEXT("\n"));
+    Contents += TEXT("\n");
+    FFileHelper::SaveStringToFile(Contents, *QualityLogPath, FFileHelper::EEncodingOptions::AutoDetect, &IFileManager::Get(), FILEWRITE_Append);
+    QualityLogLines.Reset();
 }
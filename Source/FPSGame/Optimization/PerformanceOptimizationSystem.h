@@ -8,8 +8,16 @@
 #include "HAL/ThreadSafeBool.h"
 #include "Async/Async.h"
 #include "Engine/Engine.h"
+#include "OptimizationTaskScheduler.h"
+#include "SoftwareOcclusionBuffer.h"
+#include "AdaptiveQualityController.h"
 #include "PerformanceOptimizationSystem.generated.h"
 
+class UAdvancedObjectPoolManager;
+class UPooledWeaponEffectsComponent;
+
+struct FConvexVolume;
+
 USTRUCT(BlueprintType)
 struct FLODSettings
 {
@@ -31,6 +39,21 @@ struct FLODSettings
     float CullDistance = 15000.0f;
 };
 
+// Stable reference to a LOD registration; stays valid while slots are reused for other actors
+USTRUCT(BlueprintType)
+struct FLODHandle
+{
+    GENERATED_BODY()
+
+    UPROPERTY()
+    int32 Index = INDEX_NONE;
+
+    UPROPERTY()
+    int32 Generation = 0;
+
+    bool IsValid() const { return Index != INDEX_NONE; }
+};
+
 USTRUCT(BlueprintType)
 struct FPerformanceMetrics
 {
@@ -42,6 +65,16 @@ struct FPerformanceMetrics
     UPROPERTY(BlueprintReadOnly)
     float FrameTime = 0.0f;
 
+    // From the frame telemetry window, in milliseconds
+    UPROPERTY(BlueprintReadOnly)
+    float FrameTimeP95Ms = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly)
+    float FrameTimeP99Ms = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly)
+    int32 HitchCount = 0;
+
     UPROPERTY(BlueprintReadOnly)
     float GPUTime = 0.0f;
 
@@ -60,6 +93,17 @@ struct FPerformanceMetrics
     UPROPERTY(BlueprintReadOnly)
     int32 VisibleActors = 0;
 
+    // Software occlusion, from the last culling pass
+    UPROPERTY(BlueprintReadOnly)
+    int32 OccludedActors = 0;
+
+    UPROPERTY(BlueprintReadOnly)
+    float OcclusionBuildTimeMs = 0.0f;
+
+    // Summed over all worker threads
+    UPROPERTY(BlueprintReadOnly)
+    float OcclusionTestTimeMs = 0.0f;
+
     // Thermal monitoring
     UPROPERTY(BlueprintReadOnly)
     float CPUTemperature = 0.0f;
@@ -82,28 +126,6 @@ struct FPerformanceMetrics
     float ThermalThrottlingRisk = 0.0f;
 };
 
-USTRUCT(BlueprintType)
-struct FPooledObject
-{
-    GENERATED_BODY()
-
-    UPROPERTY()
-    AActor* Actor = nullptr;
-
-    UPROPERTY()
-    bool bInUse = false;
-
-    UPROPERTY()
-    float LastUsedTime = 0.0f;
-
-    FPooledObject()
-    {
-        Actor = nullptr;
-        bInUse = false;
-        LastUsedTime = 0.0f;
-    }
-};
-
 USTRUCT(BlueprintType)
 struct FOptimizationSettings
 {
@@ -116,6 +138,17 @@ struct FOptimizationSettings
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LOD")
     FLODSettings DefaultLODSettings;
 
+    // Registered static actors are grouped into cells of this size for band checks
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LOD")
+    float LODCellSize = 2000.0f;
+
+    // Cells starting beyond this distance are only visited every LODFarCellStagger updates
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LOD")
+    float LODStaggerDistance = 10000.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "LOD")
+    int32 LODFarCellStagger = 4;
+
     // Culling
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Culling")
     bool bEnableFrustumCulling = true;
@@ -126,6 +159,32 @@ struct FOptimizationSettings
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Culling")
     float MaxCullingDistance = 20000.0f;
 
+    // Registered actors are only re-evaluated when they move to another cell of this size
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Culling")
+    float CullingCellSize = 500.0f;
+
+    // Register spawned actors with a visible primitive automatically
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Culling")
+    bool bAutoRegisterCullingActors = true;
+
+    // Occlusion can change without anything we track moving, so everything is re-evaluated this often
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Culling")
+    float CullingFullRefreshInterval = 1.0f;
+
+    // Actors with this tag are registered as occluders when they spawn
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Culling")
+    FName OccluderTag = TEXT("Occluder");
+
+    // Occluder mesh bounds are shrunk by this factor so rounded or tapered meshes do not over-occlude
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Culling")
+    float OccluderBoundsScale = 0.9f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Culling")
+    int32 OcclusionBufferWidth = 256;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Culling")
+    int32 OcclusionBufferHeight = 128;
+
     // Object Pooling
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pooling")
     bool bEnableObjectPooling = true;
@@ -180,6 +239,21 @@ struct FOptimizationSettings
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Predictive")
     float PredictionHorizonSeconds = 5.0f;
 
+    // Adaptive quality runs on the frame telemetry at this interval
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Predictive")
+    float QualityControllerInterval = 0.25f;
+
+    // Recent frames averaged into each controller update
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Predictive")
+    int32 QualityControllerFrameWindow = 15;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Predictive")
+    FAdaptiveQualitySettings AdaptiveQuality;
+
+    // Writes every controller update to Saved/Profiling as CSV
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Predictive")
+    bool bLogQualityDecisions = false;
+
     // GPU profiling
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "GPU")
     bool bEnableGPUProfiling = true;
@@ -214,12 +288,19 @@ public:
     UFUNCTION(BlueprintCallable, Category = "LOD")
     void UpdateLODSystem();
 
+    // Registering an actor again updates its settings and returns the existing handle
     UFUNCTION(BlueprintCallable, Category = "LOD")
-    void RegisterActorForLOD(AActor* Actor, const FLODSettings& LODSettings);
+    FLODHandle RegisterActorForLOD(AActor* Actor, const FLODSettings& LODSettings);
 
     UFUNCTION(BlueprintCallable, Category = "LOD")
     void UnregisterActorFromLOD(AActor* Actor);
 
+    UFUNCTION(BlueprintCallable, Category = "LOD")
+    void UnregisterLODHandle(FLODHandle Handle);
+
+    UFUNCTION(BlueprintCallable, Category = "LOD")
+    int32 GetLODEvaluationsLastUpdate() const { return LODEvaluationsLastUpdate; }
+
     UFUNCTION(BlueprintCallable, Category = "LOD")
     int32 CalculateLODLevel(AActor* Actor, const FLODSettings& LODSettings);
 
@@ -240,6 +321,28 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Culling")
     void UpdateCullingSystem();
 
+    UFUNCTION(BlueprintCallable, Category = "Culling")
+    void RegisterActorForCulling(AActor* Actor);
+
+    UFUNCTION(BlueprintCallable, Category = "Culling")
+    void UnregisterActorFromCulling(AActor* Actor);
+
+    UFUNCTION(BlueprintCallable, Category = "Culling")
+    int32 GetCullingActorCount() const { return CullingActors.Num(); }
+
+    UFUNCTION(BlueprintCallable, Category = "Culling")
+    int32 GetCulledActorCount() const { return NumCulledActors; }
+
+    // Occluders should be large, solid and roughly box-shaped: walls, buildings, terrain blockers
+    UFUNCTION(BlueprintCallable, Category = "Culling")
+    void RegisterOccluder(AActor* Actor);
+
+    UFUNCTION(BlueprintCallable, Category = "Culling")
+    void UnregisterOccluder(AActor* Actor);
+
+    UFUNCTION(BlueprintCallable, Category = "Culling")
+    int32 GetOccluderCount() const { return Occluders.Num(); }
+
     UFUNCTION(BlueprintCallable, Category = "Culling")
     bool IsActorInViewFrustum(AActor* Actor);
 
@@ -273,8 +376,11 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Threading")
     void ProcessAsyncTasks();
 
+    // Never blocks; returns false if the task was dropped or coalesced into a queued one
+    bool AddAsyncTask(TFunction<void()> Task, EOptimizationTaskPriority Priority = EOptimizationTaskPriority::Normal, uint64 CoalesceKey = 0, TFunction<void()> OnComplete = nullptr);
+
     UFUNCTION(BlueprintCallable, Category = "Threading")
-    void AddAsyncTask(TFunction<void()> Task);
+    FAsyncTaskSchedulerStats GetAsyncTaskStats() const;
 
     // Thermal monitoring
     UFUNCTION(BlueprintCallable, Category = "Thermal")
@@ -306,9 +412,21 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Predictive")
     float PredictFrameDropRisk() const;
 
+    // Runs one adaptive quality update toward TargetFrameRate
     UFUNCTION(BlueprintCallable, Category = "Predictive")
     void ApplyPredictiveOptimizations();
 
+    // Returns every quality knob to its authored value
+    UFUNCTION(BlueprintCallable, Category = "Predictive")
+    void ResetAdaptiveQuality();
+
+    UFUNCTION(BlueprintCallable, Category = "Predictive")
+    float GetLODDistanceScale() const { return LODDistanceScale; }
+
+    // Effect components whose limits follow the effect budget knob while adaptive quality is enabled
+    void RegisterEffectComponent(UPooledWeaponEffectsComponent* Component);
+    void UnregisterEffectComponent(UPooledWeaponEffectsComponent* Component);
+
     // Utility Functions
     UFUNCTION(BlueprintCallable, Category = "Optimization")
     void SetOptimizationLevel(int32 Level);
@@ -332,18 +450,82 @@ public:
     FOnOptimizationApplied OnOptimizationApplied;
 
 private:
-    // Internal data structures
-    UPROPERTY()
-    TMap<AActor*, FLODSettings> RegisteredLODActors;
+    // LOD registrations live in a flat slot array; freed slots are reused and bump their generation
+    struct FLODEntry
+    {
+        TWeakObjectPtr<AActor> Actor;
+        FLODSettings Settings;
+        FIntVector Cell = FIntVector::ZeroValue;
+        int32 Generation = 0;
+        int32 LODLevel = 0;
+        bool bLODKnown = false;
+        bool bMovable = false;
+        bool bInUse = false;
+    };
+
+    // Static actors in one grid cell. The band limits bound where every member's current LOD still holds,
+    // so a cell that lies entirely inside them can be skipped without touching its members
+    struct FLODCell
+    {
+        TArray<int32> Slots;
+        float MaxBandLow = 0.0f;
+        float MinBandHigh = 0.0f;
+        bool bNeedsEvaluation = true;
+    };
 
-    UPROPERTY()
-    TMap<UClass*, TArray<FPooledObject>> ObjectPools;
+    TArray<FLODEntry> LODEntries;
+    TArray<int32> FreeLODSlots;
+    TMap<TWeakObjectPtr<AActor>, int32> LODSlotByActor;
+    TMap<FIntVector, FLODCell> LODCells;
 
-    UPROPERTY()
-    TArray<AActor*> CulledActors;
+    // Movable actors can leave their cell unnoticed, so they are checked every update
+    TArray<int32> MovableLODSlots;
+
+    uint32 LODUpdateCount = 0;
+    int32 LODEvaluationsLastUpdate = 0;
+
+    // View distances are divided by this before picking a LOD, so the authored bands stay untouched
+    float LODDistanceScale = 1.0f;
 
+    // Internal data structures
+
+    // Pooled actors live in the game instance's shared pool manager, under one memory budget and one set of statistics
     UPROPERTY()
-    TArray<AActor*> VisibleActors;
+    UAdvancedObjectPoolManager* PoolManager = nullptr;
+
+    // Culling set; dense arrays indexed together, removal swaps the last entry in
+    TArray<TWeakObjectPtr<AActor>> CullingActors;
+    TArray<FIntVector> CullingCells;
+    TMap<TWeakObjectPtr<AActor>, int32> CullingIndices;
+    TBitArray<> CulledBits;
+    TBitArray<> CullingDirtyBits;
+    int32 NumCulledActors = 0;
+
+    // Inputs of the last culling pass; a change re-evaluates the whole set
+    FVector LastCullingViewLocation = FVector::ZeroVector;
+    FRotator LastCullingViewRotation = FRotator::ZeroRotator;
+    uint32 LastCullingSettingsHash = 0;
+    float LastCullingFullRefreshTime = -1.0f;
+
+    // Flat per-actor input to the culling job, filled on the game thread so workers never touch UObjects
+    struct FCullingJobItem
+    {
+        FVector Location;
+        FVector BoundsOrigin;
+        FVector BoundsExtent;
+        float BoundsRadius;
+        int32 Index;
+        bool bCull;
+        bool bOccluded;
+    };
+    TArray<FCullingJobItem> CullingJobItems;
+
+    FSoftwareOcclusionBuffer OcclusionBuffer;
+    TArray<TWeakObjectPtr<AActor>> Occluders;
+    static const int32 CullingJobChunkSize = 64;
+
+    FDelegateHandle ActorSpawnedHandle;
+    FDelegateHandle ActorDestroyedHandle;
 
     // Timers
     float LODUpdateTimer = 0.0f;
@@ -353,13 +535,8 @@ private:
     float PoolCleanupTimer = 0.0f;
 
     // Threading
-    TArray<TFuture<void>> AsyncTasks;
-    FCriticalSection TaskCriticalSection;
-
-    // Performance tracking
-    TArray<float> FrameTimeHistory;
-    int32 FrameTimeHistoryIndex = 0;
-    static const int32 FrameTimeHistorySize = 60;
+    TUniquePtr<FOptimizationTaskScheduler> TaskScheduler;
+    static const int32 AsyncTaskQueueCapacity = 256;
 
     // Thermal tracking
     TArray<float> CPUTemperatureHistory;
@@ -370,26 +547,73 @@ private:
     // GPU profiling
     TArray<float> GPUUsageHistory;
     TArray<float> GPUMemoryHistory;
+    int32 GPUHistoryIndex = 0;
+    static const int32 GPUHistorySize = 60;
+
+    // Frame telemetry windows; the buffer holds more history than any of these read
+    static const int32 FrameTimeAverageWindow = 60;
+    static const int32 FrameDropRecentWindow = 10;
+    static const int32 FrameDropBaselineWindow = 20;
 
     // Predictive data
     TArray<float> FrameDropPredictions;
     float LastPredictionTime = 0.0f;
 
+    // Adaptive quality; knob levels scale these authored values
+    FAdaptiveQualityController QualityController;
+    float QualityControllerTimer = 0.0f;
+    float LastQualityUpdateTime = -1.0f;
+    float BaseMaxCullingDistance = 0.0f;
+    float BaseAIFrameBudgetMS = 0.0f;
+    int32 BaseAIMaxUpdatesPerFrame = 0;
+    bool bAIQualityBaseCaptured = false;
+    // Manual culling adjustments (OptimizeCullingSettings), composed with the controller's culling level
+    float CullingDistanceScale = 1.0f;
+    // Set while the controller owns the knobs; cleared when bEnablePredictiveOptimization is turned off
+    bool bQualityControlActive = false;
+    TArray<TWeakObjectPtr<UPooledWeaponEffectsComponent>> EffectComponents;
+
+    // Decision log rows waiting to be appended to QualityLogPath
+    TArray<FString> QualityLogLines;
+    FString QualityLogPath;
+    static const int32 QualityLogFlushThreshold = 64;
+
     // Internal functions
     void InitializeSystem();
-    void UpdateLODForActor(AActor* Actor, const FLODSettings& LODSettings);
+    static int32 GetLODLevelForDistance(float Distance, const FLODSettings& LODSettings);
+    static void GetLODBand(int32 LODLevel, const FLODSettings& LODSettings, float& OutLow, float& OutHigh);
+    bool EvaluateLODEntry(int32 Slot, const FVector& ViewLocation, float& InOutMaxBandLow, float& InOutMinBandHigh);
+    void ApplyLODLevel(AActor* Actor, int32 LODLevel);
+    FIntVector ToLODCell(const FVector& Location) const;
+    void AddToLODCell(int32 Slot, const FIntVector& Cell);
+    void RemoveFromLODCell(int32 Slot);
+    void FreeLODSlot(int32 Slot);
+    void MarkLODBandsDirty();
     void SetActorLODLevel(AActor* Actor, int32 LODLevel);
     void CullActor(AActor* Actor);
     void UncullActor(AActor* Actor);
+    bool ShouldAutoRegisterForCulling(const AActor* Actor) const;
+    bool BuildCullingViewProjection(APlayerController* PC, FMatrix& OutViewProjection) const;
+    void BuildOcclusionBuffer(const FMatrix& ViewProjection);
+    void RunCullingJob(const FConvexVolume& Frustum, const FVector& DistanceOrigin, bool bTestOcclusion);
+    bool HaveCullingInputsChanged();
+    FIntVector ToCullingCell(const FVector& Location) const;
+    void RemoveCullingEntry(int32 Index);
+    void OnActorSpawned(AActor* Actor);
+    void OnActorDestroyed(AActor* Actor);
     float CalculateDistanceToPlayer(AActor* Actor);
     APlayerController* GetPlayerController();
     void CollectGarbageIfNeeded();
     void OptimizeLODSettings();
     void OptimizeCullingSettings();
     void OptimizePoolSizes();
-    void ProcessFrameTimeHistory(float DeltaTime);
     float GetAverageFrameTime() const;
     void ApplyLowPerformanceOptimizations();
     void ApplyHighPerformanceOptimizations();
+    void ApplyQualityLevels(bool bLevelsChanged);
+    void ReleaseQualityControl();
+    void UpdateMaxCullingDistance();
+    void LogQualityDecision(const FAdaptiveQualityInput& Input, const FAdaptiveQualityDecision& Decision);
+    void FlushQualityLog();
     void LogPerformanceMetrics() const;
 };
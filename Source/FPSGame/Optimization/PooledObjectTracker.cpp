@@ -0,0 +1,422 @@
+#include "PooledObjectTracker.h"
+#include "AdvancedObjectPoolManager.h"
+#include "Engine/World.h"
+#include "Engine/Engine.h"
+#include "Engine/GameInstance.h"
+#include "GameFramework/Actor.h"
+#include "Particles/ParticleSystemComponent.h"
+#include "Components/AudioComponent.h"
+#include "Components/DecalComponent.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogPooledObjectTracker, Log, All);
+
+namespace
+{
+    const TCHAR* GetKindName(EPooledObjectKind Kind)
+    {
+        switch (Kind)
+        {
+            case EPooledObjectKind::Projectile: return TEXT("Projectiles");
+            case EPooledObjectKind::Effect:     return TEXT("Effects");
+            case EPooledObjectKind::Audio:      return TEXT("Audio");
+            case EPooledObjectKind::Decal:      return TEXT("Decals");
+            default:                            return TEXT("Unknown");
+        }
+    }
+}
+
+int32 FPooledObjectBudget::GetMax(EPooledObjectKind Kind) const
+{
+    switch (Kind)
+    {
+        case EPooledObjectKind::Projectile: return MaxProjectiles;
+        case EPooledObjectKind::Effect:     return MaxEffects;
+        case EPooledObjectKind::Audio:      return MaxAudio;
+        case EPooledObjectKind::Decal:      return MaxDecals;
+        default:                            return 0;
+    }
+}
+
+// FPooledObjectTracker
+
+FPooledObjectTracker::FPooledObjectTracker()
+{
+    for (int32& Count : KindCounts)
+    {
+        Count = 0;
+    }
+}
+
+int32 FPooledObjectTracker::RegisterOwner()
+{
+    const int32 Owner = NextOwner++;
+    FKindCounts& Counts = OwnerCounts.Add(Owner);
+    for (int32& Count : Counts)
+    {
+        Count = 0;
+    }
+    return Owner;
+}
+
+void FPooledObjectTracker::UnregisterOwner(int32 Owner)
+{
+    if (!OwnerCounts.Contains(Owner))
+    {
+        return;
+    }
+
+    // Projectiles in flight return themselves; anything else is still playing and is left for the sweep
+    for (int32 Index = Objects.Num() - 1; Index >= 0; --Index)
+    {
+        if (Objects[Index].Owner != Owner)
+        {
+            continue;
+        }
+
+        if (Objects[Index].Kind == EPooledObjectKind::Projectile)
+        {
+            RemoveAt(Index);
+        }
+        else
+        {
+            Objects[Index].Owner = INDEX_NONE;
+        }
+    }
+    OwnerCounts.Remove(Owner);
+}
+
+bool FPooledObjectTracker::HasBudget(EPooledObjectKind Kind) const
+{
+    return GetNum(Kind) < Budget.GetMax(Kind);
+}
+
+FSlotHandle FPooledObjectTracker::Track(UObject* Object, EPooledObjectKind Kind, int32 Owner, bool bComponentPool)
+{
+    FKindCounts* Counts = OwnerCounts.Find(Owner);
+    if (!Object || !Counts || Kind >= EPooledObjectKind::Count)
+    {
+        return FSlotHandle();
+    }
+
+    if (const FSlotHandle* Existing = ObjectHandles.Find(Object))
+    {
+        return *Existing;
+    }
+
+    const FSlotHandle Handle = Slots.Add();
+    FTrackedPooledObject& Entry = Objects.AddDefaulted_GetRef();
+    Entry.Object = Object;
+    Entry.Kind = Kind;
+    Entry.Owner = Owner;
+    Entry.bComponentPool = bComponentPool;
+    References.Add(Object);
+    ObjectKeys.Add(Object);
+    ObjectHandles.Add(Object, Handle);
+
+    KindCounts[(int32)Kind]++;
+    (*Counts)[(int32)Kind]++;
+    return Handle;
+}
+
+bool FPooledObjectTracker::Untrack(const UObject* Object)
+{
+    const FSlotHandle* Handle = ObjectHandles.Find(Object);
+    if (!Handle)
+    {
+        return false;
+    }
+
+    RemoveAt(Slots.GetDenseIndex(*Handle));
+    return true;
+}
+
+const FTrackedPooledObject* FPooledObjectTracker::Find(const UObject* Object) const
+{
+    const FSlotHandle* Handle = ObjectHandles.Find(Object);
+    return Handle ? &Objects[Slots.GetDenseIndex(*Handle)] : nullptr;
+}
+
+int32 FPooledObjectTracker::GetOwnerNum(int32 Owner, EPooledObjectKind Kind) const
+{
+    const FKindCounts* Counts = OwnerCounts.Find(Owner);
+    return Counts ? (*Counts)[(int32)Kind] : 0;
+}
+
+int32 FPooledObjectTracker::Sweep(int32 MaxVisits, TFunctionRef<bool(const FTrackedPooledObject&)> IsFinished, TArray<FTrackedPooledObject>& OutFinished)
+{
+    if (SweepCursor < 0 || SweepCursor >= Objects.Num())
+    {
+        SweepCursor = Objects.Num() - 1;
+    }
+
+    int32 Visited = 0;
+    while (Visited < MaxVisits && SweepCursor >= 0)
+    {
+        const FTrackedPooledObject& Entry = Objects[SweepCursor];
+        if (!Entry.Object.IsValid())
+        {
+            RemoveAt(SweepCursor);
+        }
+        else if (IsFinished(Entry))
+        {
+            OutFinished.Add(Entry);
+            RemoveAt(SweepCursor);
+        }
+        SweepCursor--;
+        Visited++;
+    }
+    return Visited;
+}
+
+void FPooledObjectTracker::Reset()
+{
+    Slots.Reset();
+    Objects.Reset();
+    References.Reset();
+    ObjectKeys.Reset();
+    ObjectHandles.Reset();
+    for (int32& Count : KindCounts)
+    {
+        Count = 0;
+    }
+    for (TPair<int32, FKindCounts>& Pair : OwnerCounts)
+    {
+        for (int32& Count : Pair.Value)
+        {
+            Count = 0;
+        }
+    }
+    SweepCursor = INDEX_NONE;
+}
+
+void FPooledObjectTracker::AddReferencedObjects(FReferenceCollector& Collector, const UObject* ReferencingObject)
+{
+    for (TObjectPtr<UObject>& Reference : References)
+    {
+        Collector.AddReferencedObject(Reference, ReferencingObject);
+    }
+}
+
+void FPooledObjectTracker::RemoveAt(int32 DenseIndex)
+{
+    if (!Objects.IsValidIndex(DenseIndex))
+    {
+        return;
+    }
+
+    const FTrackedPooledObject& Entry = Objects[DenseIndex];
+    KindCounts[(int32)Entry.Kind]--;
+    if (FKindCounts* Counts = OwnerCounts.Find(Entry.Owner))
+    {
+        (*Counts)[(int32)Entry.Kind]--;
+    }
+
+    ObjectHandles.Remove(ObjectKeys[DenseIndex]);
+    Slots.Remove(Slots.GetHandle(DenseIndex));
+    Objects.RemoveAtSwap(DenseIndex, 1, false);
+    References.RemoveAtSwap(DenseIndex, 1, false);
+    ObjectKeys.RemoveAtSwap(DenseIndex, 1, false);
+}
+
+// UPooledObjectTrackerSubsystem
+
+void UPooledObjectTrackerSubsystem::Deinitialize()
+{
+    // Pools are torn down with the game instance; nothing is released on the way out
+    Tracker.Reset();
+    Finished.Reset();
+
+    Super::Deinitialize();
+}
+
+bool UPooledObjectTrackerSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UPooledObjectTrackerSubsystem::Tick(float DeltaTime)
+{
+    if (Tracker.Num() == 0)
+    {
+        return;
+    }
+
+    Finished.Reset();
+    Tracker.Sweep(FMath::Max(1, SweepBatchSize), &UPooledObjectTrackerSubsystem::IsFinished, Finished);
+
+    for (const FTrackedPooledObject& Entry : Finished)
+    {
+        if (ReleaseTracked(Entry))
+        {
+            TotalSwept++;
+        }
+    }
+}
+
+TStatId UPooledObjectTrackerSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UPooledObjectTrackerSubsystem, STATGROUP_Tickables);
+}
+
+UPooledObjectTrackerSubsystem* UPooledObjectTrackerSubsystem::Get(const UObject* WorldContextObject)
+{
+    UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
+    return World ? World->GetSubsystem<UPooledObjectTrackerSubsystem>() : nullptr;
+}
+
+void UPooledObjectTrackerSubsystem::AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector)
+{
+    CastChecked<UPooledObjectTrackerSubsystem>(InThis)->Tracker.AddReferencedObjects(Collector, InThis);
+    Super::AddReferencedObjects(InThis, Collector);
+}
+
+FSlotHandle UPooledObjectTrackerSubsystem::Track(UObject* Object, EPooledObjectKind Kind, int32 Owner, bool bComponentPool)
+{
+    const FSlotHandle Handle = Tracker.Track(Object, Kind, Owner, bComponentPool);
+    if (!Handle.IsValid() && Object)
+    {
+        UE_LOG(LogPooledObjectTracker, Warning, TEXT("Could not track %s for unknown owner %d"), *Object->GetName(), Owner);
+    }
+    return Handle;
+}
+
+void UPooledObjectTrackerSubsystem::Release(UObject* Object, EPooledObjectKind Kind, bool bComponentPool)
+{
+    if (!IsValid(Object))
+    {
+        Tracker.Untrack(Object);
+        return;
+    }
+
+    FTrackedPooledObject Entry;
+    if (const FTrackedPooledObject* Tracked = Tracker.Find(Object))
+    {
+        Entry = *Tracked;
+        Tracker.Untrack(Object);
+    }
+    else
+    {
+        Entry.Object = Object;
+        Entry.Kind = Kind;
+        Entry.bComponentPool = bComponentPool;
+    }
+
+    ReleaseTracked(Entry);
+}
+
+FString UPooledObjectTrackerSubsystem::GeneratePooledObjectReport() const
+{
+    FString Report = TEXT("=== POOLED OBJECT REPORT ===\n");
+    Report += FString::Printf(TEXT("Owners: %d\n"), Tracker.GetNumOwners());
+    Report += FString::Printf(TEXT("Tracked: %d\n"), Tracker.Num());
+
+    for (int32 KindIndex = 0; KindIndex < (int32)EPooledObjectKind::Count; ++KindIndex)
+    {
+        const EPooledObjectKind Kind = (EPooledObjectKind)KindIndex;
+        Report += FString::Printf(TEXT("  %s: %d/%d\n"), GetKindName(Kind), Tracker.GetNum(Kind), Tracker.GetBudget().GetMax(Kind));
+    }
+
+    Report += FString::Printf(TEXT("Released by sweep: %d\n"), TotalSwept);
+    return Report;
+}
+
+UAdvancedObjectPoolManager* UPooledObjectTrackerSubsystem::GetPoolManager() const
+{
+    UWorld* World = GetWorld();
+    UGameInstance* GameInstance = World ? World->GetGameInstance() : nullptr;
+    return GameInstance ? GameInstance->GetSubsystem<UAdvancedObjectPoolManager>() : nullptr;
+}
+
+bool UPooledObjectTrackerSubsystem::ReleaseTracked(const FTrackedPooledObject& Entry)
+{
+    UObject* Object = Entry.Object.Get();
+    UAdvancedObjectPoolManager* PoolManager = GetPoolManager();
+    if (!Object || !PoolManager)
+    {
+        return false;
+    }
+
+    switch (Entry.Kind)
+    {
+        case EPooledObjectKind::Projectile:
+            if (AActor* Projectile = Cast<AActor>(Object))
+            {
+                if (Projectile->IsActorBeingDestroyed())
+                {
+                    return false;
+                }
+                Projectile->SetActorHiddenInGame(true);
+                Projectile->SetActorEnableCollision(false);
+            }
+            break;
+        case EPooledObjectKind::Effect:
+            if (UParticleSystemComponent* ParticleComp = Cast<UParticleSystemComponent>(Object))
+            {
+                ParticleComp->Deactivate();
+                ParticleComp->SetTemplate(nullptr);
+            }
+            break;
+        case EPooledObjectKind::Audio:
+            if (UAudioComponent* Audio = Cast<UAudioComponent>(Object))
+            {
+                Audio->Stop();
+                Audio->SetSound(nullptr);
+            }
+            break;
+        case EPooledObjectKind::Decal:
+            if (UDecalComponent* DecalComp = Cast<UDecalComponent>(Object))
+            {
+                DecalComp->SetDecalMaterial(nullptr);
+                DecalComp->SetVisibility(false);
+            }
+            break;
+        default:
+            break;
+    }
+
+    if (AActor* Actor = Cast<AActor>(Object))
+    {
+        PoolManager->ReleaseActor(Actor);
+    }
+    else if (Entry.bComponentPool)
+    {
+        PoolManager->ReleaseComponent(CastChecked<UActorComponent>(Object));
+    }
+    else
+    {
+        PoolManager->ReleaseObject(Object);
+    }
+    return true;
+}
+
+bool UPooledObjectTrackerSubsystem::IsFinished(const FTrackedPooledObject& Entry)
+{
+    const UObject* Object = Entry.Object.Get();
+
+    switch (Entry.Kind)
+    {
+        case EPooledObjectKind::Projectile:
+        {
+            // Projectiles are returned by whoever fired them; the sweep only forgets destroyed ones
+            const AActor* Projectile = Cast<AActor>(Object);
+            return Projectile && Projectile->IsActorBeingDestroyed();
+        }
+        case EPooledObjectKind::Effect:
+        {
+            const UParticleSystemComponent* ParticleComp = Cast<UParticleSystemComponent>(Object);
+            return ParticleComp && !ParticleComp->IsActive();
+        }
+        case EPooledObjectKind::Audio:
+        {
+            const UAudioComponent* Audio = Cast<UAudioComponent>(Object);
+            return Audio && !Audio->IsPlaying();
+        }
+        case EPooledObjectKind::Decal:
+        {
+            const UDecalComponent* DecalComp = Cast<UDecalComponent>(Object);
+            return DecalComp && !DecalComp->IsVisible();
+        }
+        default:
+            return false;
+    }
+}
@@ -0,0 +1,188 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "SlotMap.h"
+#include "PooledObjectTracker.generated.h"
+
+class UAdvancedObjectPoolManager;
+
+UENUM(BlueprintType)
+enum class EPooledObjectKind : uint8
+{
+    Projectile  UMETA(DisplayName = "Projectile"),
+    Effect      UMETA(DisplayName = "Effect"),
+    Audio       UMETA(DisplayName = "Audio"),
+    Decal       UMETA(DisplayName = "Decal"),
+    Count       UMETA(Hidden)
+};
+
+// World-wide caps on pooled objects in use, shared by every weapon and AI
+USTRUCT(BlueprintType)
+struct FPooledObjectBudget
+{
+    GENERATED_BODY()
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pooled Objects")
+    int32 MaxProjectiles = 256;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pooled Objects")
+    int32 MaxEffects = 128;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pooled Objects")
+    int32 MaxAudio = 48;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pooled Objects")
+    int32 MaxDecals = 200;
+
+    int32 GetMax(EPooledObjectKind Kind) const;
+};
+
+struct FTrackedPooledObject
+{
+    TWeakObjectPtr<UObject> Object;
+    EPooledObjectKind Kind = EPooledObjectKind::Effect;
+    int32 Owner = INDEX_NONE;
+
+    // Acquired with AcquireComponent rather than AcquireObject, so it goes back through ReleaseComponent
+    bool bComponentPool = false;
+};
+
+/**
+ * Every pooled object in use in a world, in one dense array.
+ * Owners register once and only keep the id; counts per kind and per owner are kept alongside so
+ * budget checks and reports never walk the array. Sweep visits a bounded slice per call, resuming where it stopped.
+ */
+class FPSGAME_API FPooledObjectTracker
+{
+public:
+    FPooledObjectTracker();
+
+    void SetBudget(const FPooledObjectBudget& InBudget) { Budget = InBudget; }
+    const FPooledObjectBudget& GetBudget() const { return Budget; }
+
+    int32 RegisterOwner();
+
+    // Stops tracking the owner's projectiles; its other objects stay tracked without an owner until swept
+    void UnregisterOwner(int32 Owner);
+
+    bool HasBudget(EPooledObjectKind Kind) const;
+
+    // Objects already tracked keep their handle; invalid handle for a null object or an unknown owner
+    FSlotHandle Track(UObject* Object, EPooledObjectKind Kind, int32 Owner, bool bComponentPool = false);
+
+    // Returns false when the object was not tracked
+    bool Untrack(const UObject* Object);
+
+    bool IsTracked(const UObject* Object) const { return ObjectHandles.Contains(Object); }
+    const FTrackedPooledObject* Find(const UObject* Object) const;
+
+    int32 Num() const { return Objects.Num(); }
+    int32 GetNum(EPooledObjectKind Kind) const { return KindCounts[(int32)Kind]; }
+    int32 GetOwnerNum(int32 Owner, EPooledObjectKind Kind) const;
+    int32 GetNumOwners() const { return OwnerCounts.Num(); }
+
+    /**
+     * Checks up to MaxVisits objects. Those IsFinished accepts are untracked and appended to OutFinished;
+     * objects that are gone are untracked without being reported. Returns the number visited.
+     */
+    int32 Sweep(int32 MaxVisits, TFunctionRef<bool(const FTrackedPooledObject&)> IsFinished, TArray<FTrackedPooledObject>& OutFinished);
+
+    void Reset();
+
+    // Keeps objects in use alive; pools only hold weak references to what they hand out
+    void AddReferencedObjects(FReferenceCollector& Collector, const UObject* ReferencingObject);
+
+private:
+    using FKindCounts = TStaticArray<int32, (int32)EPooledObjectKind::Count>;
+
+    FPooledObjectBudget Budget;
+    FSlotMap Slots;
+    TArray<FTrackedPooledObject> Objects;
+
+    // Parallel to Objects; nulled by GC when an object is destroyed outright
+    TArray<TObjectPtr<UObject>> References;
+
+    // Parallel to Objects; the map key stays known after the object itself is gone
+    TArray<const UObject*> ObjectKeys;
+    TMap<const UObject*, FSlotHandle> ObjectHandles;
+    FKindCounts KindCounts;
+    TMap<int32, FKindCounts> OwnerCounts;
+    int32 NextOwner = 0;
+
+    // Walks down the dense array so swap-removes only move entries already visited this pass
+    int32 SweepCursor = INDEX_NONE;
+
+    void RemoveAt(int32 DenseIndex);
+};
+
+/**
+ * World subsystem owning the pooled-object tracking of every weapon and AI pooling integration.
+ * One budgeted sweep per tick returns finished effects, audio and decals to the pool manager,
+ * instead of each component sweeping its own arrays.
+ */
+UCLASS()
+class FPSGAME_API UPooledObjectTrackerSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // USubsystem interface
+    virtual void Deinitialize() override;
+
+    // FTickableGameObject interface
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    static void AddReferencedObjects(UObject* InThis, FReferenceCollector& Collector);
+
+    static UPooledObjectTrackerSubsystem* Get(const UObject* WorldContextObject);
+
+    int32 RegisterOwner() { return Tracker.RegisterOwner(); }
+
+    // In-flight projectiles are left alone; effects, audio and decals still in use are released by the sweep when they finish
+    void UnregisterOwner(int32 Owner) { Tracker.UnregisterOwner(Owner); }
+
+    // Owners check this before acquiring from a pool
+    UFUNCTION(BlueprintCallable, Category = "Pooled Objects")
+    bool HasBudget(EPooledObjectKind Kind) const { return Tracker.HasBudget(Kind); }
+
+    FSlotHandle Track(UObject* Object, EPooledObjectKind Kind, int32 Owner, bool bComponentPool = false);
+
+    // Resets the object and returns it to its pool; how it was tracked wins over the arguments
+    UFUNCTION(BlueprintCallable, Category = "Pooled Objects")
+    void Release(UObject* Object, EPooledObjectKind Kind, bool bComponentPool = false);
+
+    // Stops tracking without releasing, for objects that were destroyed rather than finished
+    UFUNCTION(BlueprintCallable, Category = "Pooled Objects")
+    void Untrack(UObject* Object) { Tracker.Untrack(Object); }
+
+    UFUNCTION(BlueprintCallable, Category = "Pooled Objects")
+    int32 GetActiveCount(EPooledObjectKind Kind) const { return Tracker.GetNum(Kind); }
+
+    int32 GetOwnerActiveCount(int32 Owner, EPooledObjectKind Kind) const { return Tracker.GetOwnerNum(Owner, Kind); }
+
+    UFUNCTION(BlueprintCallable, Category = "Pooled Objects")
+    void SetBudget(const FPooledObjectBudget& InBudget) { Tracker.SetBudget(InBudget); }
+
+    UFUNCTION(BlueprintCallable, Category = "Pooled Objects")
+    FString GeneratePooledObjectReport() const;
+
+    // Objects checked per tick; a full pass over N objects takes N / SweepBatchSize ticks
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pooled Objects")
+    int32 SweepBatchSize = 64;
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    FPooledObjectTracker Tracker;
+    TArray<FTrackedPooledObject> Finished;
+    int32 TotalSwept = 0;
+
+    UAdvancedObjectPoolManager* GetPoolManager() const;
+
+    // Returns false when the object could not go back to its pool
+    bool ReleaseTracked(const FTrackedPooledObject& Entry);
+    static bool IsFinished(const FTrackedPooledObject& Entry);
+};
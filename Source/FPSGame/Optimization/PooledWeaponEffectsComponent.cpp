@@ -11,9 +11,21 @@
 #include "Camera/PlayerCameraManager.h"
 #include "TimerManager.h"
 #include "DrawDebugHelpers.h"
+#include "FrameBudgetSubsystem.h"
+#include "MemoryPressureSubsystem.h"
+#include "BulletHoleSubsystem.h"
+#include "TracerRenderSubsystem.h"
+#include "PerformanceOptimizationSystem.h"
+#include "EngineUtils.h"
+#include "FPSGameStats.h"
+#include "Particles/ParticleSystem.h"
+#include "Materials/MaterialInterface.h"
 
 DEFINE_LOG_CATEGORY_STATIC(LogPooledWeaponEffects, Log, All);
 
+DECLARE_DWORD_COUNTER_STAT(TEXT("Effect Requests Coalesced"), STAT_FPSGame_EffectRequestsCoalesced, STATGROUP_FPSGame);
+DECLARE_DWORD_COUNTER_STAT(TEXT("Effect Requests Dropped"), STAT_FPSGame_EffectRequestsDropped, STATGROUP_FPSGame);
+
 UPooledWeaponEffectsComponent::UPooledWeaponEffectsComponent()
 {
     PrimaryComponentTick.bCanEverTick = true;
@@ -67,6 +79,29 @@ UPooledWeaponEffectsComponent::UPooledWeaponEffectsComponent()
 void UPooledWeaponEffectsComponent::BeginPlay()
 {
     Super::BeginPlay();
+    CaptureQualityBase();
+    ExpiryWheel.Reset(GetWorld()->GetTimeSeconds());
+    
+    // Every weapon shares one effects budget with the arbiter
+    FrameBudget = UFrameBudgetSubsystem::Get(this);
+    if (FrameBudget.IsValid())
+    {
+        FrameBudgetConsumer = FrameBudget->RegisterConsumer(TEXT("WeaponEffects"), EFrameBudgetPriority::Normal, MinEffectBudgetUS, EffectFrameBudgetMS * 1000.0f);
+    }
+    
+    // Idle effects are the last thing given up under memory pressure
+    MemoryPressure = UMemoryPressureSubsystem::Get(this);
+    if (MemoryPressure.IsValid())
+    {
+        MemoryReclaimerHandle = MemoryPressure->RegisterReclaimer(EMemoryPressureTier::FlushEffectPools, TEXT("WeaponEffectPools"),
+            FMemoryReclaimDelegate::CreateUObject(this, &UPooledWeaponEffectsComponent::FlushIdleEffectPools));
+    }
+    
+    // Adaptive quality drives the effect limits while it is enabled
+    for (TActorIterator<APerformanceOptimizationSystem> It(GetWorld()); It; ++It)
+    {
+        It->RegisterEffectComponent(this);
+    }
     
     // Get or create pool manager
     PoolManager = UAdvancedObjectPoolManager::GetInstance(GetWorld());
@@ -84,6 +119,21 @@ void UPooledWeaponEffectsComponent::BeginPlay()
 
 void UPooledWeaponEffectsComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
 {
+    if (MemoryPressure.IsValid())
+    {
+        MemoryPressure->UnregisterReclaimer(MemoryReclaimerHandle);
+    }
+    MemoryReclaimerHandle = INDEX_NONE;
+    
+    for (TActorIterator<APerformanceOptimizationSystem> It(GetWorld()); It; ++It)
+    {
+        It->UnregisterEffectComponent(this);
+    }
+    
+    // Requests still buffered are dropped with the component
+    GetWorld()->GetTimerManager().ClearTimer(EffectRequestFlushHandle);
+    EffectRequests.Reset();
+    
     CleanupPools();
     Super::EndPlay(EndPlayReason);
 }
@@ -92,6 +142,7 @@ void UPooledWeaponEffectsComponent::TickComponent(float DeltaTime, ELevelTick Ti
 {
     Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
     
+    // Upkeep is left out of the spawn grant; the arbiter sees it as unbudgeted game-thread time
     UpdateActiveEffects(DeltaTime);
     
     // Reset frame counters
@@ -115,8 +166,14 @@ void UPooledWeaponEffectsComponent::InitializePools()
     InitializePool(ImpactEffectPoolData.PoolName, ImpactEffectPoolData, ImpactEffectTemplate);
     InitializePool(ShellEjectPoolData.PoolName, ShellEjectPoolData, ShellEjectTemplate);
     InitializePool(AudioSourcePoolData.PoolName, AudioSourcePoolData, AudioSourceTemplate);
-    InitializePool(DecalPoolData.PoolName, DecalPoolData, DecalTemplate);
-    InitializePool(TracerPoolData.PoolName, TracerPoolData, TracerTemplate);
+    if (!UsesInstancedBulletHoles())
+    {
+        InitializePool(DecalPoolData.PoolName, DecalPoolData, DecalTemplate);
+    }
+    if (!bUseInstancedTracers)
+    {
+        InitializePool(TracerPoolData.PoolName, TracerPoolData, TracerTemplate);
+    }
 
     UE_LOG(LogPooledWeaponEffects, Log, TEXT("All weapon effect pools initialized successfully"));
 }
@@ -159,6 +216,8 @@ AActor* UPooledWeaponEffectsComponent::SpawnMuzzleFlash(const FVector& Location,
         return nullptr;
     }
 
+    FFrameBudgetScope BudgetScope(FrameBudget.Get(), FrameBudgetConsumer);
+
     AActor* Effect = nullptr;
     
     if (bEnablePooling && PoolManager)
@@ -205,6 +264,8 @@ AActor* UPooledWeaponEffectsComponent::SpawnImpactEffect(const FVector& Location
         return nullptr;
     }
 
+    FFrameBudgetScope BudgetScope(FrameBudget.Get(), FrameBudgetConsumer);
+
     AActor* Effect = nullptr;
     
     if (bEnablePooling && PoolManager)
@@ -254,6 +315,8 @@ AActor* UPooledWeaponEffectsComponent::SpawnShellEject(const FVector& Location,
         return nullptr;
     }
 
+    FFrameBudgetScope BudgetScope(FrameBudget.Get(), FrameBudgetConsumer);
+
     AActor* Effect = AcquireFromPool(ShellEjectPoolData.PoolName);
     
     if (Effect)
@@ -292,6 +355,8 @@ AActor* UPooledWeaponEffectsComponent::SpawnPooledAudioSource(const FVector& Loc
         return nullptr;
     }
 
+    FFrameBudgetScope BudgetScope(FrameBudget.Get(), FrameBudgetConsumer);
+
     AActor* AudioSource = nullptr;
     
     if (bEnablePooling && PoolManager)
@@ -333,11 +398,19 @@ AActor* UPooledWeaponEffectsComponent::SpawnPooledAudioSource(const FVector& Loc
 
 AActor* UPooledWeaponEffectsComponent::SpawnImpactDecal(const FVector& Location, const FRotator& Rotation, UMaterialInterface* DecalMaterial, const FVector& DecalSize)
 {
+    if (UsesInstancedBulletHoles())
+    {
+        AddInstancedBulletHole(Location, Rotation, DecalSize);
+        return nullptr;
+    }
+
     if (!ShouldSpawnEffect(Location) || IsEffectBudgetExceeded())
     {
         return nullptr;
     }
 
+    FFrameBudgetScope BudgetScope(FrameBudget.Get(), FrameBudgetConsumer);
+
     AActor* Decal = nullptr;
     
     if (bEnablePooling && PoolManager)
@@ -382,11 +455,19 @@ AActor* UPooledWeaponEffectsComponent::SpawnImpactDecal(const FVector& Location,
 
 AActor* UPooledWeaponEffectsComponent::SpawnBulletTracer(const FVector& StartLocation, const FVector& EndLocation, float TracerSpeed)
 {
+    if (bUseInstancedTracers)
+    {
+        AddInstancedTracer(StartLocation, EndLocation, TracerSpeed);
+        return nullptr;
+    }
+
     if (!ShouldSpawnEffect(StartLocation) || IsEffectBudgetExceeded())
     {
         return nullptr;
     }
 
+    FFrameBudgetScope BudgetScope(FrameBudget.Get(), FrameBudgetConsumer);
+
     AActor* Tracer = AcquireFromPool(TracerPoolData.PoolName);
     
     if (Tracer)
@@ -426,10 +507,211 @@ AActor* UPooledWeaponEffectsComponent::SpawnBulletTracer(const FVector& StartLoc
     return Tracer;
 }
 
+void UPooledWeaponEffectsComponent::RequestMuzzleFlash(const FVector& Location, const FRotator& Rotation, UParticleSystem* ParticleEffect)
+{
+    FEffectRequest Request;
+    Request.Type = EEffectRequestType::MuzzleFlash;
+    Request.Location = Location;
+    Request.Rotation = Rotation;
+    Request.Asset = ParticleEffect;
+    QueueEffectRequest(Request);
+}
+
+void UPooledWeaponEffectsComponent::RequestImpactEffect(const FVector& Location, const FRotator& Rotation, const FHitResult& HitResult, UParticleSystem* ParticleEffect)
+{
+    FEffectRequest Request;
+    Request.Type = EEffectRequestType::Impact;
+    Request.Location = Location;
+    Request.Rotation = Rotation;
+    Request.Asset = ParticleEffect;
+    Request.Hit = HitResult;
+    QueueEffectRequest(Request);
+}
+
+void UPooledWeaponEffectsComponent::RequestShellEject(const FVector& Location, const FRotator& Rotation, const FVector& EjectVelocity)
+{
+    FEffectRequest Request;
+    Request.Type = EEffectRequestType::ShellEject;
+    Request.Location = Location;
+    Request.Rotation = Rotation;
+    Request.Vector = EjectVelocity;
+    QueueEffectRequest(Request);
+}
+
+void UPooledWeaponEffectsComponent::RequestImpactDecal(const FVector& Location, const FRotator& Rotation, UMaterialInterface* DecalMaterial, const FVector& DecalSize)
+{
+    FEffectRequest Request;
+    Request.Type = EEffectRequestType::Decal;
+    Request.Location = Location;
+    Request.Rotation = Rotation;
+    Request.Vector = DecalSize;
+    Request.Asset = DecalMaterial;
+    QueueEffectRequest(Request);
+}
+
+void UPooledWeaponEffectsComponent::RequestBulletTracer(const FVector& StartLocation, const FVector& EndLocation, float TracerSpeed)
+{
+    FEffectRequest Request;
+    Request.Type = EEffectRequestType::Tracer;
+    Request.Location = StartLocation;
+    Request.Vector = EndLocation;
+    Request.Speed = TracerSpeed;
+    QueueEffectRequest(Request);
+}
+
+void UPooledWeaponEffectsComponent::QueueEffectRequest(const FEffectRequest& Request)
+{
+    if (EffectRequests.Num() == 0)
+    {
+        EffectRequests.SetMergeRadius(EffectMergeRadius);
+    }
+    EffectRequests.Add(Request);
+    
+    // One flush per frame, once everything firing this frame has asked
+    if (!EffectRequestFlushHandle.IsValid())
+    {
+        EffectRequestFlushHandle = GetWorld()->GetTimerManager().SetTimerForNextTick(this, &UPooledWeaponEffectsComponent::FlushEffectRequests);
+    }
+}
+
+void UPooledWeaponEffectsComponent::FlushEffectRequests()
+{
+    GetWorld()->GetTimerManager().ClearTimer(EffectRequestFlushHandle);
+    
+    if (EffectRequests.GetNumAdded() == 0)
+    {
+        return;
+    }
+    
+    TArray<FEffectRequest>& Requests = EffectRequests.GetRequests();
+    for (FEffectRequest& Request : Requests)
+    {
+        Request.Relevance = GetRequestRelevance(Request);
+    }
+    EffectRequests.SortByRelevance();
+    
+    // Ranked, so once one request is irrelevant or out of budget so is everything after it
+    const double Deadline = FPlatformTime::Seconds() + EffectRequestBudgetMS / 1000.0;
+    int32 Spawned = 0;
+    for (const FEffectRequest& Request : Requests)
+    {
+        if (Request.Relevance <= 0.0f || Spawned >= MaxEffectSpawnsPerFrame || FPlatformTime::Seconds() > Deadline)
+        {
+            break;
+        }
+        
+        if (SpawnRequestedEffect(Request))
+        {
+            Spawned++;
+        }
+    }
+    
+    const int32 Coalesced = EffectRequests.GetNumCoalesced();
+    const int32 Dropped = Requests.Num() - Spawned;
+    EffectRequestStats.Requested += EffectRequests.GetNumAdded();
+    EffectRequestStats.Coalesced += Coalesced;
+    EffectRequestStats.Dropped += Dropped;
+    EffectRequestStats.Spawned += Spawned;
+    INC_DWORD_STAT_BY(STAT_FPSGame_EffectRequestsCoalesced, Coalesced);
+    INC_DWORD_STAT_BY(STAT_FPSGame_EffectRequestsDropped, Dropped);
+    
+    UE_LOG(LogPooledWeaponEffects, Verbose, TEXT("Effect requests: %d requested, %d coalesced, %d dropped, %d spawned"),
+           EffectRequests.GetNumAdded(), Coalesced, Dropped, Spawned);
+    
+    EffectRequests.Reset();
+}
+
+float UPooledWeaponEffectsComponent::GetRequestRelevance(const FEffectRequest& Request) const
+{
+    const float Distance = GetDistanceToPlayer(Request.Location);
+    if (bUseDistanceCulling && Distance > MaxEffectDistance)
+    {
+        return 0.0f;
+    }
+    
+    const bool bInViewport = IsLocationInViewport(Request.Location);
+    if (bUseFrustumCulling && !bInViewport)
+    {
+        return 0.0f;
+    }
+    
+    // Near and on screen first; a merged request stands in for several hits
+    float Relevance = 1.0f - FMath::Clamp(Distance / FMath::Max(MaxEffectDistance, 1.0f), 0.0f, 0.95f);
+    if (!bInViewport)
+    {
+        Relevance *= 0.25f;
+    }
+    return Relevance * FMath::Sqrt((float)Request.MergedCount);
+}
+
+bool UPooledWeaponEffectsComponent::SpawnRequestedEffect(const FEffectRequest& Request)
+{
+    switch (Request.Type)
+    {
+        case EEffectRequestType::MuzzleFlash:
+            return SpawnMuzzleFlash(Request.Location, Request.Rotation, Cast<UParticleSystem>(Request.Asset.Get())) != nullptr;
+        case EEffectRequestType::Impact:
+            return SpawnImpactEffect(Request.Location, Request.Rotation, Request.Hit, Cast<UParticleSystem>(Request.Asset.Get())) != nullptr;
+        case EEffectRequestType::ShellEject:
+            return SpawnShellEject(Request.Location, Request.Rotation, Request.Vector) != nullptr;
+        case EEffectRequestType::Decal:
+            if (UsesInstancedBulletHoles())
+            {
+                return AddInstancedBulletHole(Request.Location, Request.Rotation, Request.Vector);
+            }
+            return SpawnImpactDecal(Request.Location, Request.Rotation, Cast<UMaterialInterface>(Request.Asset.Get()), Request.Vector) != nullptr;
+        case EEffectRequestType::Tracer:
+            if (bUseInstancedTracers)
+            {
+                return AddInstancedTracer(Request.Location, Request.Vector, Request.Speed);
+            }
+            return SpawnBulletTracer(Request.Location, Request.Vector, Request.Speed) != nullptr;
+        default:
+            return false;
+    }
+}
+
+bool UPooledWeaponEffectsComponent::AddInstancedBulletHole(const FVector& Location, const FRotator& Rotation, const FVector& DecalSize)
+{
+    UBulletHoleSubsystem* BulletHoles = UBulletHoleSubsystem::Get(this);
+    if (!BulletHoles || !ShouldSpawnEffect(Location) || IsEffectBudgetExceeded())
+    {
+        return false;
+    }
+    
+    FFrameBudgetScope BudgetScope(FrameBudget.Get(), FrameBudgetConsumer);
+    
+    // Distant holes are drawn smaller, as with pooled decals
+    const float SizeScale = GetDistanceToPlayer(Location) > MaxEffectDistance * 0.5f ? 0.7f : 1.0f;
+    BulletHoles->AddBulletHole(BulletHoleMaterial, Location, Rotation, DecalSize * SizeScale, DecalPoolData.EffectDuration);
+    FrameEffectCount++;
+    return true;
+}
+
+bool UPooledWeaponEffectsComponent::AddInstancedTracer(const FVector& StartLocation, const FVector& EndLocation, float TracerSpeed)
+{
+    UTracerRenderSubsystem* Tracers = UTracerRenderSubsystem::Get(this);
+    if (!Tracers || !ShouldSpawnEffect(StartLocation) || IsEffectBudgetExceeded())
+    {
+        return false;
+    }
+    
+    FFrameBudgetScope BudgetScope(FrameBudget.Get(), FrameBudgetConsumer);
+    Tracers->AddTracer(StartLocation, EndLocation, TracerSpeed);
+    FrameEffectCount++;
+    return true;
+}
+
 void UPooledWeaponEffectsComponent::UpdateActiveEffects(float DeltaTime)
 {
     CleanupExpiredEffects();
     
+    // An external controller owns the limits
+    if (bExternalQualityControl)
+    {
+        return;
+    }
+    
     // Update performance budget based on frame rate
     float CurrentFrameTime = GetWorld()->GetDeltaSeconds();
     if (CurrentFrameTime > PerformanceBudget * 1.2f)
@@ -446,17 +728,17 @@ void UPooledWeaponEffectsComponent::UpdateActiveEffects(float DeltaTime)
 
 void UPooledWeaponEffectsComponent::CleanupExpiredEffects()
 {
-    float CurrentTime = GetWorld()->GetTimeSeconds();
+    DueEffects.Reset();
+    ExpiryWheel.Advance(GetWorld()->GetTimeSeconds(), DueEffects);
     
-    for (int32 i = ActiveEffects.Num() - 1; i >= 0; i--)
+    for (const FSlotHandle& Handle : DueEffects)
     {
-        const FActivePooledEffect& Effect = ActiveEffects[i];
-        
-        if (Effect.bAutoReturn && Effect.EffectActor && 
-            (CurrentTime - Effect.StartTime) >= Effect.Duration)
+        // Effects returned early leave stale handles behind
+        const int32 Index = EffectSlots.GetDenseIndex(Handle);
+        if (Index != INDEX_NONE)
         {
-            ProcessEffectReturn(Effect);
-            ActiveEffects.RemoveAt(i);
+            ProcessEffectReturn(ActiveEffects[Index]);
+            RemoveActiveEffect(Handle);
         }
     }
 }
@@ -589,14 +871,44 @@ void UPooledWeaponEffectsComponent::TrackActiveEffect(AActor* Effect, const FStr
         return;
     }
 
-    FActivePooledEffect ActiveEffect;
+    // An actor handed out again before its old entry expired replaces that entry
+    if (const FSlotHandle* Existing = ActiveEffectHandles.Find(Effect))
+    {
+        RemoveActiveEffect(*Existing);
+    }
+
+    const FSlotHandle Handle = EffectSlots.Add();
+    FActivePooledEffect& ActiveEffect = ActiveEffects.AddDefaulted_GetRef();
     ActiveEffect.EffectActor = Effect;
+    ActiveEffect.EffectKey = Effect;
     ActiveEffect.PoolName = PoolName;
     ActiveEffect.StartTime = GetWorld()->GetTimeSeconds();
     ActiveEffect.Duration = Duration;
     ActiveEffect.bAutoReturn = bAutoReturn;
+    ActiveEffectHandles.Add(Effect, Handle);
 
-    ActiveEffects.Add(ActiveEffect);
+    if (bAutoReturn)
+    {
+        ExpiryWheel.Schedule(Handle, ActiveEffect.StartTime + Duration);
+    }
+}
+
+void UPooledWeaponEffectsComponent::RemoveActiveEffect(FSlotHandle Handle)
+{
+    const int32 Index = EffectSlots.Remove(Handle);
+    if (Index != INDEX_NONE)
+    {
+        ActiveEffectHandles.Remove(ActiveEffects[Index].EffectKey);
+        ActiveEffects.RemoveAtSwap(Index, 1, false);
+    }
+}
+
+void UPooledWeaponEffectsComponent::ResetActiveEffects()
+{
+    ActiveEffects.Empty();
+    ActiveEffectHandles.Empty();
+    EffectSlots.Reset();
+    ExpiryWheel.Reset(GetWorld() ? GetWorld()->GetTimeSeconds() : 0.0);
 }
 
 bool UPooledWeaponEffectsComponent::ShouldSpawnEffect(const FVector& Location) const
@@ -659,7 +971,13 @@ float UPooledWeaponEffectsComponent::GetDistanceToPlayer(const FVector& Location
 
 bool UPooledWeaponEffectsComponent::IsEffectBudgetExceeded() const
 {
-    return FrameEffectCount >= (MaxConcurrentEffects / 3); // Limit per-frame spawning
+    if (FrameEffectCount >= (MaxConcurrentEffects / 3)) // Limit per-frame spawning
+    {
+        return true;
+    }
+    
+    // Spawning stops for the frame once the shared effects grant is spent
+    return FrameBudget.IsValid() && FrameBudgetConsumer != INDEX_NONE && FrameBudget->GetRemainingBudgetUs(FrameBudgetConsumer) <= 0.0f;
 }
 
 void UPooledWeaponEffectsComponent::SetPerformanceMode(bool bHighPerformanceMode)
@@ -678,10 +996,41 @@ void UPooledWeaponEffectsComponent::SetPerformanceMode(bool bHighPerformanceMode
     }
 }
 
+void UPooledWeaponEffectsComponent::SetEffectQualityScale(float Scale)
+{
+    CaptureQualityBase();
+    
+    EffectQualityScale = FMath::Clamp(Scale, 0.0f, 1.0f);
+    bExternalQualityControl = true;
+    
+    MaxConcurrentEffects = FMath::Max(1, FMath::RoundToInt(BaseMaxConcurrentEffects * EffectQualityScale));
+    MaxEffectDistance = BaseMaxEffectDistance * EffectQualityScale;
+}
+
+void UPooledWeaponEffectsComponent::ReleaseEffectQualityScale()
+{
+    CaptureQualityBase();
+    
+    EffectQualityScale = 1.0f;
+    bExternalQualityControl = false;
+    
+    MaxConcurrentEffects = BaseMaxConcurrentEffects;
+    MaxEffectDistance = BaseMaxEffectDistance;
+}
+
+void UPooledWeaponEffectsComponent::CaptureQualityBase()
+{
+    if (!bQualityBaseCaptured)
+    {
+        BaseMaxConcurrentEffects = MaxConcurrentEffects;
+        BaseMaxEffectDistance = MaxEffectDistance;
+        bQualityBaseCaptured = true;
+    }
+}
+
 void UPooledWeaponEffectsComponent::CleanupPools()
 {
     ReturnAllEffectsToPool();
-    ActiveEffects.Empty();
     
     UE_LOG(LogPooledWeaponEffects, Log, TEXT("PooledWeaponEffectsComponent pools cleaned up"));
 }
@@ -693,16 +1042,36 @@ void UPooledWeaponEffectsComponent::ReturnEffectToPool(const FString& PoolName,
         return;
     }
 
-    // Find and remove from active effects
-    for (int32 i = ActiveEffects.Num() - 1; i >= 0; i--)
+    if (const FSlotHandle* Handle = ActiveEffectHandles.Find(Effect))
     {
-        if (ActiveEffects[i].EffectActor == Effect)
+        const FSlotHandle ReturnedHandle = *Handle;
+        const int32 Index = EffectSlots.GetDenseIndex(ReturnedHandle);
+        if (Index != INDEX_NONE)
         {
-            ProcessEffectReturn(ActiveEffects[i]);
-            ActiveEffects.RemoveAt(i);
-            break;
+            ProcessEffectReturn(ActiveEffects[Index]);
         }
+        RemoveActiveEffect(ReturnedHandle);
+    }
+}
+
+int64 UPooledWeaponEffectsComponent::FlushIdleEffectPools()
+{
+    if (!PoolManager)
+    {
+        return 0;
     }
+    
+    // Active effects stay checked out; the pools refill on demand once pressure drops
+    int64 FlushedBytes = 0;
+    FlushedBytes += PoolManager->TrimIdleObjects(MuzzleFlashPoolData.PoolName, 0);
+    FlushedBytes += PoolManager->TrimIdleObjects(ImpactEffectPoolData.PoolName, 0);
+    FlushedBytes += PoolManager->TrimIdleObjects(ShellEjectPoolData.PoolName, 0);
+    FlushedBytes += PoolManager->TrimIdleObjects(AudioSourcePoolData.PoolName, 0);
+    FlushedBytes += PoolManager->TrimIdleObjects(DecalPoolData.PoolName, 0);
+    FlushedBytes += PoolManager->TrimIdleObjects(TracerPoolData.PoolName, 0);
+    
+    UE_LOG(LogPooledWeaponEffects, Log, TEXT("Flushed idle weapon effects (~%.2f MB)"), FlushedBytes / (1024.0f * 1024.0f));
+    return FlushedBytes;
 }
 
 void UPooledWeaponEffectsComponent::ReturnAllEffectsToPool()
@@ -711,7 +1080,7 @@ void UPooledWeaponEffectsComponent::ReturnAllEffectsToPool()
     {
         ProcessEffectReturn(Effect);
     }
-    ActiveEffects.Empty();
+    ResetActiveEffects();
 }
 
 UAdvancedObjectPoolManager* UPooledWeaponEffectsComponent::GetPoolManager() const
@@ -6,9 +6,15 @@
 #include "Sound/SoundCue.h"
 #include "Components/AudioComponent.h"
 #include "Engine/DecalActor.h"
+#include "UObject/ObjectKey.h"
 #include "AdvancedObjectPoolManager.h"
+#include "SlotMap.h"
+#include "EffectRequestBuffer.h"
 #include "PooledWeaponEffectsComponent.generated.h"
 
+class UFrameBudgetSubsystem;
+class UMemoryPressureSubsystem;
+
 USTRUCT(BlueprintType)
 struct FPooledEffectData
 {
@@ -52,6 +58,29 @@ struct FActivePooledEffect
 
     UPROPERTY()
     bool bAutoReturn = true;
+
+    // Key in ActiveEffectHandles; unlike EffectActor it survives the actor being destroyed
+    TObjectKey<AActor> EffectKey;
+};
+
+USTRUCT(BlueprintType)
+struct FEffectRequestStats
+{
+    GENERATED_BODY()
+
+    UPROPERTY(BlueprintReadOnly, Category = "Performance")
+    int32 Requested = 0;
+
+    // Folded into a co-located request of the same type
+    UPROPERTY(BlueprintReadOnly, Category = "Performance")
+    int32 Coalesced = 0;
+
+    // Culled, ranked below the per-frame cap or out of time
+    UPROPERTY(BlueprintReadOnly, Category = "Performance")
+    int32 Dropped = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Performance")
+    int32 Spawned = 0;
 };
 
 /**
@@ -126,6 +155,36 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance")
     bool bUseFrustumCulling = true;
 
+    // Impact decals become instances in the per-world bullet hole ring buffer instead of pooled decal actors.
+    // Needs BulletHoleMaterial; the decal materials passed to SpawnImpactDecal can't be drawn on a mesh
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance")
+    bool bUseInstancedBulletHoles = false;
+
+    // Surface-domain mesh decal used for every instanced bullet hole
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance")
+    UMaterialInterface* BulletHoleMaterial = nullptr;
+
+    // Tracers become segments in the per-world instanced tracer buffer instead of pooled actors; give the
+    // tracer render subsystem a mesh and material first, or they are drawn as the default cylinder
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance")
+    bool bUseInstancedTracers = false;
+
+    // Game-thread time per frame requested from the frame budget arbiter; shared by every effects component
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance")
+    float EffectFrameBudgetMS = 1.0f;
+
+    // Size of the grid cells requests are bucketed into; requests of the same type and asset in one cell become one effect
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance|Requests")
+    float EffectMergeRadius = 50.0f;
+
+    // Only the most relevant requests of a frame are spawned
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance|Requests")
+    int32 MaxEffectSpawnsPerFrame = 12;
+
+    // Spawning requests stops once a flush has taken this long
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance|Requests")
+    float EffectRequestBudgetMS = 0.5f;
+
     // Core Functions
     UFUNCTION(BlueprintCallable, Category = "Weapon Effects")
     AActor* SpawnMuzzleFlash(const FVector& Location, const FRotator& Rotation, UParticleSystem* ParticleEffect = nullptr);
@@ -139,12 +198,38 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Weapon Effects")
     AActor* SpawnPooledAudioSource(const FVector& Location, USoundCue* SoundCue);
 
+    // Returns nullptr when instanced bullet holes are in use; the hole is added to the bullet hole subsystem instead
     UFUNCTION(BlueprintCallable, Category = "Weapon Effects")
     AActor* SpawnImpactDecal(const FVector& Location, const FRotator& Rotation, UMaterialInterface* DecalMaterial, const FVector& DecalSize);
 
+    // Returns nullptr when bUseInstancedTracers is set; the tracer is added to the tracer render subsystem instead
     UFUNCTION(BlueprintCallable, Category = "Weapon Effects")
     AActor* SpawnBulletTracer(const FVector& StartLocation, const FVector& EndLocation, float TracerSpeed = 800.0f);
 
+    // Buffered versions of the spawns above: co-located requests are merged and the most relevant are spawned next frame
+    UFUNCTION(BlueprintCallable, Category = "Weapon Effects|Requests")
+    void RequestMuzzleFlash(const FVector& Location, const FRotator& Rotation, UParticleSystem* ParticleEffect = nullptr);
+
+    UFUNCTION(BlueprintCallable, Category = "Weapon Effects|Requests")
+    void RequestImpactEffect(const FVector& Location, const FRotator& Rotation, const FHitResult& HitResult, UParticleSystem* ParticleEffect = nullptr);
+
+    UFUNCTION(BlueprintCallable, Category = "Weapon Effects|Requests")
+    void RequestShellEject(const FVector& Location, const FRotator& Rotation, const FVector& EjectVelocity);
+
+    UFUNCTION(BlueprintCallable, Category = "Weapon Effects|Requests")
+    void RequestImpactDecal(const FVector& Location, const FRotator& Rotation, UMaterialInterface* DecalMaterial, const FVector& DecalSize);
+
+    UFUNCTION(BlueprintCallable, Category = "Weapon Effects|Requests")
+    void RequestBulletTracer(const FVector& StartLocation, const FVector& EndLocation, float TracerSpeed = 800.0f);
+
+    // Spawns the buffered requests now instead of at the start of the next frame
+    UFUNCTION(BlueprintCallable, Category = "Weapon Effects|Requests")
+    void FlushEffectRequests();
+
+    // Totals since BeginPlay
+    UFUNCTION(BlueprintPure, Category = "Performance")
+    FEffectRequestStats GetEffectRequestStats() const { return EffectRequestStats; }
+
     // Utility Functions
     UFUNCTION(BlueprintCallable, Category = "Pool Management")
     void InitializePools();
@@ -158,6 +243,10 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Pool Management")
     void ReturnAllEffectsToPool();
 
+    // Destroys every idle effect in this component's pools; returns the estimated bytes freed
+    UFUNCTION(BlueprintCallable, Category = "Pool Management")
+    int64 FlushIdleEffectPools();
+
     UFUNCTION(BlueprintPure, Category = "Pool Management")
     UAdvancedObjectPoolManager* GetPoolManager() const;
 
@@ -170,6 +259,20 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Performance")
     void SetPerformanceMode(bool bHighPerformanceMode);
 
+    // Scales the authored effect count and distance limits; once set, the component stops adjusting them itself
+    UFUNCTION(BlueprintCallable, Category = "Performance")
+    void SetEffectQualityScale(float Scale);
+
+    // Restores the authored limits and hands their adjustment back to the component
+    UFUNCTION(BlueprintCallable, Category = "Performance")
+    void ReleaseEffectQualityScale();
+
+    UFUNCTION(BlueprintPure, Category = "Performance")
+    float GetEffectQualityScale() const { return EffectQualityScale; }
+
+    UFUNCTION(BlueprintPure, Category = "Performance")
+    bool HasExternalQualityControl() const { return bExternalQualityControl; }
+
     // Distance and Culling Functions
     UFUNCTION(BlueprintPure, Category = "Performance")
     bool ShouldSpawnEffect(const FVector& Location) const;
@@ -185,9 +288,21 @@ private:
     UPROPERTY()
     UAdvancedObjectPoolManager* PoolManager;
 
+    // Dense and unordered; EffectSlots maps handles to indices and is kept in step with every swap-remove
     UPROPERTY()
     TArray<FActivePooledEffect> ActiveEffects;
 
+    FSlotMap EffectSlots;
+    TMap<TObjectKey<AActor>, FSlotHandle> ActiveEffectHandles;
+
+    // Auto-return expiries; only effects that are due get touched each tick
+    FSlotTimingWheel ExpiryWheel;
+    TArray<FSlotHandle> DueEffects;
+
+    FEffectRequestBuffer EffectRequests;
+    FEffectRequestStats EffectRequestStats;
+    FTimerHandle EffectRequestFlushHandle;
+
     // Performance tracking
     UPROPERTY()
     int32 FrameEffectCount = 0;
@@ -198,6 +313,24 @@ private:
     UPROPERTY()
     float PerformanceBudget = 16.67f; // Target 60 FPS
 
+    // Authored limits EffectQualityScale applies to
+    int32 BaseMaxConcurrentEffects = 0;
+    float BaseMaxEffectDistance = 0.0f;
+    float EffectQualityScale = 1.0f;
+    bool bQualityBaseCaptured = false;
+    bool bExternalQualityControl = false;
+
+    void CaptureQualityBase();
+
+    TWeakObjectPtr<UFrameBudgetSubsystem> FrameBudget;
+    int32 FrameBudgetConsumer = INDEX_NONE;
+
+    // A few effects still spawn in frames where the arbiter has nothing left to give
+    static constexpr float MinEffectBudgetUS = 150.0f;
+
+    TWeakObjectPtr<UMemoryPressureSubsystem> MemoryPressure;
+    int32 MemoryReclaimerHandle = INDEX_NONE;
+
     // Internal Functions
     void UpdateActiveEffects(float DeltaTime);
     void ProcessEffectReturn(const FActivePooledEffect& Effect);
@@ -206,6 +339,14 @@ private:
     void ConfigurePooledEffect(AActor* Effect, const FVector& Location, const FRotator& Rotation);
     void ApplyPerformanceOptimizations(AActor* Effect, const FVector& Location);
     void TrackActiveEffect(AActor* Effect, const FString& PoolName, float Duration, bool bAutoReturn);
+    void RemoveActiveEffect(FSlotHandle Handle);
+    void ResetActiveEffects();
     void CleanupExpiredEffects();
     bool IsEffectBudgetExceeded() const;
+    void QueueEffectRequest(const FEffectRequest& Request);
+    float GetRequestRelevance(const FEffectRequest& Request) const;
+    bool SpawnRequestedEffect(const FEffectRequest& Request);
+    bool UsesInstancedBulletHoles() const { return bUseInstancedBulletHoles && BulletHoleMaterial; }
+    bool AddInstancedBulletHole(const FVector& Location, const FRotator& Rotation, const FVector& DecalSize);
+    bool AddInstancedTracer(const FVector& StartLocation, const FVector& EndLocation, float TracerSpeed);
 };
@@ -21,6 +21,12 @@
 #include "Async/ParallelFor.h"
 #include "Engine/TextureStreamingTypes.h"
 #include "Engine/LODActor.h"
+#include "FrameTelemetrySubsystem.h"
+#include "MemoryPressureSubsystem.h"
+#include "Misc/Paths.h"
+#include "Dom/JsonObject.h"
+#include "Serialization/JsonReader.h"
+#include "Serialization/JsonSerializer.h"
 
 DEFINE_LOG_CATEGORY(LogSinglePlayerOptimization);
 
@@ -81,6 +87,12 @@ void USinglePlayerOptimizationSystem::Deinitialize()
 {
     UE_LOG(LogSinglePlayerOptimization, Log, TEXT("Single Player Optimization System shutting down..."));
     
+    // An unfinished benchmark is dropped; its destructor restores the time step and removes its actors
+    FTSTicker::GetCoreTicker().RemoveTicker(BenchmarkTickerHandle);
+    BenchmarkTickerHandle.Reset();
+    ActiveDeterministicBenchmark.Reset();
+    PendingBenchmarkScenarios.Empty();
+    
     // Clear timers
     if (UWorld* World = GetWorld())
     {
@@ -231,28 +243,11 @@ void USinglePlayerOptimizationSystem::UpdatePerformanceMetrics()
     float DeltaTime = GetWorld() ? GetWorld()->GetDeltaSeconds() : 0.016f;
     CurrentMetrics.FrameTime = DeltaTime * 1000.0f; // Convert to milliseconds
     
-    // Add to frame time history for averaging
-    FrameTimeHistory.Enqueue(DeltaTime);
-    if (FrameTimeHistory.Num() > 60) // Keep last 60 frames
-    {
-        float OldFrame;
-        FrameTimeHistory.Dequeue(OldFrame);
-    }
-    
-    // Calculate average frame rate
-    if (FrameTimeHistory.Num() > 0)
-    {
-        float TotalTime = 0.0f;
-        TQueue<float> TempQueue = FrameTimeHistory;
-        while (!TempQueue.IsEmpty())
-        {
-            float FrameTime;
-            TempQueue.Dequeue(FrameTime);
-            TotalTime += FrameTime;
-        }
-        float AverageFrameTime = TotalTime / FrameTimeHistory.Num();
-        CurrentMetrics.AverageFrameRate = AverageFrameTime > 0.0f ? 1.0f / AverageFrameTime : 0.0f;
-    }
+    // Average frame rate over the last 60 frames of the shared telemetry
+    const UFrameTelemetrySubsystem* Telemetry = UFrameTelemetrySubsystem::Get(GetWorld());
+    const bool bHasTelemetry = Telemetry && Telemetry->GetBuffer().GetNumSamples() > 0;
+    const float AverageFrameTimeMs = bHasTelemetry ? Telemetry->GetBuffer().GetAverageFrameTimeMs(60) : CurrentMetrics.FrameTime;
+    CurrentMetrics.AverageFrameRate = AverageFrameTimeMs > 0.0f ? 1000.0f / AverageFrameTimeMs : 0.0f;
     
     // Update memory metrics
     CurrentMetrics.MemoryUsageMB = GetMemoryUsageMB();
@@ -292,7 +287,17 @@ void USinglePlayerOptimizationSystem::UpdatePerformanceMetrics()
     
     // Update rendering metrics (simplified)
     CurrentMetrics.RenderTime = CurrentMetrics.FrameTime * 0.6f; // Estimate render time as 60% of frame time
-    CurrentMetrics.GameThreadTime = CurrentMetrics.FrameTime * 0.4f; // Estimate game thread time as 40% of frame time
+    
+    // Game thread time is measured when telemetry has a frame, otherwise estimated as 40% of frame time
+    FFrameTelemetrySample NewestFrame;
+    if (bHasTelemetry && Telemetry->GetBuffer().ReadSample(0, NewestFrame))
+    {
+        CurrentMetrics.GameThreadTime = NewestFrame.GameThreadMs;
+    }
+    else
+    {
+        CurrentMetrics.GameThreadTime = CurrentMetrics.FrameTime * 0.4f;
+    }
     
     // Estimate draw calls and triangles (would need actual rendering stats in production)
     CurrentMetrics.DrawCalls = CurrentMetrics.ActiveActors * 2; // Rough estimate
@@ -446,6 +451,37 @@ void USinglePlayerOptimizationSystem::RunComprehensiveBenchmark()
     UE_LOG(LogSinglePlayerOptimization, Log, TEXT("Comprehensive benchmark suite completed"));
 }
 
+void USinglePlayerOptimizationSystem::RunDeterministicBenchmark(EBenchmarkScenario Scenario, const FBenchmarkRunSettings& Settings)
+{
+    if (IsDeterministicBenchmarkRunning())
+    {
+        UE_LOG(LogSinglePlayerOptimization, Warning, TEXT("A deterministic benchmark is already running"));
+        return;
+    }
+    
+    DeterministicBenchmarkSettings = Settings;
+    PendingBenchmarkScenarios.Add(Scenario);
+    FirstDeterministicResult = BenchmarkHistory.Num();
+    BenchmarkTickerHandle = FTSTicker::GetCoreTicker().AddTicker(
+        FTickerDelegate::CreateUObject(this, &USinglePlayerOptimizationSystem::TickDeterministicBenchmark));
+    
+    UE_LOG(LogSinglePlayerOptimization, Log, TEXT("Queued deterministic benchmark: %s (seed %d)"), 
+           *FDeterministicBenchmark::GetScenarioName(Scenario), Settings.RandomSeed);
+}
+
+void USinglePlayerOptimizationSystem::RunDeterministicBenchmarkSuite(const FBenchmarkRunSettings& Settings)
+{
+    if (IsDeterministicBenchmarkRunning())
+    {
+        UE_LOG(LogSinglePlayerOptimization, Warning, TEXT("A deterministic benchmark is already running"));
+        return;
+    }
+    
+    RunDeterministicBenchmark(EBenchmarkScenario::AIFirefight, Settings);
+    PendingBenchmarkScenarios.Add(EBenchmarkScenario::DestructionBurst);
+    PendingBenchmarkScenarios.Add(EBenchmarkScenario::EffectSpam);
+}
+
 void USinglePlayerOptimizationSystem::InitializeObjectPools()
 {
     if (!ObjectPoolManager)
@@ -530,8 +566,11 @@ void USinglePlayerOptimizationSystem::OptimizeMemoryUsage()
 {
     UE_LOG(LogSinglePlayerOptimization, Log, TEXT("Optimizing memory usage..."));
     
-    // Force garbage collection
-    ForceGarbageCollection();
+    // Trim pools and caches first; the responder only falls back to an incremental GC when that isn't enough
+    if (UMemoryPressureSubsystem* MemoryPressure = UMemoryPressureSubsystem::Get(this))
+    {
+        MemoryPressure->ReclaimMemory(EMemoryPressureTier::FlushEffectPools);
+    }
     
     // Clean up unused assets
     CleanupUnusedAssets();
@@ -792,7 +831,9 @@ FString USinglePlayerOptimizationSystem::GeneratePerformanceReport() const
 
 void USinglePlayerOptimizationSystem::SavePerformanceReport(const FString& Filename) const
 {
-    FString Report = GeneratePerformanceReport();
+    const FString Extension = FPaths::GetExtension(Filename).ToLower();
+    FString Report = Extension == TEXT("json") ? GenerateBenchmarkJson() : 
+                     Extension == TEXT("csv") ? GenerateBenchmarkCsv() : GeneratePerformanceReport();
     FString FilePath = FPaths::ProjectSavedDir() / TEXT("Performance") / Filename;
     
     if (FFileHelper::SaveStringToFile(Report, *FilePath))
@@ -805,6 +846,81 @@ void USinglePlayerOptimizationSystem::SavePerformanceReport(const FString& Filen
     }
 }
 
+FString USinglePlayerOptimizationSystem::GenerateBenchmarkJson() const
+{
+    TArray<TSharedPtr<FJsonValue>> Benchmarks;
+    for (const FBenchmarkData& Benchmark : BenchmarkHistory)
+    {
+        TSharedRef<FJsonObject> Entry = MakeShared<FJsonObject>();
+        Entry->SetStringField(TEXT("name"), Benchmark.TestName);
+        Entry->SetBoolField(TEXT("deterministic"), Benchmark.bDeterministic);
+        Entry->SetNumberField(TEXT("seed"), Benchmark.RandomSeed);
+        Entry->SetNumberField(TEXT("fixedStepSeconds"), Benchmark.FixedStepSeconds);
+        Entry->SetNumberField(TEXT("frames"), Benchmark.FrameTimesMs.Num());
+        Entry->SetNumberField(TEXT("durationSeconds"), Benchmark.Duration);
+        
+        // Sorted so reports from different runs diff cleanly
+        TMap<FString, float> SortedMetrics = Benchmark.CustomMetrics;
+        SortedMetrics.KeySort(TLess<FString>());
+        TSharedRef<FJsonObject> Metrics = MakeShared<FJsonObject>();
+        for (const TPair<FString, float>& Metric : SortedMetrics)
+        {
+            Metrics->SetNumberField(Metric.Key, Metric.Value);
+        }
+        Entry->SetObjectField(TEXT("metrics"), Metrics);
+        
+        TArray<TSharedPtr<FJsonValue>> FrameTimes;
+        FrameTimes.Reserve(Benchmark.FrameTimesMs.Num());
+        for (float FrameTimeMs : Benchmark.FrameTimesMs)
+        {
+            FrameTimes.Add(MakeShared<FJsonValueNumber>(FrameTimeMs));
+        }
+        Entry->SetArrayField(TEXT("frameTimesMs"), FrameTimes);
+        
+        Benchmarks.Add(MakeShared<FJsonValueObject>(Entry));
+    }
+    
+    TSharedRef<FJsonObject> Root = MakeShared<FJsonObject>();
+    Root->SetArrayField(TEXT("benchmarks"), Benchmarks);
+    
+    FString Output;
+    TSharedRef<TJsonWriter<>> Writer = TJsonWriterFactory<>::Create(&Output);
+    FJsonSerializer::Serialize(Root, Writer);
+    return Output;
+}
+
+FString USinglePlayerOptimizationSystem::GenerateBenchmarkCsv() const
+{
+    static const TCHAR* MetricColumns[] = 
+    {
+        TEXT("FrameTimeAvgMs"), TEXT("FrameTimeP50Ms"), TEXT("FrameTimeP95Ms"), TEXT("FrameTimeP99Ms"), TEXT("FrameTimeMaxMs"), 
+        TEXT("Hitches"), TEXT("GameThreadAvgMs"), TEXT("DeltaPct.FrameTimeP95Ms"), TEXT("DeltaPct.FrameTimeP99Ms"), TEXT("Regression")
+    };
+    
+    FString Csv = TEXT("Benchmark,Deterministic,Seed,Frames,DurationSeconds");
+    for (const TCHAR* Column : MetricColumns)
+    {
+        Csv += FString::Printf(TEXT(",%s"), Column);
+    }
+    Csv += TEXT("\n");
+    
+    for (const FBenchmarkData& Benchmark : BenchmarkHistory)
+    {
+        Csv += FString::Printf(TEXT("%s,%d,%d,%d,%.4f"), *Benchmark.TestName, Benchmark.bDeterministic ? 1 : 0, 
+                               Benchmark.RandomSeed, Benchmark.FrameTimesMs.Num(), Benchmark.Duration);
+        
+        // Missing metrics stay empty rather than reading as zero
+        for (const TCHAR* Column : MetricColumns)
+        {
+            const float* Value = Benchmark.CustomMetrics.Find(Column);
+            Csv += Value ? FString::Printf(TEXT(",%.4f"), *Value) : FString(TEXT(","));
+        }
+        Csv += TEXT("\n");
+    }
+    
+    return Csv;
+}
+
 void USinglePlayerOptimizationSystem::ResetOptimizationSystem()
 {
     FScopeLock Lock(&OptimizationMutex);
@@ -818,13 +934,6 @@ void USinglePlayerOptimizationSystem::ResetOptimizationSystem()
     // Reset metrics
     CurrentMetrics = FSinglePlayerMetrics();
     
-    // Clear frame time history
-    while (!FrameTimeHistory.IsEmpty())
-    {
-        float Temp;
-        FrameTimeHistory.Dequeue(Temp);
-    }
-    
     // Reset configuration to defaults
     Config = FSinglePlayerOptimizationConfig();
     
@@ -861,9 +970,11 @@ void USinglePlayerOptimizationSystem::TickMetricsUpdate()
 
 void USinglePlayerOptimizationSystem::TickGarbageCollection()
 {
-    if (Config.bEnableAggressiveGarbageCollection)
+    // Polls the responder more often than it would on its own, rather than purging on a timer
+    UMemoryPressureSubsystem* MemoryPressure = UMemoryPressureSubsystem::Get(this);
+    if (Config.bEnableAggressiveGarbageCollection && MemoryPressure)
     {
-        ForceGarbageCollection();
+        MemoryPressure->EvaluatePressure();
     }
 }
 
@@ -981,6 +1092,149 @@ void USinglePlayerOptimizationSystem::AnalyzeBenchmarkResults(const FBenchmarkDa
     }
 }
 
+bool USinglePlayerOptimizationSystem::TickDeterministicBenchmark(float DeltaTime)
+{
+    if (!ActiveDeterministicBenchmark)
+    {
+        if (PendingBenchmarkScenarios.Num() == 0)
+        {
+            FinishDeterministicBenchmarkSuite();
+            BenchmarkTickerHandle.Reset();
+            return false;
+        }
+        
+        const EBenchmarkScenario Scenario = PendingBenchmarkScenarios[0];
+        PendingBenchmarkScenarios.RemoveAt(0);
+        
+        ActiveDeterministicBenchmark = MakeUnique<FDeterministicBenchmark>(GetWorld(), Scenario, DeterministicBenchmarkSettings);
+        StartBenchmark(TEXT("Deterministic.") + FDeterministicBenchmark::GetScenarioName(Scenario));
+        ActiveDeterministicBenchmark->Begin();
+    }
+    
+    if (ActiveDeterministicBenchmark->Step())
+    {
+        return true;
+    }
+    
+    const FString TestName = TEXT("Deterministic.") + FDeterministicBenchmark::GetScenarioName(ActiveDeterministicBenchmark->GetScenario());
+    if (FBenchmarkData* BenchmarkData = ActiveBenchmarks.Find(TestName))
+    {
+        const TArray<float>& FrameTimesMs = ActiveDeterministicBenchmark->GetFrameTimesMs();
+        const TArray<float>& GameThreadTimesMs = ActiveDeterministicBenchmark->GetGameThreadTimesMs();
+        
+        BenchmarkData->bDeterministic = true;
+        BenchmarkData->RandomSeed = DeterministicBenchmarkSettings.RandomSeed;
+        BenchmarkData->FixedStepSeconds = DeterministicBenchmarkSettings.FixedStepSeconds;
+        BenchmarkData->FrameTimesMs = FrameTimesMs;
+        
+        FDeterministicBenchmark::AddFrameTimeStats(FrameTimesMs, DeterministicBenchmarkSettings.HitchThresholdMs, BenchmarkData->CustomMetrics);
+        
+        float GameThreadSumMs = 0.0f;
+        for (float GameThreadMs : GameThreadTimesMs)
+        {
+            GameThreadSumMs += GameThreadMs;
+        }
+        BenchmarkData->CustomMetrics.Add(TEXT("GameThreadAvgMs"), GameThreadTimesMs.Num() > 0 ? GameThreadSumMs / GameThreadTimesMs.Num() : 0.0f);
+        
+        for (const TPair<FString, float>& Scope : ActiveDeterministicBenchmark->GetScopeAveragesMs())
+        {
+            BenchmarkData->CustomMetrics.Add(TEXT("Scope.") + Scope.Key + TEXT("Ms"), Scope.Value);
+        }
+    }
+    
+    ActiveDeterministicBenchmark->End();
+    ActiveDeterministicBenchmark.Reset();
+    EndBenchmark(TestName);
+    
+    return true;
+}
+
+void USinglePlayerOptimizationSystem::FinishDeterministicBenchmarkSuite()
+{
+    const FBenchmarkRunSettings& Settings = DeterministicBenchmarkSettings;
+    const FString BaselinePath = FPaths::ProjectSavedDir() / TEXT("Performance") / Settings.BaselineFile;
+    const bool bHasBaseline = CompareWithBaseline(BaselinePath, FirstDeterministicResult);
+    
+    SavePerformanceReport(Settings.ReportName + TEXT(".json"));
+    SavePerformanceReport(Settings.ReportName + TEXT(".csv"));
+    
+    if (!bHasBaseline && Settings.bWriteBaselineIfMissing)
+    {
+        SavePerformanceReport(Settings.BaselineFile);
+    }
+    
+    UE_LOG(LogSinglePlayerOptimization, Log, TEXT("Deterministic benchmark finished (seed %d)"), Settings.RandomSeed);
+}
+
+bool USinglePlayerOptimizationSystem::CompareWithBaseline(const FString& BaselinePath, int32 FirstResult)
+{
+    FString BaselineJson;
+    if (!FFileHelper::LoadFileToString(BaselineJson, *BaselinePath))
+    {
+        UE_LOG(LogSinglePlayerOptimization, Log, TEXT("No benchmark baseline at %s"), *BaselinePath);
+        return false;
+    }
+    
+    TSharedPtr<FJsonObject> Root;
+    const TSharedRef<TJsonReader<>> Reader = TJsonReaderFactory<>::Create(BaselineJson);
+    const TArray<TSharedPtr<FJsonValue>>* Benchmarks = nullptr;
+    if (!FJsonSerializer::Deserialize(Reader, Root) || !Root.IsValid() || !Root->TryGetArrayField(TEXT("benchmarks"), Benchmarks))
+    {
+        UE_LOG(LogSinglePlayerOptimization, Warning, TEXT("Benchmark baseline %s could not be read"), *BaselinePath);
+        return false;
+    }
+    
+    // Later entries win, so a baseline holding several runs compares against its newest
+    TMap<FString, TSharedPtr<FJsonObject>> BaselineMetrics;
+    for (const TSharedPtr<FJsonValue>& Value : *Benchmarks)
+    {
+        const TSharedPtr<FJsonObject>* Entry = nullptr;
+        const TSharedPtr<FJsonObject>* Metrics = nullptr;
+        if (Value->TryGetObject(Entry) && (*Entry)->TryGetObjectField(TEXT("metrics"), Metrics))
+        {
+            BaselineMetrics.Add((*Entry)->GetStringField(TEXT("name")), *Metrics);
+        }
+    }
+    
+    static const TCHAR* ComparedMetrics[] = { TEXT("FrameTimeAvgMs"), TEXT("FrameTimeP50Ms"), TEXT("FrameTimeP95Ms"), TEXT("FrameTimeP99Ms") };
+    
+    for (int32 Index = FirstResult; Index < BenchmarkHistory.Num(); ++Index)
+    {
+        FBenchmarkData& Result = BenchmarkHistory[Index];
+        const TSharedPtr<FJsonObject>* Baseline = BaselineMetrics.Find(Result.TestName);
+        if (!Baseline) continue;
+        
+        bool bRegressed = false;
+        for (const TCHAR* Metric : ComparedMetrics)
+        {
+            const float* Current = Result.CustomMetrics.Find(Metric);
+            double BaselineValue = 0.0;
+            if (!Current || !(*Baseline)->TryGetNumberField(Metric, BaselineValue) || BaselineValue <= 0.0) continue;
+            
+            const float DeltaPercent = (float)((*Current - BaselineValue) / BaselineValue * 100.0);
+            Result.CustomMetrics.Add(FString::Printf(TEXT("Baseline.%s"), Metric), (float)BaselineValue);
+            Result.CustomMetrics.Add(FString::Printf(TEXT("DeltaPct.%s"), Metric), DeltaPercent);
+            
+            // Tail latency is what players feel, so only p95 and p99 can fail a run
+            if ((FCString::Strcmp(Metric, TEXT("FrameTimeP95Ms")) == 0 || FCString::Strcmp(Metric, TEXT("FrameTimeP99Ms")) == 0) && 
+                DeltaPercent > DeterministicBenchmarkSettings.RegressionThresholdPercent)
+            {
+                bRegressed = true;
+            }
+        }
+        
+        Result.CustomMetrics.Add(TEXT("Regression"), bRegressed ? 1.0f : 0.0f);
+        
+        if (bRegressed)
+        {
+            UE_LOG(LogSinglePlayerOptimization, Warning, TEXT("Benchmark %s regressed against baseline: p95 %+.1f%%, p99 %+.1f%%"), 
+                   *Result.TestName, Result.CustomMetrics.FindRef(TEXT("DeltaPct.FrameTimeP95Ms")), Result.CustomMetrics.FindRef(TEXT("DeltaPct.FrameTimeP99Ms")));
+        }
+    }
+    
+    return true;
+}
+
 void USinglePlayerOptimizationSystem::IntegrateWithObjectPooling()
 {
     if (ObjectPoolManager && Config.bEnableObjectPooling)
@@ -8,8 +8,10 @@
 #include "HAL/CriticalSection.h"
 #include "Engine/TimerManager.h"
 #include "Containers/Queue.h"
+#include "Containers/Ticker.h"
 #include "AdvancedObjectPoolManager.h"
 #include "PerformanceOptimizationSystem.h"
+#include "DeterministicBenchmark.h"
 #include "SinglePlayerOptimizationSystem.generated.h"
 
 DECLARE_LOG_CATEGORY_EXTERN(LogSinglePlayerOptimization, Log, All);
@@ -214,6 +216,19 @@ struct FBenchmarkData
     UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
     TMap<FString, float> CustomMetrics;
 
+    // Deterministic runs only
+    UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+    bool bDeterministic = false;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+    int32 RandomSeed = 0;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+    float FixedStepSeconds = 0.0f;
+
+    UPROPERTY(BlueprintReadOnly, Category = "Benchmark")
+    TArray<float> FrameTimesMs;
+
     FBenchmarkData()
     {
         TestName = TEXT("");
@@ -300,6 +315,17 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Benchmark")
     TArray<FBenchmarkData> GetBenchmarkHistory() const { return BenchmarkHistory; }
 
+    // Runs scripted scenarios over the coming frames with a fixed seed and time step, then writes
+    // <ReportName>.json and .csv and compares against the baseline file
+    UFUNCTION(BlueprintCallable, Category = "Benchmark")
+    void RunDeterministicBenchmark(EBenchmarkScenario Scenario, const FBenchmarkRunSettings& Settings);
+
+    UFUNCTION(BlueprintCallable, Category = "Benchmark")
+    void RunDeterministicBenchmarkSuite(const FBenchmarkRunSettings& Settings);
+
+    UFUNCTION(BlueprintCallable, Category = "Benchmark")
+    bool IsDeterministicBenchmarkRunning() const { return ActiveDeterministicBenchmark.IsValid() || PendingBenchmarkScenarios.Num() > 0; }
+
     // Object pooling integration
     UFUNCTION(BlueprintCallable, Category = "Object Pooling Integration")
     void InitializeObjectPools();
@@ -362,9 +388,16 @@ public:
     UFUNCTION(BlueprintCallable, Category = "Utilities")
     FString GeneratePerformanceReport() const;
 
+    // .json and .csv filenames get the benchmark history in that format; anything else gets the text report
     UFUNCTION(BlueprintCallable, Category = "Utilities")
     void SavePerformanceReport(const FString& Filename) const;
 
+    UFUNCTION(BlueprintCallable, Category = "Utilities")
+    FString GenerateBenchmarkJson() const;
+
+    UFUNCTION(BlueprintCallable, Category = "Utilities")
+    FString GenerateBenchmarkCsv() const;
+
     UFUNCTION(BlueprintCallable, Category = "Utilities")
     void ResetOptimizationSystem();
 
@@ -387,6 +420,13 @@ protected:
     UPROPERTY()
     TMap<FString, FBenchmarkData> ActiveBenchmarks;
 
+    // Deterministic benchmark queue, advanced once per frame by the core ticker
+    TUniquePtr<FDeterministicBenchmark> ActiveDeterministicBenchmark;
+    TArray<EBenchmarkScenario> PendingBenchmarkScenarios;
+    FBenchmarkRunSettings DeterministicBenchmarkSettings;
+    FTSTicker::FDelegateHandle BenchmarkTickerHandle;
+    int32 FirstDeterministicResult = 0;
+
     // Integration references
     UPROPERTY()
     class UAdvancedObjectPoolManager* ObjectPoolManager;
@@ -399,8 +439,7 @@ protected:
     FTimerHandle MetricsTimerHandle;
     FTimerHandle GarbageCollectionTimerHandle;
 
-    // Performance tracking
-    TQueue<float> FrameTimeHistory;
+    // Performance tracking; frame history comes from UFrameTelemetrySubsystem
     double LastMetricsUpdateTime;
     double LastOptimizationTime;
 
@@ -427,6 +466,9 @@ private:
     void InitializeBenchmarkSystem();
     void RecordBenchmarkMetrics(FBenchmarkData& BenchmarkData);
     void AnalyzeBenchmarkResults(const FBenchmarkData& Results);
+    bool TickDeterministicBenchmark(float DeltaTime);
+    void FinishDeterministicBenchmarkSuite();
+    bool CompareWithBaseline(const FString& BaselinePath, int32 FirstResult);
 
     // Integration helpers
     void IntegrateWithObjectPooling();
@@ -0,0 +1,136 @@
+#include "SlotMap.h"
+
+// FSlotMap
+
+FSlotHandle FSlotMap::Add()
+{
+    int32 Slot;
+    if (FreeSlots.Num() > 0)
+    {
+        Slot = FreeSlots.Pop(false);
+    }
+    else
+    {
+        Slot = SlotToDense.Add(INDEX_NONE);
+        SlotGenerations.Add(0);
+    }
+
+    SlotToDense[Slot] = DenseToSlot.Add(Slot);
+
+    FSlotHandle Handle;
+    Handle.Slot = Slot;
+    Handle.Generation = SlotGenerations[Slot];
+    return Handle;
+}
+
+int32 FSlotMap::Remove(FSlotHandle Handle)
+{
+    const int32 DenseIndex = GetDenseIndex(Handle);
+    if (DenseIndex == INDEX_NONE)
+    {
+        return INDEX_NONE;
+    }
+
+    // Mirror the caller's RemoveAtSwap: the last element moves into the freed index
+    const int32 MovedSlot = DenseToSlot.Last();
+    DenseToSlot.RemoveAtSwap(DenseIndex, 1, false);
+    if (MovedSlot != Handle.Slot)
+    {
+        SlotToDense[MovedSlot] = DenseIndex;
+    }
+
+    SlotToDense[Handle.Slot] = INDEX_NONE;
+    SlotGenerations[Handle.Slot]++;
+    FreeSlots.Add(Handle.Slot);
+    return DenseIndex;
+}
+
+int32 FSlotMap::GetDenseIndex(FSlotHandle Handle) const
+{
+    if (!SlotToDense.IsValidIndex(Handle.Slot) || SlotGenerations[Handle.Slot] != Handle.Generation)
+    {
+        return INDEX_NONE;
+    }
+    return SlotToDense[Handle.Slot];
+}
+
+FSlotHandle FSlotMap::GetHandle(int32 DenseIndex) const
+{
+    FSlotHandle Handle;
+    if (DenseToSlot.IsValidIndex(DenseIndex))
+    {
+        Handle.Slot = DenseToSlot[DenseIndex];
+        Handle.Generation = SlotGenerations[Handle.Slot];
+    }
+    return Handle;
+}
+
+void FSlotMap::Reset()
+{
+    // Generations are kept so handles from before the reset stay stale
+    FreeSlots.Reset();
+    for (int32 Slot = SlotToDense.Num() - 1; Slot >= 0; --Slot)
+    {
+        if (SlotToDense[Slot] != INDEX_NONE)
+        {
+            SlotToDense[Slot] = INDEX_NONE;
+            SlotGenerations[Slot]++;
+        }
+        FreeSlots.Add(Slot);
+    }
+    DenseToSlot.Reset();
+}
+
+// FSlotTimingWheel
+
+FSlotTimingWheel::FSlotTimingWheel(float InSlotSeconds, int32 InNumSlots)
+    : SlotSeconds(FMath::Max(InSlotSeconds, KINDA_SMALL_NUMBER))
+{
+    Slots.SetNum(FMath::Max(1, InNumSlots));
+}
+
+void FSlotTimingWheel::Reset(double Now)
+{
+    for (TArray<FEntry>& Slot : Slots)
+    {
+        Slot.Reset();
+    }
+    CurrentTick = ToTick(Now);
+    NumScheduled = 0;
+}
+
+void FSlotTimingWheel::Schedule(FSlotHandle Handle, double ExpiryTime)
+{
+    const int64 Tick = FMath::Max(CurrentTick, ToTick(ExpiryTime));
+
+    FEntry& Entry = Slots[(int32)(Tick % Slots.Num())].AddDefaulted_GetRef();
+    Entry.Handle = Handle;
+    Entry.ExpiryTime = ExpiryTime;
+    NumScheduled++;
+}
+
+void FSlotTimingWheel::Advance(double Now, TArray<FSlotHandle>& OutDue)
+{
+    const int64 TargetTick = ToTick(Now);
+    if (TargetTick < CurrentTick)
+    {
+        return;
+    }
+
+    // The current slot is visited again next time, it may hold expiries later in this tick; after a long stall one full turn covers everything
+    const int64 LastTick = FMath::Min(TargetTick, CurrentTick + Slots.Num() - 1);
+    for (int64 Tick = CurrentTick; Tick <= LastTick; ++Tick)
+    {
+        TArray<FEntry>& Slot = Slots[(int32)(Tick % Slots.Num())];
+        for (int32 Index = Slot.Num() - 1; Index >= 0; --Index)
+        {
+            if (Slot[Index].ExpiryTime <= Now)
+            {
+                OutDue.Add(Slot[Index].Handle);
+                Slot.RemoveAtSwap(Index, 1, false);
+                NumScheduled--;
+            }
+        }
+    }
+    CurrentTick = TargetTick;
+}
@@ -0,0 +1,80 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+// Stable reference to an element of a dense array; goes stale once the element is removed, even if its slot is reused
+struct FSlotHandle
+{
+    int32 Slot = INDEX_NONE;
+    uint32 Generation = 0;
+
+    bool IsValid() const { return Slot != INDEX_NONE; }
+
+    bool operator==(const FSlotHandle& Other) const { return Slot == Other.Slot && Generation == Other.Generation; }
+    bool operator!=(const FSlotHandle& Other) const { return !(*this == Other); }
+};
+
+/**
+ * Maps stable handles to indices in a dense array the caller owns.
+ * The caller appends on Add and calls RemoveAtSwap with the index Remove returns, so both stay in step.
+ */
+class FPSGAME_API FSlotMap
+{
+public:
+    // The new element's dense index is Num() - 1
+    FSlotHandle Add();
+
+    // Frees the handle and returns the dense index to swap-remove; INDEX_NONE for a stale handle
+    int32 Remove(FSlotHandle Handle);
+
+    // INDEX_NONE for a stale handle
+    int32 GetDenseIndex(FSlotHandle Handle) const;
+
+    FSlotHandle GetHandle(int32 DenseIndex) const;
+
+    int32 Num() const { return DenseToSlot.Num(); }
+
+    void Reset();
+
+private:
+    TArray<int32> SlotToDense;
+    TArray<uint32> SlotGenerations;
+    TArray<int32> FreeSlots;
+    TArray<int32> DenseToSlot;
+};
+
+/**
+ * Hashed timing wheel of expiry times for slot handles.
+ * Advance only visits the slots whose time has passed since the last call; expiries further out than one
+ * turn of the wheel stay in their slot until a later turn reaches them.
+ */
+class FPSGAME_API FSlotTimingWheel
+{
+public:
+    explicit FSlotTimingWheel(float InSlotSeconds = 0.05f, int32 InNumSlots = 256);
+
+    // Drops everything scheduled and restarts the wheel at Now
+    void Reset(double Now);
+
+    // Expiries already in the past are due at the next Advance
+    void Schedule(FSlotHandle Handle, double ExpiryTime);
+
+    // Appends every handle due by Now; handles are not checked for staleness
+    void Advance(double Now, TArray<FSlotHandle>& OutDue);
+
+    int32 GetNumScheduled() const { return NumScheduled; }
+
+private:
+    struct FEntry
+    {
+        FSlotHandle Handle;
+        double ExpiryTime = 0.0;
+    };
+
+    TArray<TArray<FEntry>> Slots;
+    float SlotSeconds;
+    int64 CurrentTick = 0;
+    int32 NumScheduled = 0;
+
+    int64 ToTick(double Time) const { return (int64)FMath::FloorToDouble(Time / SlotSeconds); }
+};
@@ -0,0 +1,214 @@
+#include "SoftwareOcclusionBuffer.h"
+#include "Math/VectorRegister.h"
+
+namespace
+{
+    // Box faces as corner index triangles; corners follow FBox min/max per axis bit (X = 1, Y = 2, Z = 4)
+    const int32 BoxTriangles[12][3] =
+    {
+        { 0, 1, 3 }, { 0, 3, 2 }, // -Z
+        { 4, 6, 7 }, { 4, 7, 5 }, // +Z
+        { 0, 4, 5 }, { 0, 5, 1 }, // -Y
+        { 2, 3, 7 }, { 2, 7, 6 }, // +Y
+        { 0, 2, 6 }, { 0, 6, 4 }, // -X
+        { 1, 5, 7 }, { 1, 7, 3 }  // +X
+    };
+
+    FVector GetBoxCorner(const FBox& Box, int32 Index)
+    {
+        return FVector(
+            (Index & 1) ? Box.Max.X : Box.Min.X,
+            (Index & 2) ? Box.Max.Y : Box.Min.Y,
+            (Index & 4) ? Box.Max.Z : Box.Min.Z);
+    }
+
+    const VectorRegister4Float LaneOffsets = MakeVectorRegister(0.5f, 1.5f, 2.5f, 3.5f);
+}
+
+FSoftwareOcclusionBuffer::FSoftwareOcclusionBuffer(int32 InWidth, int32 InHeight)
+{
+    Resize(InWidth, InHeight);
+}
+
+void FSoftwareOcclusionBuffer::Resize(int32 InWidth, int32 InHeight)
+{
+    Width = Align(FMath::Max(InWidth, 4), 4);
+    Height = FMath::Max(InHeight, 1);
+    Depth.SetNumUninitialized(Width * Height);
+    BeginFrame(ViewProjection);
+}
+
+void FSoftwareOcclusionBuffer::BeginFrame(const FMatrix& InViewProjection)
+{
+    ViewProjection = InViewProjection;
+    NumRasterizedTriangles = 0;
+
+    for (float& Value : Depth)
+    {
+        Value = TNumericLimits<float>::Max();
+    }
+}
+
+bool FSoftwareOcclusionBuffer::ProjectPoint(const FVector& WorldPoint, FVector& OutScreen) const
+{
+    const FVector4 Clip = ViewProjection.TransformFVector4(FVector4(WorldPoint, 1.0f));
+    if (Clip.W < MinDepth)
+    {
+        return false;
+    }
+
+    const float InvW = 1.0f / Clip.W;
+    OutScreen.X = (Clip.X * InvW * 0.5f + 0.5f) * Width;
+    OutScreen.Y = (0.5f - Clip.Y * InvW * 0.5f) * Height;
+    OutScreen.Z = Clip.W;
+    return true;
+}
+
+void FSoftwareOcclusionBuffer::RasterizeBox(const FBox& LocalBox, const FTransform& Transform)
+{
+    FVector Screen[8];
+    bool bProjected[8];
+    for (int32 Corner = 0; Corner < 8; ++Corner)
+    {
+        bProjected[Corner] = ProjectPoint(Transform.TransformPosition(GetBoxCorner(LocalBox, Corner)), Screen[Corner]);
+    }
+
+    for (const int32* Triangle : BoxTriangles)
+    {
+        // Triangles crossing the near plane are skipped rather than clipped; that only loses occlusion
+        if (bProjected[Triangle[0]] && bProjected[Triangle[1]] && bProjected[Triangle[2]])
+        {
+            RasterizeTriangle(Screen[Triangle[0]], Screen[Triangle[1]], Screen[Triangle[2]]);
+        }
+    }
+}
+
+void FSoftwareOcclusionBuffer::RasterizeTriangle(const FVector& A, const FVector& B, const FVector& C)
+{
+    const float Area = (B.X - A.X) * (C.Y - A.Y) - (B.Y - A.Y) * (C.X - A.X);
+    if (FMath::Abs(Area) < KINDA_SMALL_NUMBER)
+    {
+        return;
+    }
+
+    const int32 MinX = FMath::Max(0, FMath::FloorToInt(FMath::Min3(A.X, B.X, C.X)));
+    const int32 MaxX = FMath::Min(Width - 1, FMath::CeilToInt(FMath::Max3(A.X, B.X, C.X)));
+    const int32 MinY = FMath::Max(0, FMath::FloorToInt(FMath::Min3(A.Y, B.Y, C.Y)));
+    const int32 MaxY = FMath::Min(Height - 1, FMath::CeilToInt(FMath::Max3(A.Y, B.Y, C.Y)));
+    if (MinX > MaxX || MinY > MaxY)
+    {
+        return;
+    }
+
+    // Edge functions E(x, y) = EdgeA * x + EdgeB * y + EdgeC, oriented so the inside is non-negative
+    const float Sign = Area > 0.0f ? 1.0f : -1.0f;
+    const FVector* Vertices[3] = { &A, &B, &C };
+    VectorRegister4Float EdgeA[3];
+    float EdgeB[3];
+    float EdgeC[3];
+    for (int32 Edge = 0; Edge < 3; ++Edge)
+    {
+        const FVector& From = *Vertices[(Edge + 1) % 3];
+        const FVector& To = *Vertices[(Edge + 2) % 3];
+        EdgeA[Edge] = VectorSetFloat1(Sign * (From.Y - To.Y));
+        EdgeB[Edge] = Sign * (To.X - From.X);
+        EdgeC[Edge] = Sign * ((To.Y - From.Y) * From.X - (To.X - From.X) * From.Y);
+    }
+
+    const VectorRegister4Float TriangleDepth = VectorSetFloat1(FMath::Max3(A.Z, B.Z, C.Z));
+    const VectorRegister4Float Zero = VectorZeroFloat();
+    const int32 StartX = MinX & ~3;
+
+    for (int32 Y = MinY; Y <= MaxY; ++Y)
+    {
+        const float PixelY = Y + 0.5f;
+        VectorRegister4Float RowTerm[3];
+        for (int32 Edge = 0; Edge < 3; ++Edge)
+        {
+            RowTerm[Edge] = VectorSetFloat1(EdgeB[Edge] * PixelY + EdgeC[Edge]);
+        }
+
+        float* Row = Depth.GetData() + Y * Width;
+        for (int32 X = StartX; X <= MaxX; X += 4)
+        {
+            const VectorRegister4Float PixelX = VectorAdd(VectorSetFloat1((float)X), LaneOffsets);
+
+            VectorRegister4Float Inside = VectorCompareGE(VectorMultiplyAdd(EdgeA[0], PixelX, RowTerm[0]), Zero);
+            Inside = VectorBitwiseAnd(Inside, VectorCompareGE(VectorMultiplyAdd(EdgeA[1], PixelX, RowTerm[1]), Zero));
+            Inside = VectorBitwiseAnd(Inside, VectorCompareGE(VectorMultiplyAdd(EdgeA[2], PixelX, RowTerm[2]), Zero));
+
+            if (VectorMaskBits(Inside) != 0)
+            {
+                const VectorRegister4Float Current = VectorLoad(Row + X);
+                VectorStore(VectorSelect(Inside, VectorMin(Current, TriangleDepth), Current), Row + X);
+            }
+        }
+    }
+
+    NumRasterizedTriangles++;
+}
+
+bool FSoftwareOcclusionBuffer::IsBoxOccluded(const FBox& WorldBox) const
+{
+    if (NumRasterizedTriangles == 0 || !WorldBox.IsValid)
+    {
+        return false;
+    }
+
+    float MinScreenX = TNumericLimits<float>::Max();
+    float MinScreenY = TNumericLimits<float>::Max();
+    float MaxScreenX = -TNumericLimits<float>::Max();
+    float MaxScreenY = -TNumericLimits<float>::Max();
+    float NearestDepth = TNumericLimits<float>::Max();
+
+    for (int32 Corner = 0; Corner < 8; ++Corner)
+    {
+        FVector Screen;
+        if (!ProjectPoint(GetBoxCorner(WorldBox, Corner), Screen))
+        {
+            // Reaches the near plane, so it surrounds the viewer
+            return false;
+        }
+
+        MinScreenX = FMath::Min(MinScreenX, Screen.X);
+        MinScreenY = FMath::Min(MinScreenY, Screen.Y);
+        MaxScreenX = FMath::Max(MaxScreenX, Screen.X);
+        MaxScreenY = FMath::Max(MaxScreenY, Screen.Y);
+        NearestDepth = FMath::Min(NearestDepth, Screen.Z);
+    }
+
+    const int32 MinX = FMath::Max(0, FMath::FloorToInt(MinScreenX));
+    const int32 MaxX = FMath::Min(Width - 1, FMath::CeilToInt(MaxScreenX));
+    const int32 MinY = FMath::Max(0, FMath::FloorToInt(MinScreenY));
+    const int32 MaxY = FMath::Min(Height - 1, FMath::CeilToInt(MaxScreenY));
+    if (MinX > MaxX || MinY > MaxY)
+    {
+        // Off screen; that is the frustum test's call, not ours
+        return false;
+    }
+
+    const VectorRegister4Float BoxDepth = VectorSetFloat1(NearestDepth);
+    const VectorRegister4Float RangeMin = VectorSetFloat1((float)MinX);
+    const VectorRegister4Float RangeMax = VectorSetFloat1((float)MaxX + 1.0f);
+    const int32 StartX = MinX & ~3;
+
+    for (int32 Y = MinY; Y <= MaxY; ++Y)
+    {
+        const float* Row = Depth.GetData() + Y * Width;
+        for (int32 X = StartX; X <= MaxX; X += 4)
+        {
+            // Lanes outside the rectangle are masked off
+            const VectorRegister4Float PixelX = VectorAdd(VectorSetFloat1((float)X), LaneOffsets);
+            const VectorRegister4Float InRange = VectorBitwiseAnd(VectorCompareGE(PixelX, RangeMin), VectorCompareLT(PixelX, RangeMax));
+
+            // Any pixel whose occluder is not in front of the box means part of it may be visible
+            const VectorRegister4Float NotHidden = VectorCompareGE(VectorLoad(Row + X), BoxDepth);
+            if (VectorMaskBits(VectorBitwiseAnd(NotHidden, InRange)) != 0)
+            {
+                return false;
+            }
+        }
+    }
+
+    return true;
+}
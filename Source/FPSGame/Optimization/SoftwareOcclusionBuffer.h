@@ -0,0 +1,45 @@
+#pragma once
+
+#include "CoreMinimal.h"
+
+/**
+ * Low-resolution CPU depth buffer for occlusion culling.
+ * Designated occluders are rasterized as boxes; bounds are then tested four pixels at a time.
+ * Needs no GPU or render thread, so it works in headless runs. Safe to test from several threads once built.
+ */
+class FPSGAME_API FSoftwareOcclusionBuffer
+{
+public:
+    FSoftwareOcclusionBuffer(int32 InWidth = 256, int32 InHeight = 128);
+
+    // Width is rounded up to a multiple of four
+    void Resize(int32 InWidth, int32 InHeight);
+
+    // Clears the buffer and sets the view for the following rasterize and test calls
+    void BeginFrame(const FMatrix& InViewProjection);
+
+    // Each triangle is written at its farthest depth, so a convex occluder never hides more than itself
+    void RasterizeBox(const FBox& LocalBox, const FTransform& Transform);
+
+    // True only if every pixel the box could cover already holds a nearer occluder
+    bool IsBoxOccluded(const FBox& WorldBox) const;
+
+    bool HasOccluders() const { return NumRasterizedTriangles > 0; }
+    int32 GetNumRasterizedTriangles() const { return NumRasterizedTriangles; }
+    int32 GetWidth() const { return Width; }
+    int32 GetHeight() const { return Height; }
+
+private:
+    // Screen-space X/Y in pixels, Z is view depth
+    bool ProjectPoint(const FVector& WorldPoint, FVector& OutScreen) const;
+    void RasterizeTriangle(const FVector& A, const FVector& B, const FVector& C);
+
+    TArray<float> Depth;
+    int32 Width = 0;
+    int32 Height = 0;
+    FMatrix ViewProjection = FMatrix::Identity;
+    int32 NumRasterizedTriangles = 0;
+
+    // Points closer than this are treated as crossing the near plane
+    static constexpr float MinDepth = 1.0f;
+};
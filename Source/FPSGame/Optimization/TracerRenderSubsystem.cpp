@@ -0,0 +1,255 @@
+#include "TracerRenderSubsystem.h"
+#include "Components/InstancedStaticMeshComponent.h"
+#include "Engine/StaticMesh.h"
+#include "Engine/World.h"
+#include "Engine/Engine.h"
+#include "GameFramework/Actor.h"
+#include "Materials/MaterialInterface.h"
+
+DEFINE_LOG_CATEGORY_STATIC(LogTracerRender, Log, All);
+
+namespace
+{
+    const TCHAR* DefaultTracerMeshPath = TEXT("/Engine/BasicShapes/Cylinder.Cylinder");
+
+    const float UnitMeshSize = 100.0f;
+}
+
+// FTracerSegmentBuffer
+
+FTracerSegmentBuffer::FTracerSegmentBuffer(int32 InCapacity)
+{
+    Segments.SetNum(FMath::Max(1, InCapacity));
+}
+
+bool FTracerSegmentBuffer::Add(const FVector& Start, const FVector& End, float Speed, double BirthTime, float StreakLength)
+{
+    const FVector Path = End - Start;
+    const float Length = Path.Size();
+    if (Length <= KINDA_SMALL_NUMBER || Speed <= 0.0f)
+    {
+        return false;
+    }
+
+    bool bReplaced = false;
+    if (Count == Segments.Num())
+    {
+        Head = (Head + 1) % Segments.Num();
+        Count--;
+        bReplaced = true;
+    }
+
+    FSegment& Segment = Segments[(Head + Count) % Segments.Num()];
+    Segment.Start = Start;
+    Segment.Direction = Path / Length;
+    Segment.Length = Length;
+    Segment.Speed = Speed;
+    Segment.StreakLength = FMath::Max(StreakLength, 0.0f);
+    Segment.BirthTime = BirthTime;
+    Count++;
+    return bReplaced;
+}
+
+int32 FTracerSegmentBuffer::Update(double Now, TArray<FTracerStreak>& OutStreaks)
+{
+    // Live segments are packed towards the head in the same pass, keeping firing order
+    const int32 Capacity = Segments.Num();
+    int32 Live = 0;
+    for (int32 Index = 0; Index < Count; ++Index)
+    {
+        const FSegment& Segment = Segments[(Head + Index) % Capacity];
+        const float Travelled = Segment.Speed * (float)FMath::Max(Now - Segment.BirthTime, 0.0);
+        const float TailDistance = Travelled - Segment.StreakLength;
+        if (TailDistance >= Segment.Length)
+        {
+            continue;
+        }
+
+        FTracerStreak& Streak = OutStreaks.AddDefaulted_GetRef();
+        Streak.Tail = Segment.Start + Segment.Direction * FMath::Max(TailDistance, 0.0f);
+        Streak.Head = Segment.Start + Segment.Direction * FMath::Min(Travelled, Segment.Length);
+
+        if (Live != Index)
+        {
+            Segments[(Head + Live) % Capacity] = Segment;
+        }
+        Live++;
+    }
+
+    const int32 Expired = Count - Live;
+    Count = Live;
+    return Expired;
+}
+
+void FTracerSegmentBuffer::Reset()
+{
+    Head = 0;
+    Count = 0;
+}
+
+// UTracerRenderSubsystem
+
+void UTracerRenderSubsystem::Deinitialize()
+{
+    if (IsValid(HostActor))
+    {
+        HostActor->Destroy();
+    }
+    HostActor = nullptr;
+    Instances = nullptr;
+    Segments.Reset();
+
+    Super::Deinitialize();
+}
+
+bool UTracerRenderSubsystem::DoesSupportWorldType(const EWorldType::Type WorldType) const
+{
+    return WorldType == EWorldType::Game || WorldType == EWorldType::PIE;
+}
+
+void UTracerRenderSubsystem::Tick(float DeltaTime)
+{
+    if (Segments.Num() == 0 && NumVisibleInstances == 0)
+    {
+        return;
+    }
+
+    Streaks.Reset();
+    Segments.Update(GetWorld()->GetTimeSeconds(), Streaks);
+
+    if (!EnsureInstances())
+    {
+        return;
+    }
+
+    InstanceTransforms.Reset();
+    for (const FTracerStreak& Streak : Streaks)
+    {
+        const FVector Path = Streak.Head - Streak.Tail;
+        const float Length = Path.Size();
+        const FRotator Rotation = FRotationMatrix::MakeFromZ(Length > KINDA_SMALL_NUMBER ? Path / Length : FVector::UpVector).Rotator();
+        const FVector Scale(StreakWidth / UnitMeshSize, StreakWidth / UnitMeshSize, Length / UnitMeshSize);
+        InstanceTransforms.Emplace(Rotation, (Streak.Tail + Streak.Head) * 0.5f, Scale);
+    }
+
+    // Instances are only ever added; those no longer needed are collapsed until a later tracer reuses them
+    const int32 NumLive = InstanceTransforms.Num();
+    for (int32 Index = NumLive; Index < NumVisibleInstances; ++Index)
+    {
+        InstanceTransforms.Emplace(FQuat::Identity, FVector::ZeroVector, FVector::ZeroVector);
+    }
+
+    const int32 NumExisting = Instances->GetInstanceCount();
+    if (InstanceTransforms.Num() > NumExisting)
+    {
+        TArray<FTransform> NewTransforms(InstanceTransforms.GetData() + NumExisting, InstanceTransforms.Num() - NumExisting);
+        InstanceTransforms.SetNum(NumExisting, false);
+        Instances->AddInstances(NewTransforms, false, true);
+    }
+
+    if (InstanceTransforms.Num() > 0)
+    {
+        Instances->BatchUpdateInstancesTransforms(0, InstanceTransforms, true, true, true);
+    }
+    NumVisibleInstances = NumLive;
+}
+
+TStatId UTracerRenderSubsystem::GetStatId() const
+{
+    RETURN_QUICK_DECLARE_CYCLE_STAT(UTracerRenderSubsystem, STATGROUP_Tickables);
+}
+
+UTracerRenderSubsystem* UTracerRenderSubsystem::Get(const UObject* WorldContextObject)
+{
+    UWorld* World = GEngine ? GEngine->GetWorldFromContextObject(WorldContextObject, EGetWorldErrorMode::ReturnNull) : nullptr;
+    return World ? World->GetSubsystem<UTracerRenderSubsystem>() : nullptr;
+}
+
+void UTracerRenderSubsystem::AddTracer(const FVector& Start, const FVector& End, float Speed)
+{
+    if (Segments.Num() == 0 && Segments.GetCapacity() != FMath::Max(1, MaxTracers))
+    {
+        Segments = FTracerSegmentBuffer(MaxTracers);
+    }
+
+    if (Segments.Add(Start, End, Speed, GetWorld()->GetTimeSeconds(), StreakLength))
+    {
+        TotalReplaced++;
+    }
+    TotalTracers++;
+}
+
+void UTracerRenderSubsystem::SetTracerMesh(UStaticMesh* InMesh, UMaterialInterface* InMaterial)
+{
+    TracerMesh = InMesh;
+    TracerMaterial = InMaterial;
+    bHasTracerMesh = InMesh != nullptr || InMaterial != nullptr;
+
+    if (IsValid(Instances))
+    {
+        if (TracerMesh)
+        {
+            Instances->SetStaticMesh(TracerMesh);
+        }
+        Instances->SetMaterial(0, TracerMaterial);
+    }
+}
+
+FString UTracerRenderSubsystem::GenerateTracerReport() const
+{
+    FString Report = TEXT("=== TRACER REPORT ===\n");
+    Report += FString::Printf(TEXT("Live: %d/%d\n"), Segments.Num(), Segments.GetCapacity());
+    Report += FString::Printf(TEXT("Instances: %d\n"), IsValid(Instances) ? Instances->GetInstanceCount() : 0);
+    Report += FString::Printf(TEXT("Fired: %d\n"), TotalTracers);
+    Report += FString::Printf(TEXT("Replaced while full: %d\n"), TotalReplaced);
+    return Report;
+}
+
+bool UTracerRenderSubsystem::EnsureInstances()
+{
+    if (IsValid(Instances))
+    {
+        return true;
+    }
+
+    UWorld* World = GetWorld();
+    if (!World)
+    {
+        return false;
+    }
+
+    if (!TracerMesh)
+    {
+        TracerMesh = LoadObject<UStaticMesh>(nullptr, DefaultTracerMeshPath);
+        if (!TracerMesh)
+        {
+            UE_LOG(LogTracerRender, Warning, TEXT("Tracer mesh %s could not be loaded"), DefaultTracerMeshPath);
+            return false;
+        }
+    }
+
+    FActorSpawnParameters SpawnParams;
+    SpawnParams.Name = MakeUniqueObjectName(World, AActor::StaticClass(), TEXT("Tracers"));
+    SpawnParams.ObjectFlags |= RF_Transient;
+    SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AlwaysSpawn;
+    HostActor = World->SpawnActor<AActor>(AActor::StaticClass(), FTransform::Identity, SpawnParams);
+    if (!HostActor)
+    {
+        return false;
+    }
+
+    Instances = NewObject<UInstancedStaticMeshComponent>(HostActor, NAME_None, RF_Transient);
+    Instances->SetMobility(EComponentMobility::Movable);
+    Instances->SetStaticMesh(TracerMesh);
+    if (TracerMaterial)
+    {
+        Instances->SetMaterial(0, TracerMaterial);
+    }
+    Instances->SetCollisionEnabled(ECollisionEnabled::NoCollision);
+    Instances->SetCastShadow(false);
+    HostActor->SetRootComponent(Instances);
+    Instances->RegisterComponent();
+
+    UE_LOG(LogTracerRender, Log, TEXT("Created instanced tracer batch (%d tracers)"), Segments.GetCapacity());
+    return true;
+}
@@ -0,0 +1,130 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Subsystems/WorldSubsystem.h"
+#include "TracerRenderSubsystem.generated.h"
+
+class UInstancedStaticMeshComponent;
+class UMaterialInterface;
+class UStaticMesh;
+
+// Visible part of a tracer this frame
+struct FTracerStreak
+{
+    FVector Tail = FVector::ZeroVector;
+    FVector Head = FVector::ZeroVector;
+};
+
+/**
+ * Fixed-capacity circular buffer of tracer segments in firing order.
+ * Update walks the live segments once, dropping those that have run past their end and writing the
+ * streak of the rest; once full, a new tracer replaces the oldest.
+ */
+class FPSGAME_API FTracerSegmentBuffer
+{
+public:
+    explicit FTracerSegmentBuffer(int32 InCapacity = 4096);
+
+    // Returns true when the oldest tracer was replaced to make room
+    bool Add(const FVector& Start, const FVector& End, float Speed, double BirthTime, float StreakLength);
+
+    // Appends one streak per live tracer, oldest first; returns the number of tracers that expired
+    int32 Update(double Now, TArray<FTracerStreak>& OutStreaks);
+
+    int32 Num() const { return Count; }
+    int32 GetCapacity() const { return Segments.Num(); }
+
+    void Reset();
+
+private:
+    struct FSegment
+    {
+        FVector Start = FVector::ZeroVector;
+        FVector Direction = FVector::ForwardVector;
+        float Length = 0.0f;
+        float Speed = 0.0f;
+        float StreakLength = 0.0f;
+        double BirthTime = 0.0;
+    };
+
+    TArray<FSegment> Segments;
+    int32 Head = 0;
+    int32 Count = 0;
+};
+
+/**
+ * Per-world tracers drawn as one instanced mesh.
+ * Every tracer's streak is recomputed in a single pass per tick and uploaded as one batch of instance
+ * transforms, so no actor or component exists per tracer.
+ */
+UCLASS()
+class FPSGAME_API UTracerRenderSubsystem : public UTickableWorldSubsystem
+{
+    GENERATED_BODY()
+
+public:
+    // USubsystem interface
+    virtual void Deinitialize() override;
+
+    // FTickableGameObject interface
+    virtual void Tick(float DeltaTime) override;
+    virtual TStatId GetStatId() const override;
+
+    static UTracerRenderSubsystem* Get(const UObject* WorldContextObject);
+
+    // Speed is in units per second
+    UFUNCTION(BlueprintCallable, Category = "Tracers")
+    void AddTracer(const FVector& Start, const FVector& End, float Speed);
+
+    // Unit mesh (100 units along Z) stretched over each streak
+    UFUNCTION(BlueprintCallable, Category = "Tracers")
+    void SetTracerMesh(UStaticMesh* InMesh, UMaterialInterface* InMaterial);
+
+    // False until a mesh or material has been set; tracers would otherwise be drawn as the engine's default cylinder
+    UFUNCTION(BlueprintCallable, Category = "Tracers")
+    bool HasTracerMesh() const { return bHasTracerMesh; }
+
+    UFUNCTION(BlueprintCallable, Category = "Tracers")
+    int32 GetTracerCount() const { return Segments.Num(); }
+
+    UFUNCTION(BlueprintCallable, Category = "Tracers")
+    FString GenerateTracerReport() const;
+
+    // Applies once the buffer is next empty
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tracers")
+    int32 MaxTracers = 4096;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tracers")
+    float StreakLength = 300.0f;
+
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Tracers")
+    float StreakWidth = 1.5f;
+
+protected:
+    virtual bool DoesSupportWorldType(const EWorldType::Type WorldType) const override;
+
+private:
+    UPROPERTY()
+    AActor* HostActor = nullptr;
+
+    UPROPERTY()
+    UInstancedStaticMeshComponent* Instances = nullptr;
+
+    UPROPERTY()
+    UStaticMesh* TracerMesh = nullptr;
+
+    UPROPERTY()
+    UMaterialInterface* TracerMaterial = nullptr;
+
+    FTracerSegmentBuffer Segments;
+    TArray<FTracerStreak> Streaks;
+    TArray<FTransform> InstanceTransforms;
+
+    // Instances drawn last frame; those past the live count are collapsed rather than removed
+    int32 NumVisibleInstances = 0;
+    int32 TotalTracers = 0;
+    int32 TotalReplaced = 0;
+    bool bHasTracerMesh = false;
+
+    bool EnsureInstances();
+};
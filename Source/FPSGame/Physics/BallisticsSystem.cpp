@@ -10,6 +10,8 @@
 #include "Sound/SoundCue.h"
 #include "Engine/DecalActor.h"
 #include "Components/DecalComponent.h"
+#include "Optimization/FPSGameStats.h"
+#include "Optimization/TracerRenderSubsystem.h"
 
 UBallisticsSystem::UBallisticsSystem()
 {
@@ -29,6 +31,8 @@ void UBallisticsSystem::BeginPlay()
 
 void UBallisticsSystem::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
+    FPSGAME_SCOPE_CYCLE_COUNTER(BallisticsTick);
+    
     Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
     
     // Update active bullet simulations
@@ -861,9 +865,12 @@ bool UBallisticsSystem::PerformLineTrace(FVector Start, FVector End, FHitResult&
 
 void UBallisticsSystem::SpawnBulletTracer(FVector Start, FVector End, EAmmoType AmmoType)
 {
-    // Spawn a tracer particle system or mesh
-    // This would typically involve spawning a particle system or niagara effect
-    UE_LOG(LogTemp, Log, TEXT("Spawning tracer from %s to %s"), *Start.ToString(), *End.ToString());
+    // Tracers are segments in the world's instanced tracer buffer, moving at the round's muzzle velocity
+    UTracerRenderSubsystem* Tracers = UTracerRenderSubsystem::Get(this);
+    if (Tracers && Tracers->HasTracerMesh())
+    {
+        Tracers->AddTracer(Start, End, ConvertMetersToUnits(GetBallisticData(AmmoType).MuzzleVelocity));
+    }
 }
 
 void UBallisticsSystem::ApplyBulletTypeModifiers(EBulletType BulletType, FBallisticData& BallisticData)
@@ -0,0 +1,660 @@
+#include "AIPerformanceTests.h"
+#include "Math/RandomStream.h"
+#include "Engine/World.h"
+#include "Engine/StaticMeshActor.h"
+#include "Engine/StaticMesh.h"
+#include "Components/StaticMeshComponent.h"
+#include "GameFramework/WorldSettings.h"
+#include "Misc/FileHelper.h"
+#include "Misc/Paths.h"
+#include "AIController.h"
+#include "Navigation/PathFollowingComponent.h"
+#include "../AI/FPSAICharacter.h"
+#include "../AI/AILODScheduler.h"
+#include "../AI/AISquadBlackboard.h"
+
+DEFINE_LOG_CATEGORY(LogAIPerformanceTest);
+
+//=============================================================================
+// Test Utilities
+//=============================================================================
+
+void AIPerformanceTestUtils::FillRandomInputs(FAIUtilityInputBatch& Batch, int32 NumAgents, int32 Seed)
+{
+    FRandomStream Random(Seed);
+    Batch.Reset(NumAgents);
+
+    for (int32 AgentIndex = 0; AgentIndex < NumAgents; ++AgentIndex)
+    {
+        for (int32 InputIndex = 0; InputIndex < (int32)EAIUtilityInput::Count; ++InputIndex)
+        {
+            Batch.Set(AgentIndex, (EAIUtilityInput)InputIndex, Random.FRand());
+        }
+    }
+}
+
+AIPerformanceTestUtils::FUtilityBenchmarkResult AIPerformanceTestUtils::RunUtilityBenchmark(const FAIUtilityScorer& Scorer, int32 NumAgents, int32 Iterations)
+{
+    FUtilityBenchmarkResult Result;
+    Result.NumAgents = NumAgents;
+    Result.Iterations = Iterations;
+    Result.ActionHistogram.Init(0, Scorer.GetNumActions());
+
+    FAIUtilityInputBatch Batch;
+    FillRandomInputs(Batch, NumAgents, 1337);
+
+    TArray<int32> BestActions;
+
+    // Warm up caches and allocations before timing
+    for (int32 Iteration = 0; Iteration < 10; ++Iteration)
+    {
+        Scorer.EvaluateBatch(Batch, BestActions);
+    }
+
+    const double StartTime = FPlatformTime::Seconds();
+    for (int32 Iteration = 0; Iteration < Iterations; ++Iteration)
+    {
+        Scorer.EvaluateBatch(Batch, BestActions);
+    }
+    Result.TotalMS = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+    Result.MicrosecondsPerAgent = (Result.TotalMS * 1000.0) / FMath::Max(1, NumAgents * Iterations);
+
+    for (int32 BestAction : BestActions)
+    {
+        if (Result.ActionHistogram.IsValidIndex(BestAction))
+        {
+            Result.ActionHistogram[BestAction]++;
+        }
+    }
+
+    return Result;
+}
+
+void AIPerformanceTestUtils::BuildScalabilityArena(UWorld* World, float ArenaSize, int32 NumObstacles, int32 Seed)
+{
+    UStaticMesh* CubeMesh = LoadObject<UStaticMesh>(nullptr, TEXT("/Engine/BasicShapes/Cube.Cube"));
+    if (!World || !CubeMesh)
+    {
+        return;
+    }
+
+    // The engine cube is 100 units on each side
+    auto SpawnBox = [World, CubeMesh](const FVector& Location, const FVector& Scale)
+    {
+        if (AStaticMeshActor* Box = World->SpawnActor<AStaticMeshActor>(Location, FRotator::ZeroRotator))
+        {
+            Box->GetStaticMeshComponent()->SetMobility(EComponentMobility::Movable);
+            Box->GetStaticMeshComponent()->SetStaticMesh(CubeMesh);
+            Box->SetActorScale3D(Scale);
+        }
+    };
+
+    // Floor
+    SpawnBox(FVector(0.0f, 0.0f, -50.0f), FVector(ArenaSize / 100.0f, ArenaSize / 100.0f, 1.0f));
+
+    // Obstacles that break line of sight between the teams
+    FRandomStream Random(Seed);
+    const float HalfExtent = ArenaSize * 0.45f;
+    for (int32 Index = 0; Index < NumObstacles; ++Index)
+    {
+        const FVector Location(Random.FRandRange(-HalfExtent, HalfExtent), Random.FRandRange(-HalfExtent, HalfExtent), 150.0f);
+        SpawnBox(Location, FVector(Random.FRandRange(1.0f, 4.0f), Random.FRandRange(1.0f, 4.0f), 3.0f));
+    }
+}
+
+AIPerformanceTestUtils::FScalabilityResult AIPerformanceTestUtils::RunScalabilityScenario(int32 NumAgents, float SimulatedSeconds, float FixedDeltaTime)
+{
+    FScalabilityResult Result;
+    Result.NumAgents = NumAgents;
+
+    UWorld* World = UWorld::CreateWorld(EWorldType::Game, false);
+    if (!World)
+    {
+        return Result;
+    }
+
+    World->InitializeActorsForPlay(FURL());
+
+    const float ArenaSize = FMath::Max(4000.0f, FMath::Sqrt((float)NumAgents) * 600.0f);
+    BuildScalabilityArena(World, ArenaSize, FMath::Max(8, NumAgents / 5), 2024);
+
+    // Two teams on opposite halves of the arena, in squads of eight
+    FRandomStream Random(NumAgents);
+    FActorSpawnParameters SpawnParams;
+    SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+    TArray<AFPSAICharacter*> Agents;
+    TArray<UAdvancedAISystem*> AISystems;
+    const float HalfExtent = ArenaSize * 0.45f;
+
+    for (int32 Index = 0; Index < NumAgents; ++Index)
+    {
+        const int32 Team = Index % 2;
+        const float X = Team == 0 ? Random.FRandRange(-HalfExtent, -HalfExtent * 0.2f) : Random.FRandRange(HalfExtent * 0.2f, HalfExtent);
+        const FVector Location(X, Random.FRandRange(-HalfExtent, HalfExtent), 100.0f);
+
+        AFPSAICharacter* Agent = World->SpawnActor<AFPSAICharacter>(AFPSAICharacter::StaticClass(), Location, FRotator::ZeroRotator, SpawnParams);
+        if (!Agent)
+        {
+            continue;
+        }
+
+        Agent->SpawnDefaultController();
+
+        UAdvancedAISystem* AISystem = NewObject<UAdvancedAISystem>(Agent, TEXT("AdvancedAISystem"));
+        AISystem->SquadId = FName(*FString::Printf(TEXT("Team%d_Squad%d"), Team, (Index / 2) / 8));
+        Agent->AddInstanceComponent(AISystem);
+        AISystem->RegisterComponent();
+
+        Agents.Add(Agent);
+        AISystems.Add(AISystem);
+    }
+
+    Result.SpawnedAgents = Agents.Num();
+
+    // Worlds created without a game mode need begin play dispatched by hand
+    World->BeginPlay();
+    if (!World->HasBegunPlay())
+    {
+        World->GetWorldSettings()->NotifyBeginPlay();
+    }
+
+    // Pair every agent with an opponent and start the fight
+    UAISquadBlackboard* Blackboard = World->GetSubsystem<UAISquadBlackboard>();
+    for (int32 Index = 0; Index < Agents.Num() && Agents.Num() > 1; ++Index)
+    {
+        AFPSAICharacter* Opponent = Agents.IsValidIndex(Index ^ 1) ? Agents[Index ^ 1] : Agents[(Index + 1) % Agents.Num()];
+
+        AISystems[Index]->CurrentTarget = Opponent;
+        AISystems[Index]->AIMemory.bIsInCombat = true;
+        AISystems[Index]->SetBehaviorState(EAIBehaviorState::Combat);
+
+        Agents[Index]->AlertToLocation(Opponent->GetActorLocation());
+        if (Blackboard)
+        {
+            Blackboard->ReportSighting(Agents[Index], Opponent, Opponent->GetActorLocation());
+        }
+    }
+
+    // Warm up so spawn-time work and first refreshes are not measured
+    const int32 WarmupFrames = 30;
+    const int32 MeasuredFrames = FMath::CeilToInt(SimulatedSeconds / FixedDeltaTime);
+
+    TArray<double> FrameTimes;
+    FrameTimes.Reserve(MeasuredFrames);
+
+    for (int32 Frame = 0; Frame < WarmupFrames + MeasuredFrames; ++Frame)
+    {
+        if (Frame == WarmupFrames)
+        {
+            FAIPerceptionStats::Reset();
+        }
+
+        // Each world tick advances world time by the fixed step, which is what drives the scheduler and budget arbiter
+        const double StartTime = FPlatformTime::Seconds();
+        World->Tick(LEVELTICK_All, FixedDeltaTime);
+        const double FrameMS = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+        if (Frame >= WarmupFrames)
+        {
+            FrameTimes.Add(FrameMS);
+        }
+    }
+
+    Result.Frames = FrameTimes.Num();
+
+    double TotalMS = 0.0;
+    for (double FrameMS : FrameTimes)
+    {
+        TotalMS += FrameMS;
+        Result.MaxFrameMS = FMath::Max(Result.MaxFrameMS, FrameMS);
+    }
+    Result.AverageFrameMS = TotalMS / FMath::Max(1, Result.Frames);
+    Result.P50FrameMS = GetPercentile(FrameTimes, 50.0);
+    Result.P95FrameMS = GetPercentile(FrameTimes, 95.0);
+    Result.P99FrameMS = GetPercentile(FrameTimes, 99.0);
+
+    // Report the worst bucket so far agents cannot hide near-agent latency
+    if (UAILODScheduler* Scheduler = World->GetSubsystem<UAILODScheduler>())
+    {
+        for (int32 LODIndex = 0; LODIndex <= (int32)EAILODLevel::Culled; ++LODIndex)
+        {
+            const EAILODLevel LODLevel = (EAILODLevel)LODIndex;
+            if (Scheduler->GetBucketStats(LODLevel).AgentCount == 0)
+            {
+                continue;
+            }
+
+            Result.LatencyP50MS = FMath::Max(Result.LatencyP50MS, Scheduler->GetBucketLatencyPercentile(LODLevel, 50.0f));
+            Result.LatencyP95MS = FMath::Max(Result.LatencyP95MS, Scheduler->GetBucketLatencyPercentile(LODLevel, 95.0f));
+            Result.LatencyP99MS = FMath::Max(Result.LatencyP99MS, Scheduler->GetBucketLatencyPercentile(LODLevel, 99.0f));
+        }
+    }
+
+    Result.LineOfSightTraces = FAIPerceptionStats::LineOfSightTraces;
+    Result.SharedVisibilityHits = FAIPerceptionStats::SharedVisibilityHits;
+    Result.TracesPerAgentPerSecond = (double)Result.LineOfSightTraces / FMath::Max(1.0, SimulatedSeconds * FMath::Max(1, Result.SpawnedAgents));
+
+    // Destroy agents explicitly so they leave the scheduler and squads through EndPlay
+    for (AFPSAICharacter* Agent : Agents)
+    {
+        if (IsValid(Agent))
+        {
+            Agent->Destroy();
+        }
+    }
+
+    World->DestroyWorld(false);
+
+    return Result;
+}
+
+double AIPerformanceTestUtils::GetPercentile(TArray<double>& Samples, double Percentile)
+{
+    if (Samples.Num() == 0)
+    {
+        return 0.0;
+    }
+
+    Samples.Sort();
+    const int32 Index = FMath::Clamp(FMath::FloorToInt((Percentile / 100.0) * (Samples.Num() - 1)), 0, Samples.Num() - 1);
+    return Samples[Index];
+}
+
+bool AIPerformanceTestUtils::WriteScalabilityCSV(const TArray<FScalabilityResult>& Results, FString& OutPath)
+{
+    FString CSV = TEXT("Agents,Spawned,Frames,AvgFrameMS,P50FrameMS,P95FrameMS,P99FrameMS,MaxFrameMS,LatencyP50MS,LatencyP95MS,LatencyP99MS,Traces,TracesPerAgentPerSecond,SharedVisibilityHits\n");
+
+    for (const FScalabilityResult& Result : Results)
+    {
+        CSV += FString::Printf(TEXT("%d,%d,%d,%.4f,%.4f,%.4f,%.4f,%.4f,%.2f,%.2f,%.2f,%lld,%.3f,%lld\n"),
+            Result.NumAgents,
+            Result.SpawnedAgents,
+            Result.Frames,
+            Result.AverageFrameMS,
+            Result.P50FrameMS,
+            Result.P95FrameMS,
+            Result.P99FrameMS,
+            Result.MaxFrameMS,
+            Result.LatencyP50MS,
+            Result.LatencyP95MS,
+            Result.LatencyP99MS,
+            Result.LineOfSightTraces,
+            Result.TracesPerAgentPerSecond,
+            Result.SharedVisibilityHits);
+    }
+
+    OutPath = FPaths::ProjectSavedDir() / TEXT("Automation") / FString::Printf(TEXT("AIScalability_%s.csv"), *FDateTime::Now().ToString());
+    return FFileHelper::SaveStringToFile(CSV, *OutPath);
+}
+
+//=============================================================================
+// Utility Scoring Tests
+//=============================================================================
+
+bool FAIUtilityScoringBenchmarkTest::RunTest(const FString& Parameters)
+{
+    bool bAllTestsPassed = true;
+
+    const FAIUtilityScorer& Scorer = FAIUtilityScorer::GetDefault();
+    const int32 AgentCounts[] = { 100, 500 };
+    const int32 Iterations = 200;
+
+    TArray<AIPerformanceTestUtils::FUtilityBenchmarkResult> Results;
+
+    for (int32 NumAgents : AgentCounts)
+    {
+        AIPerformanceTestUtils::FUtilityBenchmarkResult Result = AIPerformanceTestUtils::RunUtilityBenchmark(Scorer, NumAgents, Iterations);
+        Results.Add(Result);
+
+        int32 DecidedAgents = 0;
+        for (int32 Count : Result.ActionHistogram)
+        {
+            DecidedAgents += Count;
+        }
+
+        if (DecidedAgents == NumAgents)
+        {
+            AddInfo(FString::Printf(TEXT("Utility scoring %d agents: PASSED - %.3fms per batch, %.3fus per agent"),
+                NumAgents, Result.TotalMS / Iterations, Result.MicrosecondsPerAgent));
+        }
+        else
+        {
+            AddError(FString::Printf(TEXT("Utility scoring %d agents: FAILED - only %d agents received a decision"), NumAgents, DecidedAgents));
+            bAllTestsPassed = false;
+        }
+
+        UE_LOG(LogAIPerformanceTest, Log, TEXT("Utility scoring: %d agents, %.3f us/agent"), NumAgents, Result.MicrosecondsPerAgent);
+    }
+
+    // Cost per agent should stay flat as the batch grows
+    if (Results.Num() == 2 && Results[0].MicrosecondsPerAgent > 0.0)
+    {
+        const double ScalingRatio = Results[1].MicrosecondsPerAgent / Results[0].MicrosecondsPerAgent;
+        AddInfo(FString::Printf(TEXT("Per-agent cost ratio 500/100: %.2f"), ScalingRatio));
+
+        if (ScalingRatio > 3.0)
+        {
+            AddError(FString::Printf(TEXT("Utility scoring does not scale linearly (ratio %.2f)"), ScalingRatio));
+            bAllTestsPassed = false;
+        }
+    }
+
+    return bAllTestsPassed;
+}
+
+bool FAIUtilityScoringConsistencyTest::RunTest(const FString& Parameters)
+{
+    bool bAllTestsPassed = true;
+
+    const FAIUtilityScorer& Scorer = FAIUtilityScorer::GetDefault();
+
+    // The vectorized path must agree with the scalar reference, including the padded tail
+    const int32 NumAgents = 37;
+    FAIUtilityInputBatch Batch;
+    AIPerformanceTestUtils::FillRandomInputs(Batch, NumAgents, 42);
+
+    TArray<int32> BestActions;
+    TArray<float> BestScores;
+    Scorer.EvaluateBatch(Batch, BestActions, &BestScores);
+
+    TestEqual("Batch should produce one decision per agent", BestActions.Num(), NumAgents);
+
+    int32 Mismatches = 0;
+    for (int32 AgentIndex = 0; AgentIndex < NumAgents; ++AgentIndex)
+    {
+        const int32 ScalarBest = Scorer.SelectBestAction(Batch, AgentIndex);
+        const float ScalarScore = Scorer.ScoreAction(Batch, AgentIndex, ScalarBest);
+
+        // Allow ties to resolve differently due to approximate vector exp/pow
+        if (BestActions[AgentIndex] != ScalarBest && !FMath::IsNearlyEqual(BestScores[AgentIndex], ScalarScore, 1.0e-3f))
+        {
+            Mismatches++;
+        }
+    }
+
+    TestEqual("Batch and scalar scoring should agree", Mismatches, 0);
+    bAllTestsPassed &= (Mismatches == 0);
+
+    // A badly hurt, heavily threatened agent should choose to retreat
+    FAIUtilityInputBatch RetreatBatch;
+    RetreatBatch.Reset(1);
+    RetreatBatch.Set(0, EAIUtilityInput::Health, 0.1f);
+    RetreatBatch.Set(0, EAIUtilityInput::Threat, 0.9f);
+    RetreatBatch.Set(0, EAIUtilityInput::Ammo, 0.5f);
+    RetreatBatch.Set(0, EAIUtilityInput::TargetDistance, 0.3f);
+    RetreatBatch.Set(0, EAIUtilityInput::Aggression, 0.5f);
+    RetreatBatch.Set(0, EAIUtilityInput::Teamwork, 0.5f);
+
+    const int32 RetreatAction = Scorer.SelectBestAction(RetreatBatch, 0);
+    const bool bChoseRetreat = RetreatAction != INDEX_NONE && Scorer.GetActionBehavior(RetreatAction) == EAIBehaviorState::Retreat;
+    TestTrue("Low health under threat should select Retreat", bChoseRetreat);
+    bAllTestsPassed &= bChoseRetreat;
+
+    return bAllTestsPassed;
+}
+
+bool FAIMemoryBuffersTest::RunTest(const FString& Parameters)
+{
+    bool bAllTestsPassed = true;
+
+    // Ring buffer keeps the newest elements and drops the oldest
+    TAIRingBuffer<FVector, 4> Positions;
+    for (int32 Index = 0; Index < 6; ++Index)
+    {
+        Positions.Add(FVector(Index, 0.0f, 0.0f));
+    }
+
+    bAllTestsPassed &= TestEqual("Ring buffer should stay at capacity", Positions.Num(), 4);
+    bAllTestsPassed &= TestEqual("Oldest element should be the third added", Positions.Front().X, 2.0);
+    bAllTestsPassed &= TestEqual("Newest element should be the last added", Positions.Last().X, 5.0);
+    bAllTestsPassed &= TestFalse("Duplicate should not be added", Positions.AddUnique(FVector(5.0f, 0.0f, 0.0f)));
+
+    Positions.PopFront();
+    bAllTestsPassed &= TestEqual("PopFront should remove the oldest", Positions.Front().X, 3.0);
+
+    // Threat scores decay with time and the weakest threat is evicted when full
+    UWorld* TestWorld = UWorld::CreateWorld(EWorldType::Game, false);
+    if (!TestWorld)
+    {
+        AddError(TEXT("Failed to create test world"));
+        return false;
+    }
+
+    TAIThreatTable<2> Threats;
+    AActor* StrongThreat = TestWorld->SpawnActor<AActor>();
+    AActor* WeakThreat = TestWorld->SpawnActor<AActor>();
+    AActor* NewThreat = TestWorld->SpawnActor<AActor>();
+
+    Threats.Set(StrongThreat, 5.0f, 0.0);
+    Threats.Set(WeakThreat, 1.0f, 0.0);
+    bAllTestsPassed &= TestTrue("Threat should decay over time", Threats.Get(StrongThreat, 5.0) < 5.0f);
+
+    Threats.Set(NewThreat, 3.0f, 1.0);
+    bAllTestsPassed &= TestEqual("Table should stay at capacity", Threats.Num(), 2);
+    bAllTestsPassed &= TestEqual("Weakest threat should be evicted", Threats.Get(WeakThreat, 1.0), 0.0f);
+
+    Threats.Accumulate(NewThreat, 1.0f, 1.0);
+    bAllTestsPassed &= TestTrue("Accumulate should add to the current score", FMath::IsNearlyEqual(Threats.Get(NewThreat, 1.0), 4.0f));
+
+    Threats.Prune(100.0);
+    bAllTestsPassed &= TestEqual("Forgotten threats should be pruned", Threats.Num(), 0);
+
+    TestWorld->DestroyWorld(false);
+
+    if (bAllTestsPassed)
+    {
+        AddInfo(TEXT("AI memory buffers: PASSED - ring buffer and threat table behave as bounded storage"));
+    }
+
+    return bAllTestsPassed;
+}
+
+//=============================================================================
+// Scheduler Tests
+//=============================================================================
+
+bool FAIWakeWheelTest::RunTest(const FString& Parameters)
+{
+    bool bAllTestsPassed = true;
+
+    UWorld* TestWorld = UWorld::CreateWorld(EWorldType::Game, false);
+    if (!TestWorld)
+    {
+        AddError(TEXT("Failed to create test world"));
+        return false;
+    }
+
+    TestWorld->InitializeActorsForPlay(FURL());
+    TestWorld->BeginPlay();
+
+    UAILODScheduler* Scheduler = TestWorld->GetSubsystem<UAILODScheduler>();
+    if (!Scheduler)
+    {
+        AddError(TEXT("Test world has no AI scheduler"));
+        TestWorld->DestroyWorld(false);
+        return false;
+    }
+
+    // One wake per frame across a whole 100ms wheel tick, each due less than one wheel tick ahead
+    const float FixedDeltaTime = 1.0f / 60.0f;
+    const float WakeDelay = 0.05f;
+    const int32 FirstWakeFrame = 6;
+    const int32 NumWakes = 6;
+
+    TArray<double> ScheduledAt;
+    TArray<double> FiredAt;
+    FiredAt.Init(-1.0, NumWakes);
+
+    for (int32 Frame = 0; Frame < 60; ++Frame)
+    {
+        const int32 WakeIndex = Frame - FirstWakeFrame;
+        if (WakeIndex >= 0 && WakeIndex < NumWakes)
+        {
+            ScheduledAt.Add(TestWorld->GetTimeSeconds());
+            Scheduler->ScheduleWake(WakeDelay, FSimpleDelegate::CreateLambda([&FiredAt, WakeIndex, TestWorld]()
+            {
+                FiredAt[WakeIndex] = TestWorld->GetTimeSeconds();
+            }));
+        }
+
+        TestWorld->Tick(LEVELTICK_All, FixedDeltaTime);
+    }
+
+    for (int32 WakeIndex = 0; WakeIndex < NumWakes; ++WakeIndex)
+    {
+        const double Latency = FiredAt[WakeIndex] - ScheduledAt[WakeIndex];
+        bAllTestsPassed &= TestTrue(*FString::Printf(TEXT("Wake %d should fire"), WakeIndex), FiredAt[WakeIndex] >= 0.0);
+        bAllTestsPassed &= TestTrue(*FString::Printf(TEXT("Wake %d should not fire early"), WakeIndex), Latency >= WakeDelay - KINDA_SMALL_NUMBER);
+
+        // Within two 100ms wheel ticks, not a full revolution of the wheel
+        bAllTestsPassed &= TestTrue(*FString::Printf(TEXT("Wake %d should fire within two wheel ticks"), WakeIndex), Latency <= 0.2 + KINDA_SMALL_NUMBER);
+    }
+
+    bAllTestsPassed &= TestEqual("No wakes left pending", Scheduler->GetPendingWakeCount(), 0);
+
+    TestWorld->DestroyWorld(false);
+
+    if (bAllTestsPassed)
+    {
+        AddInfo(TEXT("AI wake wheel: PASSED - wakes due within the current wheel tick fire on time"));
+    }
+
+    return bAllTestsPassed;
+}
+
+bool FAICachedRouteFollowingTest::RunTest(const FString& Parameters)
+{
+    bool bAllTestsPassed = true;
+
+    UWorld* TestWorld = UWorld::CreateWorld(EWorldType::Game, false);
+    if (!TestWorld)
+    {
+        AddError(TEXT("Failed to create test world"));
+        return false;
+    }
+
+    TestWorld->InitializeActorsForPlay(FURL());
+    AIPerformanceTestUtils::BuildScalabilityArena(TestWorld, 4000.0f, 0, 2024);
+
+    FActorSpawnParameters SpawnParams;
+    SpawnParams.SpawnCollisionHandlingOverride = ESpawnActorCollisionHandlingMethod::AdjustIfPossibleButAlwaysSpawn;
+
+    AFPSAICharacter* Agent = TestWorld->SpawnActor<AFPSAICharacter>(AFPSAICharacter::StaticClass(), FVector(0.0f, 0.0f, 100.0f), FRotator::ZeroRotator, SpawnParams);
+    if (!Agent)
+    {
+        AddError(TEXT("Failed to spawn AI character"));
+        TestWorld->DestroyWorld(false);
+        return false;
+    }
+
+    Agent->SpawnDefaultController();
+
+    TestWorld->BeginPlay();
+    if (!TestWorld->HasBegunPlay())
+    {
+        TestWorld->GetWorldSettings()->NotifyBeginPlay();
+    }
+
+    // Route shaped like a cache hit: starts at the agent and ends within the goal tolerance, not on the goal
+    const FVector Start = Agent->GetActorLocation();
+    const FVector Goal = Start + FVector(600.0f, 600.0f, 0.0f);
+    TArray<FVector> RoutePoints;
+    RoutePoints.Add(Start);
+    RoutePoints.Add(Start + FVector(600.0f, 0.0f, 0.0f));
+    RoutePoints.Add(Goal + FVector(-40.0f, 0.0f, 0.0f));
+
+    bAllTestsPassed &= TestTrue("Cached route should be accepted", Agent->FollowPath(RoutePoints, Goal));
+
+    AAIController* AIController = Cast<AAIController>(Agent->GetController());
+    const UPathFollowingComponent* PathFollowing = AIController ? AIController->GetPathFollowingComponent() : nullptr;
+    const FNavPathSharedPtr Path = PathFollowing ? PathFollowing->GetPath() : FNavPathSharedPtr();
+    bAllTestsPassed &= TestTrue("Route should be followed", Path.IsValid());
+    if (Path.IsValid())
+    {
+        bAllTestsPassed &= TestTrue("Route should not be based on the agent", Path->GetBaseActor() == nullptr);
+        bAllTestsPassed &= TestTrue("Route should end at the exact goal", Path->GetEndLocation().Equals(Goal, 1.0f));
+    }
+
+    const float FixedDeltaTime = 1.0f / 30.0f;
+    for (int32 Frame = 0; Frame < 600 && AIController && AIController->GetMoveStatus() != EPathFollowingStatus::Idle; ++Frame)
+    {
+        TestWorld->Tick(LEVELTICK_All, FixedDeltaTime);
+    }
+
+    const float DistanceToGoal = FVector::Dist2D(Agent->GetActorLocation(), Goal);
+    bAllTestsPassed &= TestTrue("Move should finish", AIController && AIController->GetMoveStatus() == EPathFollowingStatus::Idle);
+    bAllTestsPassed &= TestTrue(*FString::Printf(TEXT("Agent should arrive at the goal (%.0f units away)"), DistanceToGoal),
+        DistanceToGoal <= Agent->GetCapsuleComponent()->GetScaledCapsuleRadius() + 50.0f);
+
+    TestWorld->DestroyWorld(false);
+
+    if (bAllTestsPassed)
+    {
+        AddInfo(TEXT("AI cached route following: PASSED - cached routes are followed to their goal"));
+    }
+
+    return bAllTestsPassed;
+}
+
+//=============================================================================
+// Scalability Tests
+//=============================================================================
+
+bool FAIScalabilityBenchmarkTest::RunTest(const FString& Parameters)
+{
+    bool bAllTestsPassed = true;
+
+    const int32 AgentCounts[] = { 10, 50, 100, 250, 500 };
+    const float SimulatedSeconds = 5.0f;
+    const float FixedDeltaTime = 1.0f / 60.0f;
+
+    TArray<AIPerformanceTestUtils::FScalabilityResult> Results;
+
+    for (int32 NumAgents : AgentCounts)
+    {
+        AIPerformanceTestUtils::FScalabilityResult Result = AIPerformanceTestUtils::RunScalabilityScenario(NumAgents, SimulatedSeconds, FixedDeltaTime);
+        Results.Add(Result);
+
+        if (Result.SpawnedAgents == NumAgents && Result.Frames > 0)
+        {
+            AddInfo(FString::Printf(TEXT("AI scalability %d agents: PASSED - frame avg %.3fms / p95 %.3fms / p99 %.3fms, latency p95 %.1fms, %.2f traces/agent/s"),
+                NumAgents, Result.AverageFrameMS, Result.P95FrameMS, Result.P99FrameMS, Result.LatencyP95MS, Result.TracesPerAgentPerSecond));
+        }
+        else
+        {
+            AddError(FString::Printf(TEXT("AI scalability %d agents: FAILED - spawned %d agents, simulated %d frames"),
+                NumAgents, Result.SpawnedAgents, Result.Frames));
+            bAllTestsPassed = false;
+        }
+
+        UE_LOG(LogAIPerformanceTest, Log, TEXT("AI scalability: %d agents, %.3f ms/frame, %lld traces"), NumAgents, Result.AverageFrameMS, Result.LineOfSightTraces);
+    }
+
+    // Flag superlinear growth between the mid and top counts without failing on noisy machines
+    const AIPerformanceTestUtils::FScalabilityResult& Mid = Results[2];
+    const AIPerformanceTestUtils::FScalabilityResult& Top = Results.Last();
+    if (Mid.AverageFrameMS > 0.0 && Mid.NumAgents > 0)
+    {
+        const double ScalingRatio = (Top.AverageFrameMS / Top.NumAgents) / (Mid.AverageFrameMS / Mid.NumAgents);
+        AddInfo(FString::Printf(TEXT("Per-agent frame cost ratio %d/%d: %.2f"), Top.NumAgents, Mid.NumAgents, ScalingRatio));
+
+        if (ScalingRatio > 2.0)
+        {
+            AddWarning(FString::Printf(TEXT("AI frame cost grows faster than agent count (ratio %.2f)"), ScalingRatio));
+        }
+    }
+
+    FString CSVPath;
+    if (AIPerformanceTestUtils::WriteScalabilityCSV(Results, CSVPath))
+    {
+        AddInfo(FString::Printf(TEXT("AI scalability results written to %s"), *CSVPath));
+    }
+    else
+    {
+        AddError(FString::Printf(TEXT("Failed to write AI scalability results to %s"), *CSVPath));
+        bAllTestsPassed = false;
+    }
+
+    return bAllTestsPassed;
+}
@@ -0,0 +1,82 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Tests/AutomationCommon.h"
+#include "../AI/AIUtilityScoring.h"
+#include "../AI/AdvancedAISystem.h"
+#include "../AI/AIMemoryTypes.h"
+
+DECLARE_LOG_CATEGORY_EXTERN(LogAIPerformanceTest, Log, All);
+
+/**
+ * Performance benchmarks for the AI decision and scheduling systems
+ */
+
+// Utility scoring benchmarks
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAIUtilityScoringBenchmarkTest, "FPSGame.AI.Performance.UtilityScoring",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAIUtilityScoringConsistencyTest, "FPSGame.AI.Unit.UtilityScoringConsistency",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAIMemoryBuffersTest, "FPSGame.AI.Unit.MemoryBuffers",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAIWakeWheelTest, "FPSGame.AI.Unit.WakeWheel",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAICachedRouteFollowingTest, "FPSGame.AI.Unit.CachedRouteFollowing",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+// Headless agent scaling benchmark
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAIScalabilityBenchmarkTest, "FPSGame.AI.Performance.Scalability",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+/**
+ * AI performance test utilities
+ */
+namespace AIPerformanceTestUtils
+{
+    struct FUtilityBenchmarkResult
+    {
+        int32 NumAgents = 0;
+        int32 Iterations = 0;
+        double TotalMS = 0.0;
+        double MicrosecondsPerAgent = 0.0;
+        TArray<int32> ActionHistogram;
+    };
+
+    // Fills a batch with reproducible pseudo-random inputs
+    void FillRandomInputs(FAIUtilityInputBatch& Batch, int32 NumAgents, int32 Seed);
+
+    FUtilityBenchmarkResult RunUtilityBenchmark(const FAIUtilityScorer& Scorer, int32 NumAgents, int32 Iterations);
+
+    struct FScalabilityResult
+    {
+        int32 NumAgents = 0;
+        int32 SpawnedAgents = 0;
+        int32 Frames = 0;
+        double AverageFrameMS = 0.0;
+        double P50FrameMS = 0.0;
+        double P95FrameMS = 0.0;
+        double P99FrameMS = 0.0;
+        double MaxFrameMS = 0.0;
+        float LatencyP50MS = 0.0f;
+        float LatencyP95MS = 0.0f;
+        float LatencyP99MS = 0.0f;
+        int64 LineOfSightTraces = 0;
+        int64 SharedVisibilityHits = 0;
+        double TracesPerAgentPerSecond = 0.0;
+    };
+
+    // Flat arena with a deterministic scatter of box obstacles
+    void BuildScalabilityArena(UWorld* World, float ArenaSize, int32 NumObstacles, int32 Seed);
+
+    // Spawns two opposing teams, forces them into combat and ticks the world at a fixed step
+    FScalabilityResult RunScalabilityScenario(int32 NumAgents, float SimulatedSeconds, float FixedDeltaTime);
+
+    double GetPercentile(TArray<double>& Samples, double Percentile);
+
+    bool WriteScalabilityCSV(const TArray<FScalabilityResult>& Results, FString& OutPath);
+}
@@ -0,0 +1,883 @@
+#include "OptimizationSystemTests.h"
+#include "HAL/Event.h"
+#include "HAL/PlatformProcess.h"
+#include "UObject/Package.h"
+
+bool FOptimizationTaskSchedulerTest::RunTest(const FString& Parameters)
+{
+    bool bAllTestsPassed = true;
+
+    // One worker and a tiny queue, so a single blocked task saturates everything
+    FOptimizationTaskScheduler Scheduler(2, 1);
+
+    FEvent* Gate = FPlatformProcess::GetSynchEventFromPool(true);
+    std::atomic<int32> RunCount{0};
+    int32 CompletionCount = 0;
+
+    bAllTestsPassed &= TestTrue("First task should be accepted", Scheduler.Submit([Gate, &RunCount]()
+    {
+        Gate->Wait();
+        RunCount++;
+    }));
+
+    // Wait until the worker holds the gated task so the queue itself is empty
+    const double WaitStart = FPlatformTime::Seconds();
+    while (Scheduler.GetStats().QueueDepth > 0 && FPlatformTime::Seconds() - WaitStart < 5.0)
+    {
+        FPlatformProcess::Sleep(0.001f);
+    }
+
+    // Same coalesce key twice: the second folds into the first
+    bAllTestsPassed &= TestTrue("Keyed task should be accepted", Scheduler.Submit([&RunCount]() { RunCount++; },
+        EOptimizationTaskPriority::Low, 42, [&CompletionCount]() { CompletionCount++; }));
+    bAllTestsPassed &= TestFalse("Duplicate keyed task should be coalesced", Scheduler.Submit([&RunCount]() { RunCount++; },
+        EOptimizationTaskPriority::Low, 42));
+
+    // Fill the low queue and check that overflow is dropped instead of blocking
+    Scheduler.Submit([&RunCount]() { RunCount++; }, EOptimizationTaskPriority::Low);
+    const double SubmitStart = FPlatformTime::Seconds();
+    bAllTestsPassed &= TestFalse("Submitting to a full queue should drop", Scheduler.Submit([&RunCount]() { RunCount++; }, EOptimizationTaskPriority::Low));
+    bAllTestsPassed &= TestTrue("Dropping should not block", FPlatformTime::Seconds() - SubmitStart < 0.1);
+
+    Gate->Trigger();
+
+    const double DrainStart = FPlatformTime::Seconds();
+    while (Scheduler.GetStats().Completed < 3 && FPlatformTime::Seconds() - DrainStart < 5.0)
+    {
+        FPlatformProcess::Sleep(0.001f);
+    }
+
+    FPlatformProcess::ReturnSynchEventToPool(Gate);
+
+    const FAsyncTaskSchedulerStats Stats = Scheduler.GetStats();
+    bAllTestsPassed &= TestEqual("Accepted tasks should all run", RunCount.load(), 3);
+    bAllTestsPassed &= TestEqual("One task should be coalesced", Stats.Coalesced, 1);
+    bAllTestsPassed &= TestEqual("One task should be dropped", Stats.Dropped, 1);
+
+    // Completions are held until the game thread asks for them
+    bAllTestsPassed &= TestEqual("Completion should wait for the game thread", CompletionCount, 0);
+    Scheduler.ProcessCompletions();
+    bAllTestsPassed &= TestEqual("Completion should run once", CompletionCount, 1);
+
+    Scheduler.Shutdown();
+
+    if (bAllTestsPassed)
+    {
+        AddInfo(FString::Printf(TEXT("Task scheduler: PASSED - drops and coalesces without blocking (wait p99 %.2fms, run p99 %.2fms)"),
+            Stats.WaitTimeP99Ms, Stats.RunTimeP99Ms));
+    }
+
+    return bAllTestsPassed;
+}
+
+bool FSoftwareOcclusionBufferTest::RunTest(const FString& Parameters)
+{
+    bool bAllTestsPassed = true;
+
+    // Camera at the origin looking down +X, same conventions as the culling pass
+    const FMatrix ViewMatrix = FTranslationMatrix(FVector::ZeroVector) * FInverseRotationMatrix(FRotator::ZeroRotator) * FMatrix(
+        FPlane(0, 0, 1, 0),
+        FPlane(1, 0, 0, 0),
+        FPlane(0, 1, 0, 0),
+        FPlane(0, 0, 0, 1));
+    const FMatrix ProjectionMatrix = FReversedZPerspectiveMatrix(FMath::DegreesToRadians(45.0f), 16.0f, 9.0f, 10.0f);
+
+    FSoftwareOcclusionBuffer Buffer(256, 128);
+    Buffer.BeginFrame(ViewMatrix * ProjectionMatrix);
+
+    const FBox BoxOfInterest = FBox::BuildAABB(FVector(3000.0f, 0.0f, 0.0f), FVector(100.0f));
+    bAllTestsPassed &= TestFalse("Nothing should be occluded without occluders", Buffer.IsBoxOccluded(BoxOfInterest));
+
+    // A wall 1000 units ahead covering the middle of the view
+    const FBox WallBox(FVector(-50.0f, -300.0f, -300.0f), FVector(50.0f, 300.0f, 300.0f));
+    Buffer.RasterizeBox(WallBox, FTransform(FVector(1000.0f, 0.0f, 0.0f)));
+    bAllTestsPassed &= TestEqual("Wall should rasterize all twelve triangles", Buffer.GetNumRasterizedTriangles(), 12);
+
+    bAllTestsPassed &= TestTrue("Box behind the wall should be occluded", Buffer.IsBoxOccluded(BoxOfInterest));
+    bAllTestsPassed &= TestFalse("Box in front of the wall should be visible",
+        Buffer.IsBoxOccluded(FBox::BuildAABB(FVector(500.0f, 0.0f, 0.0f), FVector(100.0f))));
+    bAllTestsPassed &= TestFalse("Box beside the wall should be visible",
+        Buffer.IsBoxOccluded(FBox::BuildAABB(FVector(3000.0f, 2500.0f, 0.0f), FVector(100.0f))));
+    bAllTestsPassed &= TestFalse("Occluder should not occlude itself",
+        Buffer.IsBoxOccluded(WallBox.ShiftBy(FVector(1000.0f, 0.0f, 0.0f))));
+    bAllTestsPassed &= TestFalse("Box around the camera should be visible",
+        Buffer.IsBoxOccluded(FBox::BuildAABB(FVector::ZeroVector, FVector(50.0f))));
+
+    // Throughput of the batched bounds test
+    const int32 NumTests = 10000;
+    int32 NumOccluded = 0;
+    const double StartTime = FPlatformTime::Seconds();
+    for (int32 Index = 0; Index < NumTests; ++Index)
+    {
+        const FVector Center(2000.0f + (Index % 100) * 20.0f, ((Index / 100) - 50) * 40.0f, 0.0f);
+        NumOccluded += Buffer.IsBoxOccluded(FBox::BuildAABB(Center, FVector(50.0f))) ? 1 : 0;
+    }
+    const double ElapsedMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+    if (bAllTestsPassed)
+    {
+        AddInfo(FString::Printf(TEXT("Software occlusion: PASSED - %d bounds tested in %.2fms, %d occluded"), NumTests, ElapsedMs, NumOccluded));
+    }
+
+    return bAllTestsPassed;
+}
+
+bool FFrameTelemetryBufferTest::RunTest(const FString& Parameters)
+{
+    bool bAllTestsPassed = true;
+
+    TUniquePtr<FFrameTelemetryBuffer> Buffer = MakeUnique<FFrameTelemetryBuffer>();
+    const int32 ScopeIndex = Buffer->RegisterScope(TEXT("Test"));
+    bAllTestsPassed &= TestEqual("Registering a name twice should return the same scope", Buffer->RegisterScope(TEXT("Test")), ScopeIndex);
+
+    // A steady 60 fps window with two long frames
+    uint64 FrameNumber = 0;
+    for (int32 Frame = 0; Frame < 100; ++Frame)
+    {
+        Buffer->AddScopeCycles(ScopeIndex, FPlatformTime::SecondsToCycles64(0.001));
+        Buffer->RecordFrame(++FrameNumber, (Frame == 30 || Frame == 60) ? 100.0f : 16.0f, 8.0f);
+    }
+
+    bAllTestsPassed &= TestEqual("Window should hold every frame", Buffer->GetNumSamples(), 100);
+    bAllTestsPassed &= TestEqual("Median should sit in the 16ms bucket", Buffer->GetP50Ms(), 16.25f);
+    bAllTestsPassed &= TestEqual("p95 should ignore the outliers", Buffer->GetP95Ms(), 16.25f);
+    bAllTestsPassed &= TestEqual("p99 should reach the outliers", Buffer->GetP99Ms(), 100.25f);
+    bAllTestsPassed &= TestEqual("Each long frame should count as a hitch", Buffer->GetHitchesInWindow(), 2);
+    bAllTestsPassed &= TestEqual("Scope time should average to 1ms", Buffer->GetScopeAverageMs(ScopeIndex), 1.0f, 0.01f);
+
+    FFrameTelemetrySample Sample;
+    bAllTestsPassed &= TestTrue("Newest sample should be readable", Buffer->ReadSample(0, Sample));
+    bAllTestsPassed &= TestTrue("Newest sample should be the last frame", Sample.FrameNumber == FrameNumber);
+    bAllTestsPassed &= TestEqual("Game thread time should be kept", Sample.GameThreadMs, 8.0f);
+
+    // Wrap the ring so the long frames are evicted; statistics must follow without a rebuild
+    for (int32 Frame = 0; Frame < FFrameTelemetryBuffer::Capacity; ++Frame)
+    {
+        Buffer->RecordFrame(++FrameNumber, 16.0f, 8.0f);
+    }
+
+    bAllTestsPassed &= TestEqual("Window should be capped at capacity", Buffer->GetNumSamples(), FFrameTelemetryBuffer::Capacity);
+    bAllTestsPassed &= TestEqual("Evicted hitches should leave the window", Buffer->GetHitchesInWindow(), 0);
+    bAllTestsPassed &= TestEqual("Evicted hitches should stay in the total", Buffer->GetTotalHitches(), 2);
+    bAllTestsPassed &= TestEqual("p99 should drop once the outliers are gone", Buffer->GetP99Ms(), 16.25f);
+    bAllTestsPassed &= TestEqual("Scope time should age out with its frames", Buffer->GetScopeAverageMs(ScopeIndex), 0.0f, 0.01f);
+    bAllTestsPassed &= TestFalse("Frames older than the window should not be readable", Buffer->ReadSample(FFrameTelemetryBuffer::Capacity, Sample));
+
+    // Cost of closing a frame with a full window
+    const int32 NumFrames = 100000;
+    const double StartTime = FPlatformTime::Seconds();
+    for (int32 Frame = 0; Frame < NumFrames; ++Frame)
+    {
+        Buffer->RecordFrame(++FrameNumber, 10.0f + (Frame % 20), 5.0f);
+    }
+    const double ElapsedMs = (FPlatformTime::Seconds() - StartTime) * 1000.0;
+
+    if (bAllTestsPassed)
+    {
+        AddInfo(FString::Printf(TEXT("Frame telemetry: PASSED - %d frames recorded in %.2fms (p99 %.2fms)"), NumFrames, ElapsedMs, Buffer->GetP99Ms()));
+    }
+
+    return bAllTestsPassed;
+}
+
+bool FAdaptiveQualityControllerTest::RunTest(const FString& Parameters)
+{
+    bool bAllTestsPassed = true;
+
+    FAdaptiveQualityController Controller;
+    const float MinLevel = Controller.GetSettings().MinLevel;
+
+    // CPU-bound 40 fps against a 60 fps target, with AI as the dominant cost
+    FAdaptiveQualityInput Input;
+    Input.DeltaSeconds = 0.25f;
+    Input.TargetFrameTimeMs = 16.67f;
+    Input.FrameTimeMs = 25.0f;
+    Input.GameThreadMs = 22.0f;
+    Input.KnobCostMs[(int32)EQualityKnob::AIUpdates] = 4.0f;
+    Input.KnobCostMs[(int32)EQualityKnob::EffectBudget] = 1.0f;
+    Input.KnobCostMs[(int32)EQualityKnob::LODDistance] = 0.2f;
+    Input.KnobCostMs[(int32)EQualityKnob::CullingDistance] = 0.2f;
+
+    FAdaptiveQualityDecision Decision = Controller.Update(Input);
+    bAllTestsPassed &= TestTrue("A slow frame should lower quality", Decision.bChanged);
+    bAllTestsPassed &= TestTrue("A single update should respect the step limit", Decision.Levels[(int32)EQualityKnob::AIUpdates] >= 1.0f - Controller.GetSettings().MaxLevelChange - KINDA_SMALL_NUMBER);
+
+    int32 DegradeUpdates = 1;
+    while (Controller.GetLevel(EQualityKnob::AIUpdates) > MinLevel && DegradeUpdates < 200)
+    {
+        Controller.Update(Input);
+        DegradeUpdates++;
+    }
+    bAllTestsPassed &= TestEqual("Sustained overload should drive the costliest knob to its floor", Controller.GetLevel(EQualityKnob::AIUpdates), MinLevel, 0.001f);
+    bAllTestsPassed &= TestTrue("Cheap knobs should give up less quality", Controller.GetLevel(EQualityKnob::LODDistance) > Controller.GetLevel(EQualityKnob::AIUpdates));
+
+    // Inside the deadband the integrator holds, so the levels settle and then stay put
+    Input.FrameTimeMs = 17.0f;
+    for (int32 Update = 0; Update < 10; ++Update)
+    {
+        Controller.Update(Input);
+    }
+    bool bChangedOnTarget = false;
+    for (int32 Update = 0; Update < 20; ++Update)
+    {
+        bChangedOnTarget |= Controller.Update(Input).bChanged;
+    }
+    bAllTestsPassed &= TestFalse("Levels should hold while on target", bChangedOnTarget);
+    bAllTestsPassed &= TestTrue("Quality should not recover while on target", Controller.GetLevel(EQualityKnob::AIUpdates) < 1.0f);
+
+    // Headroom recovers quality, slower than it was given up
+    Input.FrameTimeMs = 10.0f;
+    int32 RecoveryUpdates = 0;
+    while (Controller.GetLevel(EQualityKnob::AIUpdates) < 1.0f && RecoveryUpdates < 200)
+    {
+        Controller.Update(Input);
+        RecoveryUpdates++;
+    }
+    bAllTestsPassed &= TestEqual("Headroom should restore full quality", Controller.GetLevel(EQualityKnob::AIUpdates), 1.0f);
+    bAllTestsPassed &= TestTrue("Recovery should take longer than degradation", RecoveryUpdates > DegradeUpdates);
+
+    // Render-bound frames lean on draw distance instead of game-thread work
+    Controller.Reset();
+    Input.FrameTimeMs = 25.0f;
+    Input.GameThreadMs = 6.0f;
+    for (int32 Update = 0; Update < 5; ++Update)
+    {
+        Decision = Controller.Update(Input);
+    }
+    bAllTestsPassed &= TestTrue("Render-bound frames should be detected", Decision.bRenderBound);
+    bAllTestsPassed &= TestTrue("Render-bound frames should cut LOD distance before AI", Controller.GetLevel(EQualityKnob::LODDistance) < Controller.GetLevel(EQualityKnob::AIUpdates));
+
+    // A thermal cap lowers every knob even when frames are on target
+    Controller.Reset();
+    Input.FrameTimeMs = 16.67f;
+    Input.MaxLevel = 0.6f;
+    for (int32 Update = 0; Update < 5; ++Update)
+    {
+        Controller.Update(Input);
+    }
+    for (int32 Knob = 0; Knob < (int32)EQualityKnob::Count; ++Knob)
+    {
+        bAllTestsPassed &= TestEqual(FString::Printf(TEXT("%s should sit at the cap"), FAdaptiveQualityController::GetKnobName((EQualityKnob)Knob)), Controller.GetLevel((EQualityKnob)Knob), 0.6f, 0.001f);
+    }
+
+    if (bAllTestsPassed)
+    {
+        AddInfo(FString::Printf(TEXT("Adaptive quality: PASSED - degraded in %d updates, recovered in %d"), DegradeUpdates, RecoveryUpdates));
+    }
+
+    return bAllTestsPassed;
+}
+
+bool FDeterministicBenchmarkTest::RunTest(const FString& Parameters)
+{
+    bool bAllTestsPassed = true;
+
+    FBenchmarkRunSettings Settings;
+    Settings.WarmupFrames = 10;
+    Settings.MeasuredFrames = 120;
+
+    const EBenchmarkScenario Scenarios[] = { EBenchmarkScenario::AIFirefight, EBenchmarkScenario::DestructionBurst, EBenchmarkScenario::EffectSpam };
+    for (EBenchmarkScenario Scenario : Scenarios)
+    {
+        const FString Name = FDeterministicBenchmark::GetScenarioName(Scenario);
+
+        TArray<FBenchmarkScriptEvent> First;
+        TArray<FBenchmarkScriptEvent> Second;
+        FDeterministicBenchmark::BuildScript(Scenario, Settings, First);
+        FDeterministicBenchmark::BuildScript(Scenario, Settings, Second);
+
+        bool bIdentical = First.Num() == Second.Num();
+        bool bOrdered = true;
+        for (int32 Index = 0; bIdentical && Index < First.Num(); ++Index)
+        {
+            bIdentical = First[Index].Frame == Second[Index].Frame && First[Index].Type == Second[Index].Type &&
+                         First[Index].Target == Second[Index].Target && First[Index].Location.Equals(Second[Index].Location, 0.0f);
+            bOrdered &= Index == 0 || First[Index - 1].Frame <= First[Index].Frame;
+        }
+
+        bAllTestsPassed &= TestTrue(FString::Printf(TEXT("%s should script actions"), *Name), First.Num() > 0);
+        bAllTestsPassed &= TestTrue(FString::Printf(TEXT("%s should repeat exactly under the same seed"), *Name), bIdentical);
+        bAllTestsPassed &= TestTrue(FString::Printf(TEXT("%s should be ordered by frame"), *Name), bOrdered);
+
+        FBenchmarkRunSettings Reseeded = Settings;
+        Reseeded.RandomSeed++;
+        FDeterministicBenchmark::BuildScript(Scenario, Reseeded, Second);
+        bool bAnyDifferent = First.Num() != Second.Num();
+        for (int32 Index = 0; !bAnyDifferent && Index < First.Num(); ++Index)
+        {
+            bAnyDifferent = !First[Index].Location.Equals(Second[Index].Location, 0.0f);
+        }
+        bAllTestsPassed &= TestTrue(FString::Printf(TEXT("%s should change with the seed"), *Name), bAnyDifferent);
+    }
+
+    // 1..100ms: nearest-rank percentiles land on exact values
+    TArray<float> FrameTimes;
+    for (int32 Value = 100; Value >= 1; --Value)
+    {
+        FrameTimes.Add((float)Value);
+    }
+
+    TMap<FString, float> Metrics;
+    FDeterministicBenchmark::AddFrameTimeStats(FrameTimes, 33.0f, Metrics);
+    bAllTestsPassed &= TestEqual("Average", Metrics.FindRef(TEXT("FrameTimeAvgMs")), 50.5f, 0.001f);
+    bAllTestsPassed &= TestEqual("p50", Metrics.FindRef(TEXT("FrameTimeP50Ms")), 50.0f);
+    bAllTestsPassed &= TestEqual("p95", Metrics.FindRef(TEXT("FrameTimeP95Ms")), 95.0f);
+    bAllTestsPassed &= TestEqual("p99", Metrics.FindRef(TEXT("FrameTimeP99Ms")), 99.0f);
+    bAllTestsPassed &= TestEqual("Max", Metrics.FindRef(TEXT("FrameTimeMaxMs")), 100.0f);
+    bAllTestsPassed &= TestEqual("Frames over the hitch threshold", Metrics.FindRef(TEXT("Hitches")), 67.0f);
+    bAllTestsPassed &= TestEqual("Empty input should not fault", FDeterministicBenchmark::GetPercentile(TArray<float>(), 0.5f), 0.0f);
+
+    if (bAllTestsPassed)
+    {
+        AddInfo(TEXT("Deterministic benchmark: PASSED - scripts repeat under a seed and stats match nearest-rank percentiles"));
+    }
+
+    return bAllTestsPassed;
+}
+
+bool FFrameBudgetAllocatorTest::RunTest(const FString& Parameters)
+{
+    bool bAllTestsPassed = true;
+
+    // Unbudgeted time follows each frame exactly so every pool below is exact
+    FFrameBudgetSettings Settings;
+    Settings.UnbudgetedSmoothing = 1.0f;
+
+    FFrameBudgetAllocator Allocator;
+    Allocator.SetSettings(Settings);
+
+    const int32 HUD = Allocator.RegisterConsumer(TEXT("HUD"), EFrameBudgetPriority::Critical, 0.0f, 1000.0f);
+    const int32 AI = Allocator.RegisterConsumer(TEXT("AI"), EFrameBudgetPriority::High, 250.0f, 2000.0f);
+    const int32 Effects = Allocator.RegisterConsumer(TEXT("Effects"), EFrameBudgetPriority::Normal, 0.0f, 1000.0f);
+    const int32 Maintenance = Allocator.RegisterConsumer(TEXT("Maintenance"), EFrameBudgetPriority::Low, 0.0f, 1000.0f);
+    bAllTestsPassed &= TestEqual("Registering a known name should return its consumer", Allocator.RegisterConsumer(TEXT("AI"), EFrameBudgetPriority::Low, 0.0f, 0.0f), AI);
+
+    // 10ms target, 8ms for the game thread: 3ms of other work leaves room for everyone
+    Allocator.Allocate(10000.0f, 3000.0f);
+    bAllTestsPassed &= TestEqual("Pool with room", Allocator.GetPoolUs(), 5000.0f, 0.01f);
+    bAllTestsPassed &= TestEqual("HUD with room", Allocator.GetGrantedUs(HUD), 1000.0f, 0.01f);
+    bAllTestsPassed &= TestEqual("AI with room", Allocator.GetGrantedUs(AI), 2000.0f, 0.01f);
+    bAllTestsPassed &= TestEqual("Effects with room", Allocator.GetGrantedUs(Effects), 1000.0f, 0.01f);
+    bAllTestsPassed &= TestEqual("Maintenance with room", Allocator.GetGrantedUs(Maintenance), 1000.0f, 0.01f);
+
+    // 2ms pool: Critical is served whole, High gets the rest, lower priorities nothing
+    Allocator.Allocate(10000.0f, 6000.0f);
+    bAllTestsPassed &= TestEqual("HUD when tight", Allocator.GetGrantedUs(HUD), 1000.0f, 0.01f);
+    bAllTestsPassed &= TestEqual("AI when tight", Allocator.GetGrantedUs(AI), 1000.0f, 0.01f);
+    bAllTestsPassed &= TestEqual("Effects when tight", Allocator.GetGrantedUs(Effects), 0.0f, 0.01f);
+    bAllTestsPassed &= TestEqual("Maintenance when tight", Allocator.GetGrantedUs(Maintenance), 0.0f, 0.01f);
+
+    // Frame already over: minimums only
+    Allocator.Allocate(10000.0f, 20000.0f);
+    bAllTestsPassed &= TestEqual("AI should keep its minimum", Allocator.GetGrantedUs(AI), 250.0f, 0.01f);
+    bAllTestsPassed &= TestEqual("HUD has no minimum", Allocator.GetGrantedUs(HUD), 0.0f, 0.01f);
+
+    Allocator.Allocate(10000.0f, 3000.0f);
+    bAllTestsPassed &= TestEqual("Maintenance after recovery", Allocator.GetGrantedUs(Maintenance), 1000.0f, 0.01f);
+
+    // AI overruns its 2ms grant by 2ms; half the debt comes out of this frame's pool
+    Allocator.ReportUsage(HUD, 400.0f);
+    Allocator.ReportUsage(AI, 4000.0f);
+    bAllTestsPassed &= TestEqual("Remaining budget", Allocator.GetRemainingUs(HUD), 600.0f, 0.01f);
+    bAllTestsPassed &= TestTrue("Overrun consumer has nothing left", Allocator.GetRemainingUs(AI) < 0.0f);
+
+    Allocator.Allocate(10000.0f, 7400.0f);
+    bAllTestsPassed &= TestEqual("Unbudgeted excludes reported use", Allocator.GetUnbudgetedUs(), 3000.0f, 0.01f);
+    bAllTestsPassed &= TestEqual("Pool after overrun", Allocator.GetPoolUs(), 4000.0f, 0.01f);
+    bAllTestsPassed &= TestEqual("Outstanding debt", Allocator.GetOverrunDebtUs(), 1000.0f, 0.01f);
+    bAllTestsPassed &= TestEqual("AI overrun count", Allocator.GetConsumerStats(AI).Overruns, 1);
+    bAllTestsPassed &= TestEqual("HUD overrun count", Allocator.GetConsumerStats(HUD).Overruns, 0);
+    bAllTestsPassed &= TestEqual("Effects after overrun", Allocator.GetGrantedUs(Effects), 1000.0f, 0.01f);
+    bAllTestsPassed &= TestEqual("Maintenance should shrink after an overrun", Allocator.GetGrantedUs(Maintenance), 0.0f, 0.01f);
+
+    Allocator.Allocate(10000.0f, 3000.0f);
+    bAllTestsPassed &= TestEqual("Maintenance while the debt is repaid", Allocator.GetGrantedUs(Maintenance), 500.0f, 0.01f);
+
+    if (bAllTestsPassed)
+    {
+        AddInfo(TEXT("Frame budget: PASSED - priorities fill in order, minimums hold and overruns shrink the lowest priorities"));
+    }
+
+    return bAllTestsPassed;
+}
+
+bool FMemoryPressureResponderTest::RunTest(const FString& Parameters)
+{
+    bool bAllTestsPassed = true;
+
+    const int64 MB = 1024 * 1024;
+    const uint64 Budget = 1000 * MB;
+
+    // Thresholds at 75%, 85% and 92% of the budget, 10s cooldown
+    FMemoryPressureResponder Responder;
+    bAllTestsPassed &= TestTrue("Below the first threshold", Responder.GetTierForPressure(0.5f) == EMemoryPressureTier::None);
+    bAllTestsPassed &= TestTrue("First threshold", Responder.GetTierForPressure(0.8f) == EMemoryPressureTier::TrimPools);
+    bAllTestsPassed &= TestTrue("Second threshold", Responder.GetTierForPressure(0.9f) == EMemoryPressureTier::DropCaches);
+    bAllTestsPassed &= TestTrue("Third threshold", Responder.GetTierForPressure(0.95f) == EMemoryPressureTier::FlushEffectPools);
+
+    TArray<FName> Calls;
+    int64 PoolBytes = 60 * MB;
+    int64 CacheBytes = 300 * MB;
+    Responder.AddReclaimer(EMemoryPressureTier::TrimPools, TEXT("Pools"), FMemoryReclaimDelegate::CreateLambda([&Calls, &PoolBytes]() { Calls.Add(TEXT("Pools")); return PoolBytes; }));
+    Responder.AddReclaimer(EMemoryPressureTier::DropCaches, TEXT("Caches"), FMemoryReclaimDelegate::CreateLambda([&Calls, &CacheBytes]() { Calls.Add(TEXT("Caches")); return CacheBytes; }));
+    const int32 Effects = Responder.AddReclaimer(EMemoryPressureTier::FlushEffectPools, TEXT("Effects"), FMemoryReclaimDelegate::CreateLambda([&Calls, MB]() { Calls.Add(TEXT("Effects")); return 50 * MB; }));
+
+    // 80% used: 50MB over the first threshold, which trimming pools covers
+    TArray<FMemoryReclaimReport> Reports;
+    bAllTestsPassed &= TestTrue("Light pressure only trims pools", Responder.Update(800 * MB, Budget, 100.0, Reports) == EMemoryPressureTier::TrimPools);
+    bAllTestsPassed &= TestEqual("Light pressure reclaimers", Calls.Num(), 1);
+    bAllTestsPassed &= TestEqual("One report per reclaimer run", Reports.Num(), 1);
+    bAllTestsPassed &= TestTrue("Report carries the estimate", Reports.Num() == 1 && Reports[0].EstimatedBytes == PoolBytes && Reports[0].Reclaimer == TEXT("Pools"));
+
+    // Heavy pressure inside the cooldown is left alone
+    Calls.Reset();
+    Reports.Reset();
+    bAllTestsPassed &= TestTrue("Cooldown holds off a response", Responder.Update(950 * MB, Budget, 105.0, Reports) == EMemoryPressureTier::None);
+    bAllTestsPassed &= TestEqual("Nothing runs during the cooldown", Calls.Num(), 0);
+
+    // 95% used: 200MB to find; pools and caches cover it, so effects survive
+    bAllTestsPassed &= TestTrue("Caches cover heavy pressure", Responder.Update(950 * MB, Budget, 111.0, Reports) == EMemoryPressureTier::DropCaches);
+    bAllTestsPassed &= TestTrue("Tiers run cheapest first", Calls.Num() == 2 && Calls[0] == TEXT("Pools") && Calls[1] == TEXT("Caches"));
+
+    // Caches nearly empty: only then are the effect pools flushed
+    Calls.Reset();
+    CacheBytes = 10 * MB;
+    bAllTestsPassed &= TestTrue("Escalates to the last tier", Responder.Update(950 * MB, Budget, 122.0, Reports) == EMemoryPressureTier::FlushEffectPools);
+    bAllTestsPassed &= TestTrue("Every tier ran", Calls.Num() == 3 && Calls[2] == TEXT("Effects"));
+
+    Responder.RemoveReclaimer(Effects);
+    Calls.Reset();
+    Responder.Update(950 * MB, Budget, 133.0, Reports);
+    bAllTestsPassed &= TestEqual("Removed reclaimers are not called", Calls.Num(), 2);
+    bAllTestsPassed &= TestEqual("Removed reclaimers are not counted", Responder.GetNumReclaimers(EMemoryPressureTier::FlushEffectPools), 0);
+
+    Calls.Reset();
+    bAllTestsPassed &= TestTrue("No response under the thresholds", Responder.Update(700 * MB, Budget, 200.0, Reports) == EMemoryPressureTier::None);
+    bAllTestsPassed &= TestEqual("Nothing runs under the thresholds", Calls.Num(), 0);
+
+    if (bAllTestsPassed)
+    {
+        AddInfo(TEXT("Memory pressure: PASSED - tiers escalate in order, stop once the excess is covered and respect the cooldown"));
+    }
+
+    return bAllTestsPassed;
+}
+
+bool FSlotMapTest::RunTest(const FString& Parameters)
+{
+    bool bAllTestsPassed = true;
+
+    // Dense values alongside the map, removed the same way the effects component does
+    FSlotMap SlotMap;
+    TArray<int32> Values;
+    TArray<FSlotHandle> Handles;
+    for (int32 Value = 0; Value < 5; ++Value)
+    {
+        Handles.Add(SlotMap.Add());
+        Values.Add(Value);
+    }
+
+    const int32 RemovedIndex = SlotMap.Remove(Handles[1]);
+    bAllTestsPassed &= TestEqual("Removal frees the handle's dense index", RemovedIndex, 1);
+    Values.RemoveAtSwap(RemovedIndex);
+
+    bAllTestsPassed &= TestEqual("Slot map shrinks", SlotMap.Num(), 4);
+    bAllTestsPassed &= TestEqual("Last element moves into the hole", SlotMap.GetDenseIndex(Handles[4]), 1);
+    bAllTestsPassed &= TestEqual("Moved handle still finds its value", Values[SlotMap.GetDenseIndex(Handles[4])], 4);
+    bAllTestsPassed &= TestEqual("Other handles are untouched", Values[SlotMap.GetDenseIndex(Handles[3])], 3);
+    bAllTestsPassed &= TestTrue("Dense index maps back to its handle", SlotMap.GetHandle(1) == Handles[4]);
+    bAllTestsPassed &= TestEqual("Removed handle is stale", SlotMap.GetDenseIndex(Handles[1]), (int32)INDEX_NONE);
+    bAllTestsPassed &= TestEqual("Removing twice does nothing", SlotMap.Remove(Handles[1]), (int32)INDEX_NONE);
+
+    const FSlotHandle Reused = SlotMap.Add();
+    bAllTestsPassed &= TestEqual("Freed slots are reused", Reused.Slot, Handles[1].Slot);
+    bAllTestsPassed &= TestEqual("Old handle stays stale after reuse", SlotMap.GetDenseIndex(Handles[1]), (int32)INDEX_NONE);
+    bAllTestsPassed &= TestEqual("Reused slot appends", SlotMap.GetDenseIndex(Reused), 4);
+
+    SlotMap.Reset();
+    bAllTestsPassed &= TestEqual("Reset empties the map", SlotMap.Num(), 0);
+    bAllTestsPassed &= TestEqual("Reset invalidates handles", SlotMap.GetDenseIndex(Reused), (int32)INDEX_NONE);
+
+    // 0.1s slots, 8 slots: a 0.8s turn
+    FSlotTimingWheel Wheel(0.1f, 8);
+    Wheel.Reset(10.0);
+    FSlotHandle Short, Long, Late;
+    Short.Slot = 0;
+    Long.Slot = 1;
+    Late.Slot = 2;
+    Wheel.Schedule(Short, 10.25);
+    Wheel.Schedule(Long, 12.05);
+    Wheel.Schedule(Late, 9.0);
+
+    TArray<FSlotHandle> Due;
+    Wheel.Advance(10.05, Due);
+    bAllTestsPassed &= TestTrue("Past expiries are due at once", Due.Num() == 1 && Due[0] == Late);
+
+    Due.Reset();
+    Wheel.Advance(10.2, Due);
+    bAllTestsPassed &= TestEqual("Nothing due early", Due.Num(), 0);
+
+    Wheel.Advance(10.3, Due);
+    bAllTestsPassed &= TestTrue("Due once its time passes", Due.Num() == 1 && Due[0] == Short);
+
+    // Long shares a slot with earlier turns; it must wait for its own
+    Due.Reset();
+    Wheel.Advance(11.3, Due);
+    bAllTestsPassed &= TestEqual("Expiries beyond one turn wait", Due.Num(), 0);
+    bAllTestsPassed &= TestEqual("Still scheduled", Wheel.GetNumScheduled(), 1);
+
+    // A long stall covers the whole wheel in one call
+    Wheel.Advance(20.0, Due);
+    bAllTestsPassed &= TestTrue("Long stall drains the wheel", Due.Num() == 1 && Due[0] == Long);
+    bAllTestsPassed &= TestEqual("Nothing left", Wheel.GetNumScheduled(), 0);
+
+    if (bAllTestsPassed)
+    {
+        AddInfo(TEXT("Slot map: PASSED - swap-remove keeps handles valid and the timing wheel only returns due expiries"));
+    }
+
+    return bAllTestsPassed;
+}
+
+bool FEffectRequestBufferTest::RunTest(const FString& Parameters)
+{
+    bool bAllTestsPassed = true;
+
+    FEffectRequestBuffer Buffer;
+    Buffer.SetMergeRadius(50.0f);
+
+    // Sixteen pellets into the same patch of wall
+    FEffectRequest Impact;
+    Impact.Type = EEffectRequestType::Impact;
+    for (int32 Pellet = 0; Pellet < 16; ++Pellet)
+    {
+        Impact.Location = FVector(1000.0f, 10.0f + Pellet * 2.0f, 110.0f + Pellet);
+        Buffer.Add(Impact);
+    }
+    bAllTestsPassed &= TestEqual("Co-located impacts merge into one", Buffer.Num(), 1);
+    bAllTestsPassed &= TestEqual("Merged request counts its pellets", Buffer.GetRequests()[0].MergedCount, 16);
+    bAllTestsPassed &= TestTrue("First request's placement is kept", Buffer.GetRequests()[0].Location.Equals(FVector(1000.0f, 10.0f, 110.0f)));
+
+    FEffectRequest Decal;
+    Decal.Type = EEffectRequestType::Decal;
+    Decal.Location = Impact.Location;
+    bAllTestsPassed &= TestFalse("Other types never merge", Buffer.Add(Decal));
+
+    Impact.Location = FVector(1000.0f, 500.0f, 110.0f);
+    bAllTestsPassed &= TestFalse("Distant impacts stay separate", Buffer.Add(Impact));
+
+    // Tracers from one muzzle only merge when they also end together
+    FEffectRequest Tracer;
+    Tracer.Type = EEffectRequestType::Tracer;
+    Tracer.Vector = FVector(2000.0f, 0.0f, 0.0f);
+    Buffer.Add(Tracer);
+    Tracer.Vector = FVector(2000.0f, 800.0f, 0.0f);
+    bAllTestsPassed &= TestFalse("Diverging tracers stay separate", Buffer.Add(Tracer));
+    Tracer.Vector = FVector(2010.0f, 805.0f, 0.0f);
+    bAllTestsPassed &= TestTrue("Parallel tracers merge", Buffer.Add(Tracer));
+
+    bAllTestsPassed &= TestEqual("Requests added", Buffer.GetNumAdded(), 21);
+    bAllTestsPassed &= TestEqual("Requests coalesced", Buffer.GetNumCoalesced(), 16);
+
+    // Relevance order, ties in arrival order
+    TArray<FEffectRequest>& Requests = Buffer.GetRequests();
+    const float Relevances[] = { 0.5f, 1.0f, 0.5f, 0.0f, 2.0f };
+    for (int32 Index = 0; Index < Requests.Num(); ++Index)
+    {
+        Requests[Index].Relevance = Relevances[Index];
+    }
+    Buffer.SortByRelevance();
+    bAllTestsPassed &= TestTrue("Most relevant first", Requests[0].Type == EEffectRequestType::Tracer && Requests[0].MergedCount == 2);
+    bAllTestsPassed &= TestTrue("Then the next most relevant", Requests[1].Type == EEffectRequestType::Decal);
+    bAllTestsPassed &= TestTrue("Ties keep arrival order", Requests[2].MergedCount == 16 && Requests[3].Location.Y == 500.0f);
+    bAllTestsPassed &= TestEqual("Irrelevant last", Requests[4].Relevance, 0.0f);
+
+    Buffer.Reset();
+    bAllTestsPassed &= TestEqual("Reset clears the frame", Buffer.Num(), 0);
+    bAllTestsPassed &= TestFalse("Reset clears the merge cells", Buffer.Add(Decal));
+
+    if (bAllTestsPassed)
+    {
+        AddInfo(TEXT("Effect request buffer: PASSED - co-located requests merge by type and rank by relevance"));
+    }
+
+    return bAllTestsPassed;
+}
+
+bool FBulletHoleRingBufferTest::RunTest(const FString& Parameters)
+{
+    bool bAllTestsPassed = true;
+
+    // Eight holes in total, four per 100 unit region
+    FBulletHoleRingBuffer Holes(8, 4, 100.0f);
+    const FVector WallA(10.0f, 10.0f, 10.0f);
+    const FVector WallB(510.0f, 10.0f, 10.0f);
+    const FVector WallC(1010.0f, 10.0f, 10.0f);
+
+    for (int32 Index = 0; Index < 4; ++Index)
+    {
+        Holes.Add(WallA + FVector(0.0f, Index * 5.0f, 0.0f));
+    }
+    bAllTestsPassed &= TestEqual("Region fills up", Holes.GetRegionCount(WallA), 4);
+
+    // A full region recycles its own oldest holes
+    bAllTestsPassed &= TestEqual("Full region reuses its oldest hole", Holes.Add(WallA), 0);
+    bAllTestsPassed &= TestEqual("Then its next oldest", Holes.Add(WallA), 1);
+    bAllTestsPassed &= TestEqual("Full region does not take new slots", Holes.Num(), 4);
+
+    for (int32 Index = 0; Index < 4; ++Index)
+    {
+        Holes.Add(WallB);
+    }
+    bAllTestsPassed &= TestEqual("Capacity reached", Holes.Num(), 8);
+    bAllTestsPassed &= TestEqual("Two regions", Holes.GetNumRegions(), 2);
+
+    // Once full the oldest hole anywhere goes first; recycled holes count as new
+    bAllTestsPassed &= TestEqual("Oldest hole overall is recycled", Holes.Add(WallC), 2);
+    bAllTestsPassed &= TestEqual("Region it came from shrinks", Holes.GetRegionCount(WallA), 3);
+    bAllTestsPassed &= TestEqual("Next oldest is lined up", Holes.GetOldestSlot(), 3);
+
+    Holes.Add(WallC);
+    Holes.Add(WallC);
+    Holes.Add(WallC);
+    bAllTestsPassed &= TestEqual("Emptied region is dropped", Holes.GetNumRegions(), 2);
+    bAllTestsPassed &= TestEqual("Emptied region has no holes", Holes.GetRegionCount(WallA), 0);
+    bAllTestsPassed &= TestEqual("Holes moved to the new region", Holes.GetRegionCount(WallC), 4);
+    bAllTestsPassed &= TestEqual("Untouched region keeps its holes", Holes.GetRegionCount(WallB), 4);
+
+    bAllTestsPassed &= TestEqual("New region recycles its own oldest", Holes.Add(WallC), 2);
+    bAllTestsPassed &= TestEqual("Capacity never grows", Holes.Num(), 8);
+
+    Holes.Reset();
+    bAllTestsPassed &= TestEqual("Reset clears the holes", Holes.Num(), 0);
+    bAllTestsPassed &= TestEqual("Reset clears the regions", Holes.GetNumRegions(), 0);
+    bAllTestsPassed &= TestEqual("Slots restart at zero", Holes.Add(WallB), 0);
+
+    if (bAllTestsPassed)
+    {
+        AddInfo(TEXT("Bullet hole ring buffer: PASSED - holes recycle oldest first within a fixed capacity"));
+    }
+
+    return bAllTestsPassed;
+}
+
+bool FPooledObjectTrackerTest::RunTest(const FString& Parameters)
+{
+    bool bAllTestsPassed = true;
+
+    FPooledObjectTracker Tracker;
+    FPooledObjectBudget Budget;
+    Budget.MaxEffects = 2;
+    Tracker.SetBudget(Budget);
+
+    const int32 Weapon = Tracker.RegisterOwner();
+    const int32 AI = Tracker.RegisterOwner();
+
+    UObject* MuzzleFlash = NewObject<UObject>(GetTransientPackage());
+    UObject* Impact = NewObject<UObject>(GetTransientPackage());
+    UObject* Projectile = NewObject<UObject>(GetTransientPackage());
+    UObject* Gunshot = NewObject<UObject>(GetTransientPackage());
+
+    // The effect budget is shared by every owner
+    const FSlotHandle MuzzleHandle = Tracker.Track(MuzzleFlash, EPooledObjectKind::Effect, Weapon);
+    bAllTestsPassed &= TestTrue("Tracked object gets a handle", MuzzleHandle.IsValid());
+    Tracker.Track(Impact, EPooledObjectKind::Effect, AI);
+    bAllTestsPassed &= TestFalse("Budget reached across owners", Tracker.HasBudget(EPooledObjectKind::Effect));
+    bAllTestsPassed &= TestTrue("Tracking twice keeps the handle", Tracker.Track(MuzzleFlash, EPooledObjectKind::Effect, Weapon) == MuzzleHandle);
+    bAllTestsPassed &= TestEqual("Tracking twice is counted once", Tracker.GetNum(EPooledObjectKind::Effect), 2);
+    bAllTestsPassed &= TestFalse("Unknown owner is refused", Tracker.Track(Gunshot, EPooledObjectKind::Audio, 99).IsValid());
+
+    Tracker.Track(Projectile, EPooledObjectKind::Projectile, AI);
+    bAllTestsPassed &= TestEqual("Counted per owner", Tracker.GetOwnerNum(AI, EPooledObjectKind::Effect), 1);
+    bAllTestsPassed &= TestEqual("Counted per owner and kind", Tracker.GetOwnerNum(AI, EPooledObjectKind::Projectile), 1);
+
+    bAllTestsPassed &= TestTrue("Untrack frees the budget", Tracker.Untrack(Impact) && Tracker.HasBudget(EPooledObjectKind::Effect));
+    bAllTestsPassed &= TestFalse("Untrack twice does nothing", Tracker.Untrack(Impact));
+    Tracker.Track(Impact, EPooledObjectKind::Effect, AI);
+
+    // Finished objects are reported, destroyed ones silently dropped
+    Projectile->MarkAsGarbage();
+    TArray<FTrackedPooledObject> Finished;
+    const int32 Visited = Tracker.Sweep(100, [MuzzleFlash](const FTrackedPooledObject& Entry) { return Entry.Object.Get() == MuzzleFlash; }, Finished);
+    bAllTestsPassed &= TestEqual("Sweep visits every object", Visited, 3);
+    bAllTestsPassed &= TestTrue("Finished object is reported", Finished.Num() == 1 && Finished[0].Object.Get() == MuzzleFlash && Finished[0].Owner == Weapon);
+    bAllTestsPassed &= TestEqual("Destroyed object is dropped", Tracker.GetOwnerNum(AI, EPooledObjectKind::Projectile), 0);
+    bAllTestsPassed &= TestEqual("Unfinished object stays", Tracker.Num(), 1);
+
+    // A bounded sweep resumes from where it stopped
+    Tracker.Track(Gunshot, EPooledObjectKind::Audio, Weapon);
+    Finished.Reset();
+    bAllTestsPassed &= TestEqual("Bounded sweep", Tracker.Sweep(1, [](const FTrackedPooledObject&) { return true; }, Finished), 1);
+    bAllTestsPassed &= TestTrue("Newest object is swept first", Finished.Num() == 1 && Finished[0].Object.Get() == Gunshot);
+
+    // Effects outlive their owner until they finish; projectiles fly on untracked
+    UObject* Rocket = NewObject<UObject>(GetTransientPackage());
+    Tracker.Track(Rocket, EPooledObjectKind::Projectile, AI);
+    Tracker.UnregisterOwner(AI);
+    bAllTestsPassed &= TestFalse("Projectile is no longer tracked", Tracker.IsTracked(Rocket));
+    const FTrackedPooledObject* Orphan = Tracker.Find(Impact);
+    bAllTestsPassed &= TestTrue("Effect stays tracked without an owner", Orphan && Orphan->Owner == INDEX_NONE);
+    bAllTestsPassed &= TestEqual("Orphaned effect still counts against the budget", Tracker.GetNum(EPooledObjectKind::Effect), 1);
+    bAllTestsPassed &= TestEqual("Other owners stay registered", Tracker.GetNumOwners(), 1);
+
+    Finished.Reset();
+    Tracker.Sweep(100, [](const FTrackedPooledObject&) { return true; }, Finished);
+    bAllTestsPassed &= TestTrue("Orphaned effect is swept once finished", Finished.Num() == 1 && Finished[0].Object.Get() == Impact);
+    bAllTestsPassed &= TestEqual("Nothing left tracked", Tracker.Num(), 0);
+
+    if (bAllTestsPassed)
+    {
+        AddInfo(TEXT("Pooled object tracker: PASSED - one budget and one sweep shared by every owner"));
+    }
+
+    return bAllTestsPassed;
+}
+
+bool FTracerSegmentBufferTest::RunTest(const FString& Parameters)
+{
+    bool bAllTestsPassed = true;
+
+    FTracerSegmentBuffer Tracers(3);
+    TArray<FTracerStreak> Streaks;
+
+    // 10m at 10m/s with a 1m streak
+    bAllTestsPassed &= TestFalse("Room to spare", Tracers.Add(FVector::ZeroVector, FVector(1000.0f, 0.0f, 0.0f), 1000.0f, 0.0, 100.0f));
+
+    Tracers.Update(0.05, Streaks);
+    bAllTestsPassed &= TestTrue("Streak grows out of the muzzle", Streaks.Num() == 1 && Streaks[0].Tail.Equals(FVector::ZeroVector) && Streaks[0].Head.Equals(FVector(50.0f, 0.0f, 0.0f)));
+
+    Streaks.Reset();
+    Tracers.Update(0.5, Streaks);
+    bAllTestsPassed &= TestTrue("Streak travels at full length", Streaks.Num() == 1 && Streaks[0].Tail.Equals(FVector(400.0f, 0.0f, 0.0f)) && Streaks[0].Head.Equals(FVector(500.0f, 0.0f, 0.0f)));
+
+    Streaks.Reset();
+    Tracers.Update(1.05, Streaks);
+    bAllTestsPassed &= TestTrue("Streak stops at the end", Streaks.Num() == 1 && Streaks[0].Tail.Equals(FVector(950.0f, 0.0f, 0.0f)) && Streaks[0].Head.Equals(FVector(1000.0f, 0.0f, 0.0f)));
+
+    Streaks.Reset();
+    bAllTestsPassed &= TestEqual("Tracer expires once its tail arrives", Tracers.Update(1.1, Streaks), 1);
+    bAllTestsPassed &= TestEqual("Nothing left to draw", Streaks.Num(), 0);
+    bAllTestsPassed &= TestEqual("Buffer empty", Tracers.Num(), 0);
+
+    bAllTestsPassed &= TestFalse("Zero length tracer is refused", Tracers.Add(FVector::ZeroVector, FVector::ZeroVector, 1000.0f, 0.0, 100.0f));
+
+    // Full buffer replaces the oldest tracer
+    const FVector Long(1000.0f, 0.0f, 0.0f);
+    const FVector Short(100.0f, 0.0f, 0.0f);
+    Tracers.Add(FVector(0.0f, 0.0f, 0.0f), Long, 100.0f, 0.0, 100.0f);
+    Tracers.Add(FVector(0.0f, 100.0f, 0.0f), FVector(0.0f, 100.0f, 0.0f) + Short, 1000.0f, 0.0, 100.0f);
+    Tracers.Add(FVector(0.0f, 200.0f, 0.0f), FVector(0.0f, 200.0f, 0.0f) + Long, 100.0f, 0.0, 100.0f);
+    bAllTestsPassed &= TestTrue("Full buffer replaces", Tracers.Add(FVector(0.0f, 300.0f, 0.0f), FVector(0.0f, 300.0f, 0.0f) + Long, 100.0f, 0.0, 100.0f));
+    bAllTestsPassed &= TestEqual("Capacity is kept", Tracers.Num(), 3);
+
+    // The short tracer expires in the middle; the rest keep firing order
+    Streaks.Reset();
+    bAllTestsPassed &= TestEqual("Expired tracer is dropped", Tracers.Update(0.5, Streaks), 1);
+    bAllTestsPassed &= TestTrue("Oldest survivor first", Streaks.Num() == 2 && Streaks[0].Head.Y == 200.0f && Streaks[1].Head.Y == 300.0f);
+
+    Streaks.Reset();
+    Tracers.Update(0.6, Streaks);
+    bAllTestsPassed &= TestTrue("Packed tracers keep moving", Streaks.Num() == 2 && Streaks[0].Head.Equals(FVector(60.0f, 200.0f, 0.0f)));
+
+    if (bAllTestsPassed)
+    {
+        AddInfo(TEXT("Tracer segment buffer: PASSED - tracers advance, expire and recycle in one pass"));
+    }
+
+    return bAllTestsPassed;
+}
+
+bool FAudioVoiceManagerTest::RunTest(const FString& Parameters)
+{
+    bool bAllTestsPassed = true;
+
+    FAudioVoiceManager Voices;
+    Voices.SetMaxRealVoices(64);
+    Voices.SetLayerLimit(EAudioLayer::Weapon, 16, 1.0f);
+    Voices.SetLayerLimit(EAudioLayer::Ambient, 2, 1.0f);
+
+    FAudioVoice Gunshot;
+    Gunshot.Layer = EAudioLayer::Weapon;
+    Gunshot.MinDistance = 100.0f;
+    Gunshot.MaxDistance = 10000.0f;
+    Gunshot.Duration = 1.0f;
+
+    // 500 concurrent gunshots, each closer than the last so every one past the limit takes a voice
+    TArray<FAudioVoiceChange> Changes;
+    TArray<FSlotHandle> Shots;
+    int32 MostChangesPerShot = 0;
+    int32 MostRealVoices = 0;
+    for (int32 i = 0; i < 500; i++)
+    {
+        Gunshot.Location = FVector(9900.0f - i * 19.0f, 0.0f, 0.0f);
+        Changes.Reset();
+        Shots.Add(Voices.Add(Gunshot, FVector::ZeroVector, Changes));
+        MostChangesPerShot = FMath::Max(MostChangesPerShot, Changes.Num());
+        MostRealVoices = FMath::Max(MostRealVoices, Voices.GetNumReal());
+    }
+
+    bAllTestsPassed &= TestEqual("Real voices never exceed the layer limit", MostRealVoices, 16);
+    bAllTestsPassed &= TestEqual("A shot changes at most one voice besides its own", MostChangesPerShot, 2);
+    bAllTestsPassed &= TestEqual("Every shot is tracked", Voices.Num(), 500);
+    bAllTestsPassed &= TestEqual("Shots over the limit are virtual", Voices.GetNumVirtual(), 484);
+    bAllTestsPassed &= TestTrue("Closest shots are real", Voices.Find(Shots[499])->bReal && Voices.Find(Shots[484])->bReal && !Voices.Find(Shots[483])->bReal);
+
+    // Moving to the far end makes the first shots the loudest; they resume at their playback position
+    const FVector FarEnd(9900.0f, 0.0f, 0.0f);
+    Changes.Reset();
+    bAllTestsPassed &= TestEqual("Nothing finished yet", Voices.Update(0.5, FarEnd, Changes), 0);
+    bAllTestsPassed &= TestEqual("Every real voice swapped", Changes.Num(), 32);
+    bAllTestsPassed &= TestTrue("Demotions come first", !Changes[0].bPromoted && !Changes[15].bPromoted && Changes[16].bPromoted);
+    bAllTestsPassed &= TestTrue("Promoted shot resumes mid-play", FMath::IsNearlyEqual(Changes.Last().StartOffset, 0.5f));
+    bAllTestsPassed &= TestTrue("Audible shots promoted", Voices.Find(Shots[0])->bReal && Voices.Find(Shots[15])->bReal && !Voices.Find(Shots[499])->bReal);
+    bAllTestsPassed &= TestEqual("Still within the layer limit", Voices.GetNumReal(EAudioLayer::Weapon), 16);
+
+    // Virtual shots are dropped once they would have finished; real ones end with their component
+    Changes.Reset();
+    bAllTestsPassed &= TestEqual("Finished virtual shots dropped", Voices.Update(1.5, FarEnd, Changes), 484);
+    bAllTestsPassed &= TestEqual("Real shots kept", Voices.Num(), 16);
+    bAllTestsPassed &= TestEqual("Nothing left to swap", Changes.Num(), 0);
+
+    Voices.Reset();
+    bAllTestsPassed &= TestEqual("Reset frees every voice", Voices.GetNumReal(EAudioLayer::Weapon), 0);
+
+    // Looping sounds keep their place while virtual
+    FAudioVoice Ambient;
+    Ambient.Layer = EAudioLayer::Ambient;
+    Ambient.bIs3D = false;
+    Ambient.bLoop = true;
+    Ambient.Duration = 4.0f;
+    Ambient.StartTime = 1.5;
+
+    Ambient.Volume = 1.0f;
+    const FSlotHandle Loud = Voices.Add(Ambient, FVector::ZeroVector, Changes);
+    Ambient.Volume = 0.5f;
+    const FSlotHandle Quiet = Voices.Add(Ambient, FVector::ZeroVector, Changes);
+
+    Changes.Reset();
+    Ambient.Volume = 0.8f;
+    const FSlotHandle Medium = Voices.Add(Ambient, FVector::ZeroVector, Changes);
+    bAllTestsPassed &= TestTrue("Louder sound takes the quietest voice", Changes.Num() == 2 && Changes[0].Voice == Quiet && !Changes[0].bPromoted && Changes[1].Voice == Medium && Changes[1].bPromoted);
+
+    bAllTestsPassed &= TestTrue("Remove frees the voice", Voices.Remove(Loud));
+    bAllTestsPassed &= TestFalse("Stale handle is refused", Voices.Remove(Loud));
+
+    Changes.Reset();
+    bAllTestsPassed &= TestEqual("Looping sounds are not dropped", Voices.Update(10.0, FVector::ZeroVector, Changes), 0);
+    bAllTestsPassed &= TestTrue("Freed voice goes to the virtual sound", Changes.Num() == 1 && Changes[0].Voice == Quiet && Changes[0].bPromoted);
+    bAllTestsPassed &= TestTrue("Loop resumes within its length", Changes.Num() == 1 && FMath::IsNearlyEqual(Changes[0].StartOffset, 0.5f));
+
+    // Out of range sounds never take a voice, even with voices to spare
+    Voices.Remove(Medium);
+    Changes.Reset();
+    Gunshot.Location = FVector(20000.0f, 0.0f, 0.0f);
+    const FSlotHandle Distant = Voices.Add(Gunshot, FVector::ZeroVector, Changes);
+    bAllTestsPassed &= TestTrue("Inaudible sound stays virtual", Changes.Num() == 0 && !Voices.Find(Distant)->bReal);
+
+    if (bAllTestsPassed)
+    {
+        AddInfo(TEXT("Audio voice manager: PASSED - real voices stay within the limits and virtual voices resume in place"));
+    }
+
+    return bAllTestsPassed;
+}
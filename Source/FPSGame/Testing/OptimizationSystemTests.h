@@ -0,0 +1,61 @@
+#pragma once
+
+#include "CoreMinimal.h"
+#include "Misc/AutomationTest.h"
+#include "Tests/AutomationCommon.h"
+#include "../Optimization/OptimizationTaskScheduler.h"
+#include "../Optimization/SoftwareOcclusionBuffer.h"
+#include "../Optimization/FrameTelemetrySubsystem.h"
+#include "../Optimization/AdaptiveQualityController.h"
+#include "../Optimization/DeterministicBenchmark.h"
+#include "../Optimization/FrameBudgetSubsystem.h"
+#include "../Optimization/MemoryPressureSubsystem.h"
+#include "../Optimization/SlotMap.h"
+#include "../Optimization/EffectRequestBuffer.h"
+#include "../Optimization/BulletHoleSubsystem.h"
+#include "../Optimization/PooledObjectTracker.h"
+#include "../Optimization/TracerRenderSubsystem.h"
+#include "../Audio/AdvancedAudioSystem.h"
+
+/**
+ * Unit tests for the building blocks of the performance optimization systems
+ */
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FOptimizationTaskSchedulerTest, "FPSGame.Optimization.Unit.TaskScheduler",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSoftwareOcclusionBufferTest, "FPSGame.Optimization.Unit.SoftwareOcclusion",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFrameTelemetryBufferTest, "FPSGame.Optimization.Unit.FrameTelemetry",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAdaptiveQualityControllerTest, "FPSGame.Optimization.Unit.AdaptiveQuality",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FDeterministicBenchmarkTest, "FPSGame.Optimization.Unit.DeterministicBenchmark",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FFrameBudgetAllocatorTest, "FPSGame.Optimization.Unit.FrameBudget",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FMemoryPressureResponderTest, "FPSGame.Optimization.Unit.MemoryPressure",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FSlotMapTest, "FPSGame.Optimization.Unit.SlotMap",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FEffectRequestBufferTest, "FPSGame.Optimization.Unit.EffectRequestBuffer",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FBulletHoleRingBufferTest, "FPSGame.Optimization.Unit.BulletHoleRingBuffer",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FPooledObjectTrackerTest, "FPSGame.Optimization.Unit.PooledObjectTracker",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FTracerSegmentBufferTest, "FPSGame.Optimization.Unit.TracerSegmentBuffer",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
+
+IMPLEMENT_SIMPLE_AUTOMATION_TEST(FAudioVoiceManagerTest, "FPSGame.Optimization.Unit.AudioVoiceManager",
+    EAutomationTestFlags::ApplicationContextMask | EAutomationTestFlags::ProductFilter)
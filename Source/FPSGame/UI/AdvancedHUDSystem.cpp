@@ -10,6 +10,9 @@
 #include "TimerManager.h"
 #include "Math/UnrealMathUtility.h"
 #include "Engine/Engine.h"
+#include "Optimization/FrameTelemetrySubsystem.h"
+#include "Optimization/FPSGameStats.h"
+#include "Optimization/FrameBudgetSubsystem.h"
 
 AAdvancedHUDSystem::AAdvancedHUDSystem()
 {
@@ -46,6 +49,12 @@ void AAdvancedHUDSystem::BeginPlay()
     
     InitializeHUD();
     SetupEventBindings();
+    
+    FrameBudget = UFrameBudgetSubsystem::Get(this);
+    if (FrameBudget.IsValid())
+    {
+        FrameBudgetConsumer = FrameBudget->RegisterConsumer(TEXT("HUD"), EFrameBudgetPriority::Critical, 0.0f, PerformanceSettings.FrameBudgetMS * 1000.0f);
+    }
 }
 
 void AAdvancedHUDSystem::Tick(float DeltaTime)
@@ -65,24 +74,42 @@ void AAdvancedHUDSystem::Tick(float DeltaTime)
     
     // Adaptive update intervals based on performance
     float CurrentTime = GetWorld()->GetTimeSeconds();
+    PendingUpdateDeltaTime += DeltaTime;
     
-    // Update elements based on their priority and current performance
-    if (ShouldUpdateElement(EHUDElement::DamageIndicator, CurrentTime))
-    {
-        UpdateDamageIndicators(DeltaTime);
-        ElementUpdateSettings.LastUpdateTimes[EHUDElement::DamageIndicator] = CurrentTime;
-    }
-    
-    if (ShouldUpdateElement(EHUDElement::KillFeed, CurrentTime))
+    if (CurrentTime - LastHUDUpdateTime >= GetBudgetedUpdateInterval(DeltaTime))
     {
-        UpdateKillFeed(DeltaTime);
-        ElementUpdateSettings.LastUpdateTimes[EHUDElement::KillFeed] = CurrentTime;
-    }
-    
-    if (ShouldUpdateElement(EHUDElement::Minimap, CurrentTime))
-    {
-        UpdateMinimap(DeltaTime);
-        ElementUpdateSettings.LastUpdateTimes[EHUDElement::Minimap] = CurrentTime;
+        const uint64 UpdateStartCycles = FPlatformTime::Cycles64();
+        
+        // Skipped frames are folded into the next update so lifetimes still expire on time
+        const float UpdateDeltaTime = PendingUpdateDeltaTime;
+        PendingUpdateDeltaTime = 0.0f;
+        LastHUDUpdateTime = CurrentTime;
+        
+        // Update elements based on their priority and current performance
+        if (ShouldUpdateElement(EHUDElement::DamageIndicator, CurrentTime))
+        {
+            UpdateDamageIndicators(UpdateDeltaTime);
+            ElementUpdateSettings.LastUpdateTimes[EHUDElement::DamageIndicator] = CurrentTime;
+        }
+        
+        if (ShouldUpdateElement(EHUDElement::KillFeed, CurrentTime))
+        {
+            UpdateKillFeed(UpdateDeltaTime);
+            ElementUpdateSettings.LastUpdateTimes[EHUDElement::KillFeed] = CurrentTime;
+        }
+        
+        if (ShouldUpdateElement(EHUDElement::Minimap, CurrentTime))
+        {
+            UpdateMinimap(UpdateDeltaTime);
+            ElementUpdateSettings.LastUpdateTimes[EHUDElement::Minimap] = CurrentTime;
+        }
+        
+        const float UpdateCostUs = (float)(FPlatformTime::ToMilliseconds64(FPlatformTime::Cycles64() - UpdateStartCycles) * 1000.0);
+        AverageUpdateCostUs = FMath::Lerp(AverageUpdateCostUs, UpdateCostUs, 0.1f);
+        if (FrameBudget.IsValid())
+        {
+            FrameBudget->ReportUsage(FrameBudgetConsumer, UpdateCostUs);
+        }
     }
     
     // Update adaptive quality and memory optimization less frequently
@@ -100,6 +127,8 @@ void AAdvancedHUDSystem::Tick(float DeltaTime)
 
 void AAdvancedHUDSystem::DrawHUD()
 {
+    FPSGAME_SCOPE_CYCLE_COUNTER(HUDDraw);
+    
     Super::DrawHUD();
     
     if (!bHUDEnabled) return;
@@ -652,19 +681,19 @@ void AAdvancedHUDSystem::UpdateMinimap(float DeltaTime)
 
 void AAdvancedHUDSystem::UpdatePerformanceMetrics(float DeltaTime)
 {
-    // Update frame time history
-    CurrentPerformanceMetrics.FrameTimeHistory[CurrentPerformanceMetrics.FrameHistoryIndex] = DeltaTime;
-    CurrentPerformanceMetrics.FrameHistoryIndex = 
-        (CurrentPerformanceMetrics.FrameHistoryIndex + 1) % CurrentPerformanceMetrics.FrameHistorySize;
-    
-    // Calculate average frame time
-    float TotalFrameTime = 0.0f;
-    for (float FrameTime : CurrentPerformanceMetrics.FrameTimeHistory)
+    // Average frame time from the shared telemetry, or this frame's delta before it has samples
+    const UFrameTelemetrySubsystem* Telemetry = UFrameTelemetrySubsystem::Get(this);
+    if (Telemetry && Telemetry->GetBuffer().GetNumSamples() > 0)
+    {
+        CurrentPerformanceMetrics.AverageFrameTime = 
+            Telemetry->GetBuffer().GetAverageFrameTimeMs(CurrentPerformanceMetrics.FrameAverageWindow) / 1000.0f;
+    }
+    else
     {
-        TotalFrameTime += FrameTime;
+        CurrentPerformanceMetrics.AverageFrameTime = DeltaTime;
     }
-    CurrentPerformanceMetrics.AverageFrameTime = TotalFrameTime / CurrentPerformanceMetrics.FrameHistorySize;
-    CurrentPerformanceMetrics.CurrentFPS = 1.0f / CurrentPerformanceMetrics.AverageFrameTime;
+    CurrentPerformanceMetrics.CurrentFPS = CurrentPerformanceMetrics.AverageFrameTime > 0.0f ? 
+        1.0f / CurrentPerformanceMetrics.AverageFrameTime : 0.0f;
     
     // Update memory usage
     CurrentPerformanceMetrics.MemoryUsageMB = GetUsedMemoryMB();
@@ -723,6 +752,24 @@ void AAdvancedHUDSystem::ApplyPerformanceOptimizations()
     );
 }
 
+float AAdvancedHUDSystem::GetBudgetedUpdateInterval(float DeltaTime) const
+{
+    if (!FrameBudget.IsValid() || FrameBudgetConsumer == INDEX_NONE)
+    {
+        return HUDUpdateInterval;
+    }
+    
+    const float GrantedUs = FrameBudget->GetBudgetUs(FrameBudgetConsumer);
+    if (AverageUpdateCostUs <= GrantedUs)
+    {
+        return HUDUpdateInterval;
+    }
+    
+    // Spread each update over enough frames that its average cost fits the grant
+    const float FramesPerUpdate = GrantedUs > 0.0f ? AverageUpdateCostUs / GrantedUs : BIG_NUMBER;
+    return FMath::Max(HUDUpdateInterval, FMath::Min(FramesPerUpdate * DeltaTime, PerformanceSettings.MaxUpdateInterval));
+}
+
 bool AAdvancedHUDSystem::ShouldUpdateElement(EHUDElement Element, float CurrentTime)
 {
     // Check if element exists in update settings
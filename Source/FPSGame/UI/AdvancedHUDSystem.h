@@ -18,6 +18,7 @@ class AFPSCharacter;
 class UFPSWeapon;
 class UInventoryComponent;
 class UDamageComponent;
+class UFrameBudgetSubsystem;
 
 UENUM(BlueprintType)
 enum class EHUDElement : uint8
@@ -358,6 +359,12 @@ protected:
     // Performance Optimization
     float LastHUDUpdateTime = 0.0f;
     float HUDUpdateInterval = 0.016f; // ~60 FPS
+    float PendingUpdateDeltaTime = 0.0f;
+    
+    // Element updates are a Critical consumer of the frame budget arbiter
+    TWeakObjectPtr<UFrameBudgetSubsystem> FrameBudget;
+    int32 FrameBudgetConsumer = INDEX_NONE;
+    float AverageUpdateCostUs = 0.0f;
     
     // Enhanced Performance Optimization
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Performance")
@@ -393,6 +400,10 @@ protected:
         UPROPERTY(EditAnywhere, BlueprintReadWrite)
         float MaxMemoryUsageMB = 256.0f;
         
+        // Game-thread time per frame requested from the frame budget arbiter for element updates
+        UPROPERTY(EditAnywhere, BlueprintReadWrite)
+        float FrameBudgetMS = 0.5f;
+        
         FHUDPerformanceSettings()
         {
             bEnablePerformanceOptimization = true;
@@ -405,6 +416,7 @@ protected:
             HighPerformanceThreshold = 90.0f;
             bEnableMemoryOptimization = true;
             MaxMemoryUsageMB = 256.0f;
+            FrameBudgetMS = 0.5f;
         }
     } PerformanceSettings;
     
@@ -421,18 +433,9 @@ protected:
         int32 VisibleElements = 0;
         int32 CulledElements = 0;
         float OptimizationTimer = 0.0f;
-        TArray<float> FrameTimeHistory;
-        int32 FrameHistoryIndex = 0;
-        static const int32 FrameHistorySize = 30;
         
-        FHUDPerformanceMetrics()
-        {
-            FrameTimeHistory.SetNum(FrameHistorySize);
-            for (int32 i = 0; i < FrameHistorySize; ++i)
-            {
-                FrameTimeHistory[i] = 0.016f; // Default to 60 FPS
-            }
-        }
+        // Frames averaged from the shared frame telemetry
+        static const int32 FrameAverageWindow = 30;
     } CurrentPerformanceMetrics;
     
     // Smart update intervals for different HUD elements
@@ -510,6 +513,10 @@ protected:
     UFUNCTION(BlueprintCallable, Category = "Performance")
     bool ShouldUpdateElement(EHUDElement Element, float CurrentTime);
     
+    // HUDUpdateInterval, stretched when the element updates cost more than the HUD's frame grant
+    UFUNCTION(BlueprintCallable, Category = "Performance")
+    float GetBudgetedUpdateInterval(float DeltaTime) const;
+    
     UFUNCTION(BlueprintCallable, Category = "Performance")
     void UpdateAdaptiveQuality();
     
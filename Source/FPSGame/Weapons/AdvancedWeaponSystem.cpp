@@ -18,6 +18,8 @@
 #include "Particles/ParticleSystemComponent.h"
 #include "Camera/CameraShakeBase.h"
 #include "WeaponPoolingIntegrationComponent.h"
+#include "Optimization/PooledWeaponEffectsComponent.h"
+#include "Optimization/TracerRenderSubsystem.h"
 
 DEFINE_LOG_CATEGORY(LogAdvancedWeapon);
 
@@ -87,6 +89,8 @@ void UAdvancedWeaponSystem::BeginPlay()
         PoolingComponent->InitializeForWeapon(this);
     }
     
+    EffectsComponent = GetOwner() ? GetOwner()->FindComponentByClass<UPooledWeaponEffectsComponent>() : nullptr;
+    
     // Set up timers
     GetWorld()->GetTimerManager().SetTimer(
         DurabilityTimer,
@@ -374,15 +378,7 @@ void UAdvancedWeaponSystem::PerformHitscan(const FVector& StartLocation, const F
             float Damage = CalculateDamage(Hit);
             ApplyDamage(Hit.GetActor(), Damage, Hit);
             
-            // Spawn impact effects using pooled objects
-            if (PoolingComponent)
-            {
-                PoolingComponent->SpawnImpactEffect(Hit.Location, Hit.Normal, Hit.PhysMaterial.Get());
-            }
-            else
-            {
-                SpawnImpactEffects(Hit);
-            }
+            SpawnImpactEffects(Hit);
         }
     }
 }
@@ -619,8 +615,12 @@ FVector UAdvancedWeaponSystem::GetMuzzleLocation() const
 
 void UAdvancedWeaponSystem::PlayFireEffects()
 {
-    // Use pooled muzzle flash if available
-    if (PoolingComponent)
+    // Requested flashes from every weapon are merged and ranked before any is spawned
+    if (EffectsComponent)
+    {
+        EffectsComponent->RequestMuzzleFlash(GetMuzzleLocation(), GetOwner()->GetActorRotation(), MuzzleFlashEffect);
+    }
+    else if (PoolingComponent)
     {
         PoolingComponent->PlayMuzzleFlash(GetMuzzleLocation(), GetOwner()->GetActorRotation());
     }
@@ -681,8 +681,12 @@ void UAdvancedWeaponSystem::PlayReloadEffects()
 
 void UAdvancedWeaponSystem::SpawnImpactEffects(const FHitResult& Hit)
 {
-    // Use pooled impact effects if available
-    if (PoolingComponent)
+    // Use requested or pooled impact effects if available
+    if (EffectsComponent)
+    {
+        EffectsComponent->RequestImpactEffect(Hit.Location, Hit.Normal.Rotation(), Hit, ImpactEffect);
+    }
+    else if (PoolingComponent)
     {
         PoolingComponent->SpawnImpactEffect(Hit.Location, Hit.Normal, Hit.PhysMaterial.Get());
     }
@@ -1132,8 +1136,12 @@ void UAdvancedWeaponSystem::SpawnShellEjection()
     FVector EjectionLocation = GetShellEjectionLocation();
     FRotator EjectionRotation = GetOwner()->GetActorRotation();
     
-    // Use pooled shell ejection if available
-    if (PoolingComponent)
+    // Use requested or pooled shell ejection if available
+    if (EffectsComponent)
+    {
+        EffectsComponent->RequestShellEject(EjectionLocation, EjectionRotation, GetShellEjectionVelocity());
+    }
+    else if (PoolingComponent)
     {
         PoolingComponent->SpawnShellEjection(EjectionLocation, EjectionRotation, GetShellEjectionVelocity());
     }
@@ -1157,8 +1165,17 @@ void UAdvancedWeaponSystem::SpawnTracer(const FVector& StartLocation, const FVec
         return;
     }
     
-    // Use pooled tracer if available
-    if (PoolingComponent)
+    // One instanced batch draws every tracer in the world, once it has been given something to draw them with
+    UTracerRenderSubsystem* Tracers = UTracerRenderSubsystem::Get(this);
+    if (Tracers && (bUseInstancedTracers || Tracers->HasTracerMesh()))
+    {
+        Tracers->AddTracer(StartLocation, EndLocation, MuzzleVelocity);
+    }
+    else if (EffectsComponent)
+    {
+        EffectsComponent->RequestBulletTracer(StartLocation, EndLocation, MuzzleVelocity);
+    }
+    else if (PoolingComponent)
     {
         PoolingComponent->SpawnTracer(StartLocation, EndLocation, MuzzleVelocity);
     }
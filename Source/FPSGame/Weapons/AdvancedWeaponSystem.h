@@ -17,6 +17,7 @@ class AAdvancedHUDSystem;
 class AAdvancedAudioSystem;
 class UAdvancedWeaponComponent;
 class UWeaponPoolingIntegrationComponent;
+class UPooledWeaponEffectsComponent;
 class AAdvancedAudioSystem;
 class UAdvancedWeaponComponent;
 
@@ -238,6 +239,10 @@ public:
     UPROPERTY(VisibleAnywhere, BlueprintReadOnly, Category = "Components")
     UWeaponPoolingIntegrationComponent* PoolingComponent;
 
+    // The owner's effects component, if it has one; effects are requested from it and spawned in relevance order
+    UPROPERTY(Transient)
+    UPooledWeaponEffectsComponent* EffectsComponent = nullptr;
+
     // Weapon Configuration
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Weapon Config", Replicated)
     FWeaponStats WeaponStats;
@@ -307,6 +312,10 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VFX")
     UParticleSystem* TracerEffect;
 
+    // Draw tracers through the world's instanced tracer buffer even when no tracer mesh has been set on it
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "VFX")
+    bool bUseInstancedTracers = false;
+
     // Core Weapon Functions
     UFUNCTION(BlueprintCallable, Category = "Weapon")
     virtual void StartFiring();
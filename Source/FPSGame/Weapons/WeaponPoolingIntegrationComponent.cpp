@@ -7,6 +7,8 @@
 #include "Sound/SoundCue.h"
 #include "Materials/MaterialInterface.h"
 #include "Engine/DecalActor.h"
+#include "Optimization/BulletHoleSubsystem.h"
+#include "Optimization/PooledObjectTracker.h"
 
 DEFINE_LOG_CATEGORY(LogWeaponPoolingIntegration);
 
@@ -28,6 +30,17 @@ void UWeaponPoolingIntegrationComponent::BeginPlay()
         return;
     }
     
+    // Active objects are swept once per world rather than by every weapon; without the tracker
+    // nothing would return finished effects, audio and decals, so the weapon does not pool at all
+    PooledObjects = UPooledObjectTrackerSubsystem::Get(this);
+    if (!PooledObjects.IsValid())
+    {
+        UE_LOG(LogWeaponPoolingIntegration, Error, TEXT("Failed to find PooledObjectTrackerSubsystem"));
+        ObjectPoolManager = nullptr;
+        return;
+    }
+    PooledObjectOwner = PooledObjects->RegisterOwner();
+    
     // Find ballistics system
     if (AActor* Owner = GetOwner())
     {
@@ -44,22 +57,33 @@ void UWeaponPoolingIntegrationComponent::BeginPlay()
     UE_LOG(LogWeaponPoolingIntegration, Log, TEXT("WeaponPoolingIntegrationComponent initialized"));
 }
 
+void UWeaponPoolingIntegrationComponent::EndPlay(const EEndPlayReason::Type EndPlayReason)
+{
+    // Effects still playing are returned by the tracker sweep once they finish; projectiles fly on
+    if (PooledObjects.IsValid())
+    {
+        PooledObjects->UnregisterOwner(PooledObjectOwner);
+    }
+    PooledObjectOwner = INDEX_NONE;
+    
+    Super::EndPlay(EndPlayReason);
+}
+
 void UWeaponPoolingIntegrationComponent::TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction)
 {
     Super::TickComponent(DeltaTime, TickType, ThisTickFunction);
     
     float CurrentTime = GetWorld()->GetTimeSeconds();
-    if (CurrentTime - LastCleanupTime >= CleanupInterval)
+    if (CurrentTime - LastStatisticsTime >= StatisticsInterval)
     {
-        CleanupFinishedObjects();
         UpdatePoolingStatistics();
-        LastCleanupTime = CurrentTime;
+        LastStatisticsTime = CurrentTime;
     }
 }
 
 AActor* UWeaponPoolingIntegrationComponent::SpawnPooledProjectile(TSubclassOf<AActor> ProjectileClass, const FVector& Location, const FRotator& Rotation, EAmmoType AmmoType)
 {
-    if (!ObjectPoolManager || !ProjectileClass || !bUsePooledProjectiles)
+    if (!ObjectPoolManager || !ProjectileClass || !bUsePooledProjectiles || !HasPooledObjectBudget(EPooledObjectKind::Projectile))
     {
         return nullptr;
     }
@@ -74,7 +98,7 @@ AActor* UWeaponPoolingIntegrationComponent::SpawnPooledProjectile(TSubclassOf<AA
         Projectile->SetActorHiddenInGame(false);
         Projectile->SetActorEnableCollision(true);
         
-        ActivePooledProjectiles.AddUnique(Projectile);
+        TrackPooledObject(Projectile, EPooledObjectKind::Projectile);
         ProjectilesSpawned++;
         
         UE_LOG(LogWeaponPoolingIntegration, VeryVerbose, TEXT("Spawned pooled projectile: %s"), 
@@ -95,22 +119,24 @@ void UWeaponPoolingIntegrationComponent::ReturnPooledProjectile(AActor* Projecti
         return;
     }
     
-    // Hide and disable collision
-    Projectile->SetActorHiddenInGame(true);
-    Projectile->SetActorEnableCollision(false);
-    
-    // Remove from tracking
-    ActivePooledProjectiles.Remove(Projectile);
-    
-    // Return to pool
-    ObjectPoolManager->ReleaseActor(Projectile);
+    // Hides it, disables collision and returns it to the pool
+    if (PooledObjects.IsValid())
+    {
+        PooledObjects->Release(Projectile, EPooledObjectKind::Projectile);
+    }
+    else
+    {
+        Projectile->SetActorHiddenInGame(true);
+        Projectile->SetActorEnableCollision(false);
+        ObjectPoolManager->ReleaseActor(Projectile);
+    }
     
     UE_LOG(LogWeaponPoolingIntegration, VeryVerbose, TEXT("Returned projectile to pool"));
 }
 
 UParticleSystemComponent* UWeaponPoolingIntegrationComponent::SpawnPooledMuzzleFlash(UParticleSystem* MuzzleFlashEffect, const FVector& Location, const FRotator& Rotation)
 {
-    if (!ObjectPoolManager || !MuzzleFlashEffect || !bUsePooledParticleEffects)
+    if (!ObjectPoolManager || !MuzzleFlashEffect || !bUsePooledParticleEffects || !HasPooledObjectBudget(EPooledObjectKind::Effect))
     {
         return nullptr;
     }
@@ -126,7 +152,7 @@ UParticleSystemComponent* UWeaponPoolingIntegrationComponent::SpawnPooledMuzzleF
         ParticleComp->SetWorldRotation(Rotation);
         ParticleComp->Activate(true);
         
-        ActivePooledParticleEffects.AddUnique(ParticleComp);
+        TrackPooledObject(ParticleComp, EPooledObjectKind::Effect);
         EffectsSpawned++;
         
         UE_LOG(LogWeaponPoolingIntegration, VeryVerbose, TEXT("Spawned pooled muzzle flash"));
@@ -137,7 +163,7 @@ UParticleSystemComponent* UWeaponPoolingIntegrationComponent::SpawnPooledMuzzleF
 
 UParticleSystemComponent* UWeaponPoolingIntegrationComponent::SpawnPooledShellEject(UParticleSystem* ShellEjectEffect, const FVector& Location, const FRotator& Rotation)
 {
-    if (!ObjectPoolManager || !ShellEjectEffect || !bUsePooledParticleEffects)
+    if (!ObjectPoolManager || !ShellEjectEffect || !bUsePooledParticleEffects || !HasPooledObjectBudget(EPooledObjectKind::Effect))
     {
         return nullptr;
     }
@@ -153,7 +179,7 @@ UParticleSystemComponent* UWeaponPoolingIntegrationComponent::SpawnPooledShellEj
         ParticleComp->SetWorldRotation(Rotation);
         ParticleComp->Activate(true);
         
-        ActivePooledParticleEffects.AddUnique(ParticleComp);
+        TrackPooledObject(ParticleComp, EPooledObjectKind::Effect);
         EffectsSpawned++;
         
         UE_LOG(LogWeaponPoolingIntegration, VeryVerbose, TEXT("Spawned pooled shell eject effect"));
@@ -164,7 +190,7 @@ UParticleSystemComponent* UWeaponPoolingIntegrationComponent::SpawnPooledShellEj
 
 UParticleSystemComponent* UWeaponPoolingIntegrationComponent::SpawnPooledImpactEffect(UParticleSystem* ImpactEffect, const FVector& Location, const FRotator& Rotation, ESurfaceType SurfaceType)
 {
-    if (!ObjectPoolManager || !ImpactEffect || !bUsePooledParticleEffects)
+    if (!ObjectPoolManager || !ImpactEffect || !bUsePooledParticleEffects || !HasPooledObjectBudget(EPooledObjectKind::Effect))
     {
         return nullptr;
     }
@@ -181,7 +207,7 @@ UParticleSystemComponent* UWeaponPoolingIntegrationComponent::SpawnPooledImpactE
         ParticleComp->SetWorldRotation(Rotation);
         ParticleComp->Activate(true);
         
-        ActivePooledParticleEffects.AddUnique(ParticleComp);
+        TrackPooledObject(ParticleComp, EPooledObjectKind::Effect);
         EffectsSpawned++;
         
         UE_LOG(LogWeaponPoolingIntegration, VeryVerbose, TEXT("Spawned pooled impact effect for surface: %s"), 
@@ -193,7 +219,7 @@ UParticleSystemComponent* UWeaponPoolingIntegrationComponent::SpawnPooledImpactE
 
 UParticleSystemComponent* UWeaponPoolingIntegrationComponent::SpawnPooledTracer(UParticleSystem* TracerEffect, const FVector& StartLocation, const FVector& EndLocation)
 {
-    if (!ObjectPoolManager || !TracerEffect || !bUsePooledParticleEffects)
+    if (!ObjectPoolManager || !TracerEffect || !bUsePooledParticleEffects || !HasPooledObjectBudget(EPooledObjectKind::Effect))
     {
         return nullptr;
     }
@@ -214,7 +240,7 @@ UParticleSystemComponent* UWeaponPoolingIntegrationComponent::SpawnPooledTracer(
         
         ParticleComp->Activate(true);
         
-        ActivePooledParticleEffects.AddUnique(ParticleComp);
+        TrackPooledObject(ParticleComp, EPooledObjectKind::Effect);
         EffectsSpawned++;
         
         UE_LOG(LogWeaponPoolingIntegration, VeryVerbose, TEXT("Spawned pooled tracer effect"));
@@ -230,22 +256,24 @@ void UWeaponPoolingIntegrationComponent::ReturnPooledParticleEffect(UParticleSys
         return;
     }
     
-    // Deactivate the particle system
-    ParticleEffect->Deactivate();
-    ParticleEffect->SetTemplate(nullptr);
-    
-    // Remove from tracking
-    ActivePooledParticleEffects.Remove(ParticleEffect);
-    
-    // Return to pool
-    ObjectPoolManager->ReleaseObject(ParticleEffect);
+    // Deactivates it, clears the template and returns it to the pool
+    if (PooledObjects.IsValid())
+    {
+        PooledObjects->Release(ParticleEffect, EPooledObjectKind::Effect);
+    }
+    else
+    {
+        ParticleEffect->Deactivate();
+        ParticleEffect->SetTemplate(nullptr);
+        ObjectPoolManager->ReleaseObject(ParticleEffect);
+    }
     
     UE_LOG(LogWeaponPoolingIntegration, VeryVerbose, TEXT("Returned particle effect to pool"));
 }
 
 UAudioComponent* UWeaponPoolingIntegrationComponent::SpawnPooledWeaponAudio(USoundCue* WeaponSound, const FVector& Location, bool bSpatialize)
 {
-    if (!ObjectPoolManager || !WeaponSound || !bUsePooledAudio)
+    if (!ObjectPoolManager || !WeaponSound || !bUsePooledAudio || !HasPooledObjectBudget(EPooledObjectKind::Audio))
     {
         return nullptr;
     }
@@ -261,7 +289,7 @@ UAudioComponent* UWeaponPoolingIntegrationComponent::SpawnPooledWeaponAudio(USou
         AudioComp->bSpatialize = bSpatialize;
         AudioComp->Play();
         
-        ActivePooledAudioComponents.AddUnique(AudioComp);
+        TrackPooledObject(AudioComp, EPooledObjectKind::Audio);
         AudioSpawned++;
         
         UE_LOG(LogWeaponPoolingIntegration, VeryVerbose, TEXT("Spawned pooled weapon audio: %s"), 
@@ -278,22 +306,34 @@ void UWeaponPoolingIntegrationComponent::ReturnPooledAudioComponent(UAudioCompon
         return;
     }
     
-    // Stop audio and clear sound
-    AudioComponent->Stop();
-    AudioComponent->SetSound(nullptr);
-    
-    // Remove from tracking
-    ActivePooledAudioComponents.Remove(AudioComponent);
-    
-    // Return to pool
-    ObjectPoolManager->ReleaseObject(AudioComponent);
+    // Stops it, clears the sound and returns it to the pool
+    if (PooledObjects.IsValid())
+    {
+        PooledObjects->Release(AudioComponent, EPooledObjectKind::Audio);
+    }
+    else
+    {
+        AudioComponent->Stop();
+        AudioComponent->SetSound(nullptr);
+        ObjectPoolManager->ReleaseObject(AudioComponent);
+    }
     
     UE_LOG(LogWeaponPoolingIntegration, VeryVerbose, TEXT("Returned audio component to pool"));
 }
 
 UDecalComponent* UWeaponPoolingIntegrationComponent::SpawnPooledDecal(UMaterialInterface* DecalMaterial, const FVector& Location, const FRotator& Rotation, const FVector& Size, float Lifespan)
 {
-    if (!ObjectPoolManager || !DecalMaterial || !bUsePooledDecals)
+    if (UsesInstancedBulletHoles())
+    {
+        if (UBulletHoleSubsystem* BulletHoles = UBulletHoleSubsystem::Get(this))
+        {
+            BulletHoles->AddBulletHole(BulletHoleMaterial, Location, Rotation, Size, Lifespan);
+            DecalsSpawned++;
+        }
+        return nullptr;
+    }
+    
+    if (!ObjectPoolManager || !DecalMaterial || !bUsePooledDecals || !HasPooledObjectBudget(EPooledObjectKind::Decal))
     {
         return nullptr;
     }
@@ -310,7 +350,7 @@ UDecalComponent* UWeaponPoolingIntegrationComponent::SpawnPooledDecal(UMaterialI
         DecalComp->DecalSize = Size;
         DecalComp->SetLifeSpan(Lifespan);
         
-        ActivePooledDecals.AddUnique(DecalComp);
+        TrackPooledObject(DecalComp, EPooledObjectKind::Decal);
         DecalsSpawned++;
         
         UE_LOG(LogWeaponPoolingIntegration, VeryVerbose, TEXT("Spawned pooled decal"));
@@ -326,15 +366,17 @@ void UWeaponPoolingIntegrationComponent::ReturnPooledDecal(UDecalComponent* Deca
         return;
     }
     
-    // Clear decal material and hide
-    DecalComponent->SetDecalMaterial(nullptr);
-    DecalComponent->SetVisibility(false);
-    
-    // Remove from tracking
-    ActivePooledDecals.Remove(DecalComponent);
-    
-    // Return to pool
-    ObjectPoolManager->ReleaseObject(DecalComponent);
+    // Clears the material, hides it and returns it to the pool
+    if (PooledObjects.IsValid())
+    {
+        PooledObjects->Release(DecalComponent, EPooledObjectKind::Decal);
+    }
+    else
+    {
+        DecalComponent->SetDecalMaterial(nullptr);
+        DecalComponent->SetVisibility(false);
+        ObjectPoolManager->ReleaseObject(DecalComponent);
+    }
     
     UE_LOG(LogWeaponPoolingIntegration, VeryVerbose, TEXT("Returned decal to pool"));
 }
@@ -362,14 +404,9 @@ void UWeaponPoolingIntegrationComponent::OptimizeWeaponPooling()
         return;
     }
     
-    // Clean up finished objects immediately
-    CleanupFinishedObjects();
-    
     // Optimize pool sizes based on usage patterns
-    int32 ProjectileUsage = ActivePooledProjectiles.Num();
-    int32 EffectUsage = ActivePooledParticleEffects.Num();
-    int32 AudioUsage = ActivePooledAudioComponents.Num();
-    int32 DecalUsage = ActivePooledDecals.Num();
+    int32 ProjectileUsage = GetActiveCount(EPooledObjectKind::Projectile);
+    int32 EffectUsage = GetActiveCount(EPooledObjectKind::Effect);
     
     // Adjust pool sizes if needed (basic adaptive pooling)
     if (ProjectileUsage > ProjectilePoolSize * 0.8f)
@@ -390,21 +427,30 @@ void UWeaponPoolingIntegrationComponent::OptimizeWeaponPooling()
 
 FString UWeaponPoolingIntegrationComponent::GetWeaponPoolingReport() const
 {
+    const int32 ActiveProjectiles = GetActiveCount(EPooledObjectKind::Projectile);
+    const int32 ActiveEffects = GetActiveCount(EPooledObjectKind::Effect);
+    const int32 ActiveAudio = GetActiveCount(EPooledObjectKind::Audio);
+    const int32 ActiveDecals = GetActiveCount(EPooledObjectKind::Decal);
+    
     FString Report = FString::Printf(TEXT("=== Weapon Pooling Performance Report ===\n"));
-    Report += FString::Printf(TEXT("Active Projectiles: %d/%d\n"), ActivePooledProjectiles.Num(), ProjectilePoolSize);
-    Report += FString::Printf(TEXT("Active Particle Effects: %d/%d\n"), ActivePooledParticleEffects.Num(), ParticleEffectPoolSize);
-    Report += FString::Printf(TEXT("Active Audio Components: %d/%d\n"), ActivePooledAudioComponents.Num(), AudioComponentPoolSize);
-    Report += FString::Printf(TEXT("Active Decals: %d/%d\n"), ActivePooledDecals.Num(), DecalPoolSize);
+    Report += FString::Printf(TEXT("Active Projectiles: %d/%d\n"), ActiveProjectiles, ProjectilePoolSize);
+    Report += FString::Printf(TEXT("Active Particle Effects: %d/%d\n"), ActiveEffects, ParticleEffectPoolSize);
+    Report += FString::Printf(TEXT("Active Audio Components: %d/%d\n"), ActiveAudio, AudioComponentPoolSize);
+    Report += FString::Printf(TEXT("Active Decals: %d/%d\n"), ActiveDecals, DecalPoolSize);
+    if (const UBulletHoleSubsystem* BulletHoles = UsesInstancedBulletHoles() ? UBulletHoleSubsystem::Get(this) : nullptr)
+    {
+        Report += FString::Printf(TEXT("Instanced Bullet Holes: %d\n"), BulletHoles->GetBulletHoleCount());
+    }
     Report += FString::Printf(TEXT("\nTotal Spawned This Session:\n"));
     Report += FString::Printf(TEXT("  Projectiles: %d\n"), ProjectilesSpawned);
     Report += FString::Printf(TEXT("  Effects: %d\n"), EffectsSpawned);
     Report += FString::Printf(TEXT("  Audio: %d\n"), AudioSpawned);
     Report += FString::Printf(TEXT("  Decals: %d\n"), DecalsSpawned);
     Report += FString::Printf(TEXT("\nPool Usage Efficiency:\n"));
-    Report += FString::Printf(TEXT("  Projectiles: %.1f%%\n"), ActivePooledProjectiles.Num() > 0 ? (float)ActivePooledProjectiles.Num() / ProjectilePoolSize * 100.0f : 0.0f);
-    Report += FString::Printf(TEXT("  Effects: %.1f%%\n"), ActivePooledParticleEffects.Num() > 0 ? (float)ActivePooledParticleEffects.Num() / ParticleEffectPoolSize * 100.0f : 0.0f);
-    Report += FString::Printf(TEXT("  Audio: %.1f%%\n"), ActivePooledAudioComponents.Num() > 0 ? (float)ActivePooledAudioComponents.Num() / AudioComponentPoolSize * 100.0f : 0.0f);
-    Report += FString::Printf(TEXT("  Decals: %.1f%%\n"), ActivePooledDecals.Num() > 0 ? (float)ActivePooledDecals.Num() / DecalPoolSize * 100.0f : 0.0f);
+    Report += FString::Printf(TEXT("  Projectiles: %.1f%%\n"), ActiveProjectiles > 0 ? (float)ActiveProjectiles / ProjectilePoolSize * 100.0f : 0.0f);
+    Report += FString::Printf(TEXT("  Effects: %.1f%%\n"), ActiveEffects > 0 ? (float)ActiveEffects / ParticleEffectPoolSize * 100.0f : 0.0f);
+    Report += FString::Printf(TEXT("  Audio: %.1f%%\n"), ActiveAudio > 0 ? (float)ActiveAudio / AudioComponentPoolSize * 100.0f : 0.0f);
+    Report += FString::Printf(TEXT("  Decals: %.1f%%\n"), ActiveDecals > 0 ? (float)ActiveDecals / DecalPoolSize * 100.0f : 0.0f);
     
     return Report;
 }
@@ -421,7 +467,10 @@ void UWeaponPoolingIntegrationComponent::PrewarmWeaponPools()
     ObjectPoolManager->PrewarmPool(TEXT("ImpactEffectPool"), ParticleEffectPoolSize / 2);
     ObjectPoolManager->PrewarmPool(TEXT("TracerPool"), ParticleEffectPoolSize / 4);
     ObjectPoolManager->PrewarmPool(TEXT("WeaponAudioPool"), AudioComponentPoolSize / 2);
-    ObjectPoolManager->PrewarmPool(TEXT("DecalPool"), DecalPoolSize / 2);
+    if (!UsesInstancedBulletHoles())
+    {
+        ObjectPoolManager->PrewarmPool(TEXT("DecalPool"), DecalPoolSize / 2);
+    }
     
     UE_LOG(LogWeaponPoolingIntegration, Log, TEXT("Prewarmed weapon pools for optimal performance"));
 }
@@ -453,68 +502,47 @@ void UWeaponPoolingIntegrationComponent::InitializeWeaponPools()
     ObjectPoolManager->CreateObjectPool(TEXT("WeaponAudioPool"), UAudioComponent::StaticClass(), AudioComponentPoolSize, AudioComponentPoolSize * 2);
     
     // Create decal pools
-    ObjectPoolManager->CreateObjectPool(TEXT("DecalPool"), UDecalComponent::StaticClass(), DecalPoolSize, DecalPoolSize * 2);
+    if (!UsesInstancedBulletHoles())
+    {
+        ObjectPoolManager->CreateObjectPool(TEXT("DecalPool"), UDecalComponent::StaticClass(), DecalPoolSize, DecalPoolSize * 2);
+    }
     
     UE_LOG(LogWeaponPoolingIntegration, Log, TEXT("Initialized weapon-specific object pools"));
 }
 
-void UWeaponPoolingIntegrationComponent::CleanupFinishedObjects()
+void UWeaponPoolingIntegrationComponent::UpdatePoolingStatistics()
 {
-    // Clean up finished projectiles
-    for (int32 i = ActivePooledProjectiles.Num() - 1; i >= 0; --i)
-    {
-        AActor* Projectile = ActivePooledProjectiles[i];
-        if (!IsValid(Projectile) || Projectile->IsActorBeingDestroyed())
-        {
-            ActivePooledProjectiles.RemoveAt(i);
-        }
-        // Additional logic could check projectile state/velocity to determine if it should be returned
-    }
-    
-    // Clean up finished particle effects
-    for (int32 i = ActivePooledParticleEffects.Num() - 1; i >= 0; --i)
-    {
-        UParticleSystemComponent* ParticleEffect = ActivePooledParticleEffects[i];
-        if (!IsValid(ParticleEffect) || !ParticleEffect->IsActive())
-        {
-            ReturnPooledParticleEffect(ParticleEffect);
-            i--; // Adjust index since ReturnPooledParticleEffect removes from array
-        }
-    }
-    
-    // Clean up finished audio components
-    for (int32 i = ActivePooledAudioComponents.Num() - 1; i >= 0; --i)
+    // This could be expanded to track more detailed statistics
+    // and send them to the performance monitoring system
+    if (ObjectPoolManager)
     {
-        UAudioComponent* AudioComponent = ActivePooledAudioComponents[i];
-        if (!IsValid(AudioComponent) || !AudioComponent->IsPlaying())
-        {
-            ReturnPooledAudioComponent(AudioComponent);
-            i--; // Adjust index since ReturnPooledAudioComponent removes from array
-        }
+        ObjectPoolManager->UpdatePoolStatistics();
     }
-    
-    // Clean up expired decals
-    for (int32 i = ActivePooledDecals.Num() - 1; i >= 0; --i)
+}
+
+bool UWeaponPoolingIntegrationComponent::HasPooledObjectBudget(EPooledObjectKind Kind) const
+{
+    if (PooledObjects.IsValid() && !PooledObjects->HasBudget(Kind))
     {
-        UDecalComponent* DecalComponent = ActivePooledDecals[i];
-        if (!IsValid(DecalComponent) || !DecalComponent->IsVisible())
-        {
-            ReturnPooledDecal(DecalComponent);
-            i--; // Adjust index since ReturnPooledDecal removes from array
-        }
+        UE_LOG(LogWeaponPoolingIntegration, VeryVerbose, TEXT("Global pooled object budget reached for %s"), *UEnum::GetValueAsString(Kind));
+        return false;
     }
+    return true;
 }
 
-void UWeaponPoolingIntegrationComponent::UpdatePoolingStatistics()
+void UWeaponPoolingIntegrationComponent::TrackPooledObject(UObject* Object, EPooledObjectKind Kind)
 {
-    // This could be expanded to track more detailed statistics
-    // and send them to the performance monitoring system
-    if (ObjectPoolManager)
+    if (PooledObjects.IsValid())
     {
-        ObjectPoolManager->UpdatePoolStatistics();
+        PooledObjects->Track(Object, Kind, PooledObjectOwner);
     }
 }
 
+int32 UWeaponPoolingIntegrationComponent::GetActiveCount(EPooledObjectKind Kind) const
+{
+    return PooledObjects.IsValid() ? PooledObjects->GetOwnerActiveCount(PooledObjectOwner, Kind) : 0;
+}
+
 FString UWeaponPoolingIntegrationComponent::GetPoolName(const FString& PoolType, EAmmoType AmmoType) const
 {
     return FString::Printf(TEXT("%s_%s"), *PoolType, *UEnum::GetValueAsString(AmmoType));
@@ -4,6 +4,7 @@
 #include "Components/ActorComponent.h"
 #include "Engine/World.h"
 #include "../Optimization/AdvancedObjectPoolManager.h"
+#include "../Optimization/PooledObjectTracker.h"
 #include "../Physics/BallisticsSystem.h"
 #include "Particles/ParticleSystemComponent.h"
 #include "Components/AudioComponent.h"
@@ -26,6 +27,7 @@ public:
 
 protected:
     virtual void BeginPlay() override;
+    virtual void EndPlay(const EEndPlayReason::Type EndPlayReason) override;
     virtual void TickComponent(float DeltaTime, ELevelTick TickType, FActorComponentTickFunction* ThisTickFunction) override;
 
 public:
@@ -60,6 +62,7 @@ public:
     void ReturnPooledAudioComponent(UAudioComponent* AudioComponent);
 
     // Decal pooling for bullet holes and impact marks
+    // With instanced bullet holes the hole goes to the bullet hole subsystem and nullptr is returned
     UFUNCTION(BlueprintCallable, Category = "Weapon Pooling Integration")
     UDecalComponent* SpawnPooledDecal(UMaterialInterface* DecalMaterial, const FVector& Location, const FRotator& Rotation, const FVector& Size, float Lifespan = 30.0f);
 
@@ -93,6 +96,15 @@ public:
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pool Configuration")
     bool bUsePooledDecals = true;
 
+    // Bullet holes are drawn from a fixed ring buffer of instances, so DecalPool is not created.
+    // Needs BulletHoleMaterial; deferred decal materials can't be drawn on the instanced mesh
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pool Configuration")
+    bool bUseInstancedBulletHoles = false;
+
+    // Surface-domain mesh decal used for every instanced bullet hole
+    UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pool Configuration")
+    UMaterialInterface* BulletHoleMaterial = nullptr;
+
     // Pool sizes
     UPROPERTY(EditAnywhere, BlueprintReadWrite, Category = "Pool Configuration")
     int32 ProjectilePoolSize = 100;
@@ -114,18 +126,9 @@ protected:
     UPROPERTY()
     class UBallisticsSystem* BallisticsSystem;
 
-    // Tracking for active pooled objects
-    UPROPERTY()
-    TArray<AActor*> ActivePooledProjectiles;
-
-    UPROPERTY()
-    TArray<UParticleSystemComponent*> ActivePooledParticleEffects;
-
-    UPROPERTY()
-    TArray<UAudioComponent*> ActivePooledAudioComponents;
-
-    UPROPERTY()
-    TArray<UDecalComponent*> ActivePooledDecals;
+    // Active pooled objects are tracked and swept by the world's tracker under one global budget
+    TWeakObjectPtr<UPooledObjectTrackerSubsystem> PooledObjects;
+    int32 PooledObjectOwner = INDEX_NONE;
 
     // Performance tracking
     UPROPERTY()
@@ -141,15 +144,18 @@ protected:
     int32 DecalsSpawned = 0;
 
     UPROPERTY()
-    float LastCleanupTime = 0.0f;
+    float LastStatisticsTime = 0.0f;
 
     UPROPERTY()
-    float CleanupInterval = 5.0f;
+    float StatisticsInterval = 5.0f;
 
 private:
     void InitializeWeaponPools();
-    void CleanupFinishedObjects();
     void UpdatePoolingStatistics();
+    bool UsesInstancedBulletHoles() const { return bUseInstancedBulletHoles && BulletHoleMaterial; }
+    bool HasPooledObjectBudget(EPooledObjectKind Kind) const;
+    void TrackPooledObject(UObject* Object, EPooledObjectKind Kind);
+    int32 GetActiveCount(EPooledObjectKind Kind) const;
     FString GetPoolName(const FString& PoolType, EAmmoType AmmoType = EAmmoType::Rifle_556) const;
     FString GetPoolName(const FString& PoolType, ESurfaceType SurfaceType = ESurfaceType::Concrete) const;
 };